@@ -1,21 +1,29 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "esp_timer.h"
 #include "user_config.h"
 #include "lvgl.h"
 #include "user_app.h"
+#include "telemetry.h"
+#include "button_input.h"
 #include <Arduino.h>
 
 /* --- LVGL 移植部分 (保留你的原始逻辑) --- */
 static const char *TAG = "main";
 static SemaphoreHandle_t lvgl_mux = NULL;
+static TaskHandle_t lvgl_task_handle = NULL;
 #define BYTES_PER_PIXEL (LV_COLOR_FORMAT_GET_SIZE(LV_COLOR_FORMAT_RGB565))
-#define BUFF_SIZE (EPD_WIDTH * EPD_HEIGHT * BYTES_PER_PIXEL)
+#define BUFF_SIZE (EPD_WIDTH * EXAMPLE_LVGL_BAND_LINES * BYTES_PER_PIXEL)
 
 static bool example_lvgl_lock(int timeout_ms);
 static void example_lvgl_unlock(void);
 static void example_lvgl_port_task(void *arg);
 
-// 刷新回调
+// 本次刷新中各条带转换耗时之和
+static uint32_t flush_us_total = 0;
+
+// 刷新回调：局部渲染模式下每个条带调用一次，
+// 先写入驱动帧缓冲，最后一个条带时再刷新面板
 static void example_lvgl_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * color_p)
 {
   // 如果 driver 为空，防止崩溃
@@ -24,6 +32,8 @@ static void example_lvgl_flush_cb(lv_display_t * disp, const lv_area_t * area, u
      return;
   }
 
+  unsigned long flush_start = micros();
+
   uint16_t *buffer = (uint16_t *)color_p;
   // 注意：不清屏，直接覆盖，提高速度
   // driver->EPD_Clear(); 
@@ -39,38 +49,66 @@ static void example_lvgl_flush_cb(lv_display_t * disp, const lv_area_t * area, u
    	}
   }
   
+  flush_us_total += micros() - flush_start;
+
+  if (!lv_display_flush_is_last(disp)) {
+    lv_disp_flush_ready(disp);
+    return;
+  }
+
+  telemetry.record_render_end(flush_us_total);
+  telemetry.record(TM_FLUSH, flush_us_total);
+  flush_us_total = 0;
+  
   // 局部刷新提交
   driver->EPD_DisplayPart();
+  telemetry.record(TM_SPI, driver->get_last_transfer_us());
+  telemetry.record(TM_BUSY, driver->get_last_busy_us());
+  telemetry.end_page_turn();
   lv_disp_flush_ready(disp);
 }
 
-static void example_increase_lvgl_tick(void *arg)
+// 渲染开始 (用于统计渲染耗时)
+static void example_lvgl_render_start_cb(lv_event_t * e)
+{
+  telemetry.mark_render_start();
+}
+
+// 界面失效时唤醒 LVGL 任务
+static void example_lvgl_invalidate_cb(lv_event_t * e)
 {
-  lv_tick_inc(EXAMPLE_LVGL_TICK_PERIOD_MS);
+  lvgl_port_wake();
+}
+
+// LVGL 时基直接取自 esp_timer，不再需要周期中断
+static uint32_t example_lvgl_tick_get(void)
+{
+  return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+void lvgl_port_wake(void)
+{
+  if (lvgl_task_handle) xTaskNotifyGive(lvgl_task_handle);
 }
 
 void lvgl_port(void)
 {
   lv_init();
+  lv_tick_set_cb(example_lvgl_tick_get);
   lv_display_t * disp = lv_display_create(EPD_WIDTH, EPD_HEIGHT);
   lv_display_set_flush_cb(disp, example_lvgl_flush_cb);
+  lv_display_add_event_cb(disp, example_lvgl_render_start_cb, LV_EVENT_RENDER_START, NULL);
+  lv_display_add_event_cb(disp, example_lvgl_invalidate_cb, LV_EVENT_INVALIDATE_AREA, NULL);
   
-  // 使用 PSRAM 分配 LVGL 显存
-  uint8_t *buffer_1 = (uint8_t *)heap_caps_malloc(BUFF_SIZE, MALLOC_CAP_SPIRAM);
-  assert(buffer_1);
-  lv_display_set_buffers(disp, buffer_1, NULL, BUFF_SIZE, LV_DISPLAY_RENDER_MODE_FULL);
+  // 两块条带缓冲放在内部 SRAM，局部渲染只重绘脏区域
+  uint8_t *buffer_1 = (uint8_t *)heap_caps_malloc(BUFF_SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  uint8_t *buffer_2 = (uint8_t *)heap_caps_malloc(BUFF_SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  assert(buffer_1 && buffer_2);
+  lv_display_set_buffers(disp, buffer_1, buffer_2, BUFF_SIZE, LV_DISPLAY_RENDER_MODE_PARTIAL);
   
-  // 定时器
-  esp_timer_create_args_t lvgl_tick_timer_args = {};
-  lvgl_tick_timer_args.callback = &example_increase_lvgl_tick;
-  lvgl_tick_timer_args.name = "lvgl_tick";
-  esp_timer_handle_t lvgl_tick_timer = NULL;
-  ESP_ERROR_CHECK(esp_timer_create(&lvgl_tick_timer_args, &lvgl_tick_timer));
-  ESP_ERROR_CHECK(esp_timer_start_periodic(lvgl_tick_timer, EXAMPLE_LVGL_TICK_PERIOD_MS * 1000));
-
   lvgl_mux = xSemaphoreCreateMutex();
   // 创建 LVGL 任务
-  xTaskCreatePinnedToCore(example_lvgl_port_task, "LVGL", 8 * 1024, NULL, 4, NULL, 1);
+  xTaskCreatePinnedToCore(example_lvgl_port_task, "LVGL", 8 * 1024, NULL, 4, &lvgl_task_handle, 1);
   
   // 锁定并初始化 UI
   if(example_lvgl_lock(-1))
@@ -91,20 +129,30 @@ static void example_lvgl_unlock(void)
   xSemaphoreGive(lvgl_mux);
 }
 
+// LVGL 任务：处理完后阻塞等待通知，直到下一个 LVGL 定时器到期
+// 没有定时器时无限等待，空闲时不会被唤醒
 static void example_lvgl_port_task(void *arg)
 {
-  uint32_t task_delay_ms = EXAMPLE_LVGL_TASK_MAX_DELAY_MS;
+  uint32_t task_delay_ms = LV_NO_TIMER_READY;
   while(1)
   {
     if (example_lvgl_lock(-1)) 
     {
+      // 先执行排队的界面命令，同一次按键的修改合并为一次渲染
+      user_ui_drain();
+      button_input.lvgl_read();
       task_delay_ms = lv_timer_handler();
       example_lvgl_unlock();
     }
-    if (task_delay_ms > EXAMPLE_LVGL_TASK_MAX_DELAY_MS) task_delay_ms = EXAMPLE_LVGL_TASK_MAX_DELAY_MS;
-    else if (task_delay_ms < EXAMPLE_LVGL_TASK_MIN_DELAY_MS) task_delay_ms = EXAMPLE_LVGL_TASK_MIN_DELAY_MS;
-    
-    vTaskDelay(pdMS_TO_TICKS(task_delay_ms));
+
+    TickType_t wait_ticks;
+    if (task_delay_ms == LV_NO_TIMER_READY) {
+      wait_ticks = portMAX_DELAY;
+    } else {
+      if (task_delay_ms < EXAMPLE_LVGL_TASK_MIN_DELAY_MS) task_delay_ms = EXAMPLE_LVGL_TASK_MIN_DELAY_MS;
+      wait_ticks = pdMS_TO_TICKS(task_delay_ms);
+    }
+    ulTaskNotifyTake(pdTRUE, wait_ticks);
   }
 }
 
@@ -119,9 +167,9 @@ void setup()
 
 void loop() 
 {
-  // 在主循环处理按键逻辑
-  reader_loop_handle();
+  // 在主循环处理按键事件
+  uint32_t wait_ms = reader_loop_handle();
   
-  // 延时让出资源
-  delay(20);
+  // 阻塞到下一次按键中断或定时任务，空闲时不占用 CPU
+  ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait_ms));
 }
\ No newline at end of file
@@ -0,0 +1,52 @@
+#include "app_arena.h"
+#include "esp_heap_caps.h"
+#include <Arduino.h>
+#include <string.h>
+
+AppArena::AppArena(size_t cap) : base(nullptr), capacity(cap), used(0), high_water(0),
+                                 alloc_count(0), failures(0) {
+}
+
+AppArena::~AppArena() {
+    heap_caps_free(base);
+}
+
+void* AppArena::alloc(size_t size, size_t align) {
+    if (!base) {
+        base = (uint8_t*)heap_caps_malloc(capacity, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (!base) base = (uint8_t*)heap_caps_malloc(capacity, MALLOC_CAP_8BIT);
+        if (!base) {
+            failures++;
+            Serial.printf("App arena: no memory for %u bytes\n", (unsigned)capacity);
+            return nullptr;
+        }
+    }
+
+    size_t start = (used + align - 1) & ~(align - 1);
+    if (start + size > capacity) {
+        failures++;
+        Serial.printf("App arena full: %u bytes requested, %u of %u used\n",
+                      (unsigned)size, (unsigned)used, (unsigned)capacity);
+        return nullptr;
+    }
+
+    used = start + size;
+    if (used > high_water) high_water = used;
+    alloc_count++;
+    return base + start;
+}
+
+char* AppArena::copy_string(const char* s) {
+    size_t len = strlen(s) + 1;
+    char* copy = (char*)alloc(len, 1);
+    if (copy) memcpy(copy, s, len);
+    return copy;
+}
+
+void AppArena::release(Mark m) {
+    if (m < used) used = m;
+}
+
+void AppArena::reset() {
+    used = 0;
+}
@@ -0,0 +1,44 @@
+#ifndef APP_ARENA_H
+#define APP_ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Bump allocator owned by one app.
+// Objects the app keeps while it is on screen (book paths, lists) are carved
+// from one block. There is no per-object free: release() drops everything
+// allocated after a mark, and AppManager resets the whole arena when it
+// switches away from the app, so nothing can leak from one visit to the next.
+// The block is allocated on first use, in PSRAM when there is some.
+class AppArena {
+public:
+    typedef size_t Mark;
+
+    explicit AppArena(size_t capacity);
+    ~AppArena();
+
+    // Returns nullptr when the arena is full
+    void* alloc(size_t size, size_t align = sizeof(void*));
+    char* copy_string(const char* s);
+
+    Mark mark() const { return used; }
+    // Frees everything allocated since `m`
+    void release(Mark m);
+    void reset();
+
+    size_t get_used() const { return used; }
+    size_t get_high_water() const { return high_water; }
+    size_t get_capacity() const { return capacity; }
+    uint32_t get_alloc_count() const { return alloc_count; }
+    uint32_t get_failures() const { return failures; }
+
+private:
+    uint8_t* base;
+    size_t capacity;
+    size_t used;
+    size_t high_water;
+    uint32_t alloc_count;
+    uint32_t failures;
+};
+
+#endif
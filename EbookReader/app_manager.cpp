@@ -1,40 +1,92 @@
 #include "app_manager.h"
+#include "user_config.h"
 #include <Arduino.h>
 
 AppManager app_manager;
 
 AppManager::AppManager() : current_app(nullptr), apps(nullptr), app_count(0), current_app_index(-1) {
+    for (int i = 0; i < MAX_APPS; i++) {
+        app_states[i] = APP_STOPPED;
+    }
 }
 
 AppManager::~AppManager() {
-    if (current_app) {
-        current_app->deinit();
+    for (int i = 0; i < app_count; i++) {
+        if (app_states[i] != APP_STOPPED) {
+            apps[i]->deinit();
+        }
     }
 }
 
 void AppManager::register_apps(BaseApp** app_list, int count) {
+    if (count > MAX_APPS) count = MAX_APPS;
     apps = app_list;
     app_count = count;
 }
 
+void AppManager::stop_app(int index) {
+    BaseApp* app = apps[index];
+    Serial.printf("Deinit app: %s\n", app->get_app_name());
+    app->deinit();
+    app_states[index] = APP_STOPPED;
+    
+    // Whatever the app still holds goes in one step
+    AppArena& arena = app->get_arena();
+    if (arena.get_used() > 0) {
+        Serial.printf("Reset %u arena bytes of %s\n", (unsigned)arena.get_used(),
+                      app->get_app_name());
+    }
+    arena.reset();
+}
+
+bool AppManager::memory_low() {
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.free_size < APP_SUSPEND_MIN_FREE_BYTES;
+}
+
+void AppManager::trim_suspended() {
+    for (int i = 0; i < app_count; i++) {
+        if (app_states[i] == APP_SUSPENDED) {
+            stop_app(i);
+        }
+    }
+}
+
 void AppManager::switch_to_app(int index) {
     if (index < 0 || index >= app_count) {
         Serial.printf("Invalid app index: %d\n", index);
         return;
     }
     
-    // Deinit current app if exists
+    // Park the current app, or release it when memory is short
     if (current_app) {
-        Serial.printf("Deinit app: %s\n", current_app->get_app_name());
-        current_app->deinit();
+        bool low = memory_low();
+        if (low) {
+            Serial.println("LVGL heap low, releasing suspended apps");
+            trim_suspended();
+        }
+        if (current_app->supports_suspend() && !low) {
+            Serial.printf("Suspend app: %s\n", current_app->get_app_name());
+            current_app->suspend();
+            app_states[current_app_index] = APP_SUSPENDED;
+        } else {
+            stop_app(current_app_index);
+        }
     }
     
     // Switch to new app
     current_app_index = index;
     current_app = apps[index];
     
-    Serial.printf("Init app: %s\n", current_app->get_app_name());
-    current_app->init();
+    if (app_states[index] == APP_SUSPENDED) {
+        Serial.printf("Resume app: %s\n", current_app->get_app_name());
+        current_app->resume();
+    } else {
+        Serial.printf("Init app: %s\n", current_app->get_app_name());
+        current_app->init();
+    }
+    app_states[index] = APP_RUNNING;
 }
 
 BaseApp* AppManager::get_current_app() {
@@ -52,12 +104,33 @@ BaseApp* AppManager::get_app(int index) {
     return apps[index];
 }
 
+void AppManager::handle_button(const ButtonEvent& event) {
+    if (current_app) {
+        current_app->on_button(event);
+    }
+}
+
 void AppManager::loop() {
     if (current_app) {
         current_app->loop();
     }
 }
 
+void AppManager::dump_memory(void (*print_line)(const char* line)) {
+    char line[96];
+    static const char* const STATE_NAMES[] = { "stopped", "running", "suspended" };
+    print_line("app          state        used   high  capacity  allocs  failed");
+    for (int i = 0; i < app_count; i++) {
+        AppArena& arena = apps[i]->get_arena();
+        snprintf(line, sizeof(line), "%-12s %-9s  %6u %6u  %8u  %6lu  %6lu", apps[i]->get_app_name(),
+                 STATE_NAMES[app_states[i]],
+                 (unsigned)arena.get_used(), (unsigned)arena.get_high_water(),
+                 (unsigned)arena.get_capacity(), (unsigned long)arena.get_alloc_count(),
+                 (unsigned long)arena.get_failures());
+        print_line(line);
+    }
+}
+
 const char* AppManager::get_current_app_info() {
     if (current_app) {
         return current_app->get_app_info();
@@ -2,10 +2,15 @@
 #define APP_MANAGER_H
 
 #include "lvgl.h"
+#include "button_input.h"
+#include "app_arena.h"
 
 // Base class for all apps
 class BaseApp {
 public:
+    static const size_t DEFAULT_ARENA_SIZE = 1024;
+    
+    explicit BaseApp(size_t arena_size = DEFAULT_ARENA_SIZE) : arena(arena_size) {}
     virtual ~BaseApp() {}
     
     // Initialize app UI
@@ -14,24 +19,53 @@ public:
     // Cleanup app UI
     virtual void deinit() = 0;
     
-    // Handle loop logic (button presses, etc.)
-    virtual void loop() = 0;
+    // Apps that return true are parked with suspend() when switched away
+    // from, keeping their state, widgets and arena, and come back with
+    // resume(). The others are deinit()ed and init()ed again.
+    virtual bool supports_suspend() { return false; }
+    virtual void suspend() {}
+    virtual void resume() {}
+    
+    // Handle a debounced button press
+    virtual void on_button(const ButtonEvent& event) = 0;
+    
+    // Periodic work, called on the LVGL task after each batch of UI commands
+    virtual void loop() {}
     
     // Get app-specific info for bottom bar
     virtual const char* get_app_info() = 0;
     
     // Get app name
     virtual const char* get_app_name() = 0;
+    
+    AppArena& get_arena() { return arena; }
+    
+protected:
+    // Allocations that live while the app is on screen; AppManager resets
+    // it after deinit(), so pointers into it must not outlive the visit
+    AppArena arena;
+};
+
+enum AppLifecycle {
+    APP_STOPPED = 0,   // Not initialized, or deinit()ed
+    APP_RUNNING,
+    APP_SUSPENDED      // Parked with its state intact
 };
 
 // App Manager to handle app switching
 class AppManager {
 private:
+    static const int MAX_APPS = 8;
+    
     BaseApp* current_app;
     BaseApp** apps;
+    AppLifecycle app_states[MAX_APPS];
     int app_count;
     int current_app_index;
     
+    void stop_app(int index);
+    bool memory_low();
+    
 public:
     AppManager();
     ~AppManager();
@@ -39,9 +73,13 @@ public:
     // Register apps
     void register_apps(BaseApp** app_list, int count);
     
-    // Switch to specific app by index
+    // Switch to specific app by index.
+    // The current app is suspended if it supports it and memory allows.
     void switch_to_app(int index);
     
+    // Fully deinit every suspended app
+    void trim_suspended();
+    
     // Get current app
     BaseApp* get_current_app();
     
@@ -51,11 +89,17 @@ public:
     // Get app by index
     BaseApp* get_app(int index);
     
+    // Forward a button event to the current app
+    void handle_button(const ButtonEvent& event);
+    
     // Call current app's loop
     void loop();
     
     // Get current app info for bottom bar
     const char* get_current_app_info();
+    
+    // Print each app's arena use
+    void dump_memory(void (*print_line)(const char* line));
 };
 
 // Global app manager instance
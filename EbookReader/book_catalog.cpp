@@ -0,0 +1,511 @@
+#include "book_catalog.h"
+#include "collation.h"
+#include "book_source.h"
+#include "epub_book.h"
+#include <Arduino.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const uint32_t CATALOG_MAGIC = 0x31434245;  // "EBC1"
+static const uint16_t CATALOG_VERSION = 2;
+// Version 1 entries end before the sort key; they are read as they are and
+// given keys by the next rebuild
+static const uint16_t CATALOG_V1_ENTRY_SIZE = offsetof(CatalogEntry, sort_key);
+static const uint32_t FNV_OFFSET = 2166136261u;
+static const uint32_t FNV_PRIME = 16777619u;
+
+struct OldIndex {
+    uint32_t hash;
+    uint32_t index;
+};
+
+static int compare_old_index(const void* a, const void* b) {
+    uint32_t ha = ((const OldIndex*)a)->hash;
+    uint32_t hb = ((const OldIndex*)b)->hash;
+    return ha < hb ? -1 : (ha > hb ? 1 : 0);
+}
+
+static uint32_t fnv_update(uint32_t h, const char* s) {
+    // Includes the terminator, so "ab","c" and "a","bc" differ
+    do {
+        h ^= (uint8_t)*s;
+        h *= FNV_PRIME;
+    } while (*s++);
+    return h;
+}
+
+CatalogSort BookCatalog::comparing = CATALOG_SORT_NAME;
+
+BookCatalog::BookCatalog(const char* root, const char* root_catalog_path)
+    : root(root), root_catalog_path(root_catalog_path), view(nullptr), view_capacity(0),
+      view_count(0), view_stale(true), view_unsorted(true) {
+    memset(&header, 0, sizeof(header));
+    open_folder(root);
+}
+
+bool BookCatalog::is_root() const {
+    return strcmp(folder, root) == 0;
+}
+
+// Leaves the view buffer for the next folder
+void BookCatalog::close_folder() {
+    if (file) file.close();
+    memset(&header, 0, sizeof(header));
+    view_count = 0;
+    view_stale = true;
+}
+
+bool BookCatalog::open_folder(const char* path) {
+    if (strlen(path) >= sizeof(folder)) {
+        Serial.printf("Path too long: %s\n", path);
+        return false;
+    }
+    close_folder();
+    strcpy(folder, path);
+
+    if (is_root()) {
+        snprintf(catalog_path, sizeof(catalog_path), "%s", root_catalog_path);
+    } else {
+        // "/.reader/catalog.bin" -> "/.reader/1a2b3c4d.bin"
+        const char* slash = strrchr(root_catalog_path, '/');
+        int dir_len = slash ? (int)(slash - root_catalog_path) : 0;
+        snprintf(catalog_path, sizeof(catalog_path), "%.*s/%08lx.bin", dir_len, root_catalog_path,
+                 (unsigned long)hash_name(folder));
+    }
+    return true;
+}
+
+bool BookCatalog::open_subfolder(const char* name) {
+    char path[CATALOG_PATH_SIZE];
+    if (snprintf(path, sizeof(path), "%s/%s", folder, name) >= (int)sizeof(path)) {
+        Serial.printf("Path too long: %s/%s\n", folder, name);
+        return false;
+    }
+    return open_folder(path);
+}
+
+bool BookCatalog::open_parent() {
+    if (is_root()) return false;
+    char path[CATALOG_PATH_SIZE];
+    strcpy(path, folder);
+    char* slash = strrchr(path, '/');
+    if (!slash || slash == path) return open_folder(root);
+    *slash = '\0';
+    return open_folder(path);
+}
+
+uint32_t BookCatalog::hash_name(const char* name) {
+    return fnv_update(FNV_OFFSET, name);
+}
+
+bool BookCatalog::is_book_name(const char* name) {
+    int len = strlen(name);
+    if (len < 4) return false;
+    // Text, text compressed with gzip or zlib, or EPUB; the same names the
+    // reader opens them by
+    return strcasecmp(name + len - 4, ".txt") == 0 || GzipSource::is_compressed_name(name) ||
+           EpubBook::is_epub_name(name);
+}
+
+bool BookCatalog::open_catalog() {
+    memset(&header, 0, sizeof(header));
+    file = SD.open(catalog_path, "r+");
+    if (!file) return false;
+
+    Header h;
+    memset(&h, 0, sizeof(h));
+    bool complete = file.read((uint8_t*)&h, sizeof(h)) == sizeof(h);
+    bool current = h.version == CATALOG_VERSION && h.entry_size == sizeof(CatalogEntry);
+    bool old = h.version == 1 && h.entry_size == CATALOG_V1_ENTRY_SIZE;
+    // Subfolder catalogs are named by a hash of the path; a collision shows here
+    bool other_folder = current && h.folder_hash != 0 && h.folder_hash != hash_name(folder);
+    if (!complete || h.magic != CATALOG_MAGIC || !(current || old) || h.count > MAX_BOOKS || other_folder) {
+        Serial.println("Catalog invalid, rebuilding");
+        file.close();
+        return false;
+    }
+    if (old) {
+        h.sort = CATALOG_SORT_NAME;
+        h.folder_hash = 0;
+    }
+    if (h.sort >= CATALOG_SORT_COUNT) h.sort = CATALOG_SORT_NAME;
+    header = h;
+    return true;
+}
+
+// The view lives in the app arena, which is reset once the app is closed
+void BookCatalog::close() {
+    close_folder();
+    view = nullptr;
+    view_capacity = 0;
+}
+
+bool BookCatalog::write_header(File& f, const Header& h) {
+    f.seek(0);
+    return f.write((const uint8_t*)&h, sizeof(h)) == sizeof(h);
+}
+
+bool BookCatalog::refresh(AppArena& scratch) {
+    if (!file) open_catalog();
+
+    File dir = SD.open(folder);
+    if (!dir || !dir.isDirectory()) {
+        Serial.printf("Cannot read %s\n", folder);
+        return false;
+    }
+
+    // One pass over the directory by name; the listing goes to the scratch
+    // arena as consecutive strings, folders with a trailing '/'. The folder's
+    // time cannot stand in for it: FAT does not update it when a file is added
+    AppArena::Mark mark = scratch.mark();
+    const char* names = nullptr;
+    int name_count = 0;
+    uint32_t signature = FNV_OFFSET;
+    bool is_dir = false;
+    char listed[CATALOG_NAME_SIZE + 1];
+
+    while (true) {
+        String path = dir.getNextFileName(&is_dir);
+        if (path.isEmpty()) break;
+
+        const char* name = strrchr(path.c_str(), '/');
+        name = name ? name + 1 : path.c_str();
+        if (name[0] == '.') continue;
+        if (!is_dir && !is_book_name(name)) continue;
+        if (strlen(name) >= (size_t)CATALOG_NAME_SIZE) {
+            Serial.printf("Name too long, skipped: %s\n", name);
+            continue;
+        }
+        if (name_count >= MAX_BOOKS) {
+            Serial.printf("More than %d entries, the rest are not listed\n", MAX_BOOKS);
+            break;
+        }
+
+        snprintf(listed, sizeof(listed), is_dir ? "%s/" : "%s", name);
+        char* copy = scratch.copy_string(listed);
+        if (!copy) {
+            // A partial listing would be saved as the whole folder
+            Serial.printf("No room to list %s after %d entries, catalog kept\n", folder, name_count);
+            dir.close();
+            scratch.release(mark);
+            return false;
+        }
+        if (!names) names = copy;
+        signature = fnv_update(signature, listed);
+        name_count++;
+    }
+    dir.close();
+
+    bool ok = true;
+    if (file && header.version == CATALOG_VERSION && signature == header.dir_signature &&
+        (uint32_t)name_count == header.count) {
+        Serial.printf("Catalog up to date: %d entries in %s\n", name_count, folder);
+    } else {
+        ok = rebuild(names, name_count, signature, scratch);
+    }
+
+    scratch.release(mark);
+    return ok;
+}
+
+bool BookCatalog::rebuild(const char* names, int name_count, uint32_t signature, AppArena& scratch) {
+    CatalogEntry entry;
+
+    // Old entries sorted by name hash, to carry positions over
+    int old_count = file ? (int)header.count : 0;
+    OldIndex* old_index = nullptr;
+    if (old_count > 0) {
+        old_index = (OldIndex*)scratch.alloc(old_count * sizeof(OldIndex));
+        if (!old_index) old_count = 0;
+    }
+    for (int i = 0; i < old_count; i++) {
+        if (!get(i, entry)) {
+            old_count = i;
+            break;
+        }
+        old_index[i].hash = entry.name_hash;
+        old_index[i].index = i;
+    }
+    if (old_count > 1) qsort(old_index, old_count, sizeof(OldIndex), compare_old_index);
+
+    char tmp_path[64];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", catalog_path);
+
+    // The catalog lives in a folder of its own, e.g. /.reader
+    char parent[64];
+    strncpy(parent, catalog_path, sizeof(parent) - 1);
+    parent[sizeof(parent) - 1] = '\0';
+    char* slash = strrchr(parent, '/');
+    if (slash && slash != parent) {
+        *slash = '\0';
+        if (!SD.exists(parent)) SD.mkdir(parent);
+    }
+
+    File out = SD.open(tmp_path, FILE_WRITE);
+    if (!out) {
+        Serial.printf("Cannot write %s\n", tmp_path);
+        return false;
+    }
+
+    // The read sequence carries over
+    Header new_header = header;
+    new_header.magic = CATALOG_MAGIC;
+    new_header.version = CATALOG_VERSION;
+    new_header.entry_size = sizeof(CatalogEntry);
+    new_header.count = name_count;
+    new_header.dir_signature = signature;
+    new_header.reserved = 0;
+    new_header.folder_hash = hash_name(folder);
+    bool ok = write_header(out, new_header);
+
+    int kept = 0;
+    int folders = 0;
+    const char* listed = names;
+    char name[CATALOG_NAME_SIZE];
+    for (int i = 0; i < name_count && ok; i++) {
+        // Folders were listed with a trailing '/'
+        size_t len = strlen(listed);
+        bool is_folder = len > 0 && listed[len - 1] == '/';
+        if (is_folder) len--;
+        memcpy(name, listed, len);
+        name[len] = '\0';
+        listed += strlen(listed) + 1;
+
+        uint32_t hash = hash_name(name);
+        bool found = false;
+
+        OldIndex key = { hash, 0 };
+        OldIndex* match = nullptr;
+        if (old_count > 0) {
+            match = (OldIndex*)bsearch(&key, old_index, old_count, sizeof(OldIndex), compare_old_index);
+        }
+        if (match) {
+            // Back up to the first entry with this hash, then compare names
+            while (match > old_index && (match - 1)->hash == hash) match--;
+            for (; match < old_index + old_count && match->hash == hash; match++) {
+                if (get(match->index, entry) && strcmp(entry.name, name) == 0) {
+                    found = true;
+                    break;
+                }
+            }
+        }
+        if (found) {
+            kept++;
+        } else {
+            memset(&entry, 0, sizeof(entry));
+            entry.name_hash = hash;
+            strcpy(entry.name, name);
+        }
+        if (!found || header.version != CATALOG_VERSION) {
+            collation_key(entry.name, entry.sort_key, sizeof(entry.sort_key));
+        }
+        entry.flags = is_folder ? CATALOG_FLAG_FOLDER : 0;
+        if (is_folder) folders++;
+
+        ok = out.write((const uint8_t*)&entry, sizeof(entry)) == sizeof(entry);
+    }
+    out.close();
+
+    if (file) file.close();
+    if (!ok) {
+        Serial.println("Catalog write failed");
+        SD.remove(tmp_path);
+        open_catalog();
+        return false;
+    }
+
+    SD.remove(catalog_path);
+    SD.rename(tmp_path, catalog_path);
+    Serial.printf("Catalog rebuilt: %d books, %d folders, %d kept, %d new\n", name_count - folders, folders,
+                  kept, name_count - kept);
+    view_stale = true;
+    return open_catalog();
+}
+
+bool BookCatalog::get(int index, CatalogEntry& entry) {
+    if (!file || index < 0 || index >= (int)header.count) return false;
+    // Old catalogs have shorter entries, without a sort key
+    size_t size = header.entry_size;
+    if (size < sizeof(entry)) memset((uint8_t*)&entry + size, 0, sizeof(entry) - size);
+    file.seek(sizeof(Header) + index * size);
+    return file.read((uint8_t*)&entry, size) == size;
+}
+
+bool BookCatalog::update(int index, const CatalogEntry& entry) {
+    if (!file || index < 0 || index >= (int)header.count) return false;
+    if (header.version != CATALOG_VERSION) return false;
+
+    // Keep the view's copy of the sort fields current
+    for (int i = 0; i < view_count; i++) {
+        if (view[i].index != index) continue;
+        if (view[i].last_read != entry.last_read || view[i].size != entry.size) {
+            view[i].last_read = entry.last_read;
+            view[i].size = entry.size;
+            view_unsorted = true;
+        }
+        break;
+    }
+
+    file.seek(sizeof(Header) + index * sizeof(CatalogEntry));
+    bool ok = file.write((const uint8_t*)&entry, sizeof(entry)) == sizeof(entry);
+    // The header carries the read sequence
+    ok = write_header(file, header) && ok;
+    file.flush();
+    return ok;
+}
+
+void BookCatalog::format_path(const CatalogEntry& entry, char* buf, size_t len) const {
+    snprintf(buf, len, "%s/%s", folder, entry.name);
+}
+
+BookEncoding BookCatalog::detect_encoding(const uint8_t* data, int len) {
+    if (len >= 3 && data[0] == 0xEF && data[1] == 0xBB && data[2] == 0xBF) return BOOK_ENCODING_UTF8_BOM;
+    if (len >= 2 && data[0] == 0xFF && data[1] == 0xFE) return BOOK_ENCODING_UTF16LE;
+    if (len >= 2 && data[0] == 0xFE && data[1] == 0xFF) return BOOK_ENCODING_UTF16BE;
+
+    // Valid UTF-8 (plain ASCII included) unless a sequence is broken; a
+    // sequence cut off by the end of the sample does not count
+    int i = 0;
+    while (i < len) {
+        uint8_t c = data[i];
+        int extra;
+        if (c < 0x80) extra = 0;
+        else if ((c & 0xE0) == 0xC0 && c >= 0xC2) extra = 1;
+        else if ((c & 0xF0) == 0xE0) extra = 2;
+        else if ((c & 0xF8) == 0xF0 && c <= 0xF4) extra = 3;
+        else return BOOK_ENCODING_GBK;
+
+        if (i + extra >= len) break;
+        for (int k = 1; k <= extra; k++) {
+            if ((data[i + k] & 0xC0) != 0x80) return BOOK_ENCODING_GBK;
+        }
+        i += extra + 1;
+    }
+    return BOOK_ENCODING_UTF8;
+}
+
+const char* BookCatalog::encoding_name(uint8_t encoding) {
+    switch (encoding) {
+        case BOOK_ENCODING_UTF8: return "UTF-8";
+        case BOOK_ENCODING_UTF8_BOM: return "UTF-8 BOM";
+        case BOOK_ENCODING_UTF16LE: return "UTF-16LE";
+        case BOOK_ENCODING_UTF16BE: return "UTF-16BE";
+        case BOOK_ENCODING_GBK: return "GBK";
+        default: return "unknown";
+    }
+}
+
+int BookCatalog::compare_view(const void* a, const void* b) {
+    const ViewRecord* ra = (const ViewRecord*)a;
+    const ViewRecord* rb = (const ViewRecord*)b;
+
+    // Folders come first, by name
+    bool fa = ra->flags & CATALOG_FLAG_FOLDER;
+    bool fb = rb->flags & CATALOG_FLAG_FOLDER;
+    if (fa != fb) return fa ? -1 : 1;
+    if (fa) return memcmp(ra->key, rb->key, sizeof(ra->key));
+
+    if (comparing == CATALOG_SORT_RECENT && ra->last_read != rb->last_read) {
+        return ra->last_read > rb->last_read ? -1 : 1;
+    }
+    if (comparing == CATALOG_SORT_SIZE && ra->size != rb->size) {
+        return ra->size > rb->size ? -1 : 1;
+    }
+    int c = memcmp(ra->key, rb->key, sizeof(ra->key));
+    if (c != 0) return c;
+    // Equal keys keep the folder order
+    return (int)ra->index - (int)rb->index;
+}
+
+bool BookCatalog::load_view(AppArena& arena) {
+    if (view && !view_stale) {
+        if (view_unsorted) sort_view();
+        return true;
+    }
+
+    int count = header.count;
+    if (count > view_capacity) {
+        // A bigger view is carved anew; the old one goes with the arena
+        view = (ViewRecord*)arena.alloc(count * sizeof(ViewRecord));
+        view_capacity = view ? count : 0;
+    }
+    view_count = 0;
+    view_stale = false;
+    if (!view) {
+        Serial.printf("No room for a view of %d books, using folder order\n", count);
+        return false;
+    }
+
+    // One sequential read of the catalog
+    CatalogEntry entry;
+    for (int i = 0; i < count; i++) {
+        if (!get(i, entry)) break;
+        ViewRecord& r = view[view_count++];
+        memcpy(r.key, entry.sort_key, sizeof(r.key));
+        r.last_read = entry.last_read;
+        r.size = entry.size;
+        r.index = i;
+        r.flags = entry.flags;
+    }
+    sort_view();
+    return true;
+}
+
+void BookCatalog::sort_view() {
+    if (get_sort() == CATALOG_SORT_SIZE) fill_sizes();
+    comparing = get_sort();
+    if (view_count > 1) qsort(view, view_count, sizeof(ViewRecord), compare_view);
+    view_unsorted = false;
+}
+
+int BookCatalog::view_index(int position) const {
+    if (position < 0) return -1;
+    if (position < view_count) return view[position].index;
+    return position < (int)header.count ? position : -1;
+}
+
+void BookCatalog::set_sort(CatalogSort sort) {
+    if (sort >= CATALOG_SORT_COUNT) sort = CATALOG_SORT_NAME;
+    header.sort = sort;
+    if (file && header.version == CATALOG_VERSION) {
+        write_header(file, header);
+        file.flush();
+    }
+    sort_view();
+}
+
+// The scan never opens a book, so books that were never read have no size
+// yet. Their size and date are looked up once and stored; the encoding is
+// still left for the first open.
+void BookCatalog::fill_sizes() {
+    CatalogEntry entry;
+    char path[CATALOG_PATH_SIZE];
+    int filled = 0;
+    unsigned long start = millis();
+
+    for (int i = 0; i < view_count; i++) {
+        if (view[i].size != 0 || (view[i].flags & CATALOG_FLAG_FOLDER)) continue;
+        if (!get(view[i].index, entry) || entry.mtime != 0) continue;
+
+        format_path(entry, path, sizeof(path));
+        File f = SD.open(path, FILE_READ);
+        if (!f) continue;
+        entry.size = f.size();
+        entry.mtime = (uint32_t)f.getLastWrite();
+        f.close();
+        update(view[i].index, entry);
+        filled++;
+    }
+    if (filled > 0) {
+        Serial.printf("Looked up %d book sizes (%lu ms)\n", filled, millis() - start);
+    }
+}
+
+const char* BookCatalog::sort_name(CatalogSort sort) {
+    switch (sort) {
+        case CATALOG_SORT_RECENT: return "Recent";
+        case CATALOG_SORT_SIZE: return "Size";
+        default: return "Name";
+    }
+}
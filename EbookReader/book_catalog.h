@@ -0,0 +1,158 @@
+#ifndef BOOK_CATALOG_H
+#define BOOK_CATALOG_H
+
+#include <stdint.h>
+#include <SD.h>
+#include "app_arena.h"
+
+enum BookEncoding {
+    BOOK_ENCODING_UNKNOWN = 0,   // Not opened yet
+    BOOK_ENCODING_UTF8,
+    BOOK_ENCODING_UTF8_BOM,
+    BOOK_ENCODING_UTF16LE,
+    BOOK_ENCODING_UTF16BE,
+    BOOK_ENCODING_GBK            // Not valid UTF-8, assumed GBK/GB18030
+};
+
+static const int CATALOG_NAME_SIZE = 136;
+static const int CATALOG_KEY_SIZE = 24;
+static const int CATALOG_PATH_SIZE = 256;
+
+// CatalogEntry::flags
+static const uint8_t CATALOG_FLAG_FOLDER = 0x01;
+
+enum CatalogSort {
+    CATALOG_SORT_NAME = 0,       // Collation key: natural numbers, pinyin
+    CATALOG_SORT_RECENT,         // Last read first, then the unread by name
+    CATALOG_SORT_SIZE,           // Largest first
+    CATALOG_SORT_COUNT
+};
+
+// One fixed-size record per book or subfolder, so a single entry can be
+// read or rewritten in place. Size, mtime and encoding are filled in the
+// first time the book is opened; the scan itself never opens a book. The
+// sort key is computed from the name when the entry is created (see
+// collation.h).
+struct CatalogEntry {
+    uint32_t name_hash;
+    uint32_t size;
+    uint32_t mtime;
+    uint32_t last_offset;      // Reading position
+    uint32_t last_read;        // Read sequence number, 0 = never opened
+    uint16_t last_page;
+    uint8_t encoding;          // BookEncoding
+    uint8_t flags;             // CATALOG_FLAG_*
+    char name[CATALOG_NAME_SIZE];
+    uint8_t sort_key[CATALOG_KEY_SIZE];   // Added in version 2
+};
+
+// Persistent list of the books and subfolders in one folder of the library.
+// Every folder has a catalog file of its own, written the first time the
+// folder is entered; subfolders are listed as entries but not looked into,
+// so only the folders actually browsed are ever enumerated.
+// Every refresh() enumerates the folder once by name only (no File per
+// entry) and hashes the names. When that matches the signature stored with
+// the catalog, nothing else happens; otherwise the catalog is rewritten
+// from that one listing, keeping positions and metadata of books that are
+// still there.
+//
+// The shelf shows the catalog through a view: the sort fields of every
+// entry, loaded once into the app arena and sorted there. Changing the
+// order is an in-memory sort of the view; it is loaded again only after the
+// catalog has been rebuilt.
+class BookCatalog {
+public:
+    static const int MAX_BOOKS = 4096;
+
+    // `root_catalog_path` is the catalog of `root`; those of subfolders go
+    // next to it, named after a hash of the folder path
+    BookCatalog(const char* root, const char* root_catalog_path);
+
+    // Switch to another folder; refresh() then reads its catalog
+    bool open_folder(const char* path);
+    bool open_subfolder(const char* name);
+    bool open_parent();
+    const char* get_folder() const { return folder; }
+    bool is_root() const;
+
+    // `scratch` holds the listing while rebuilding and is released after.
+    // Returns false if the folder cannot be read.
+    bool refresh(AppArena& scratch);
+    void close();
+
+    int count() const { return header.count; }
+    bool get(int index, CatalogEntry& entry);
+    bool update(int index, const CatalogEntry& entry);
+
+    // Full path of an entry, "<folder>/<name>", at most CATALOG_PATH_SIZE
+    void format_path(const CatalogEntry& entry, char* buf, size_t len) const;
+
+    // Stamp for CatalogEntry::last_read
+    uint32_t next_read_seq() { return ++header.read_seq; }
+
+    // Loads the view if the catalog changed since the last call, and sorts
+    // it if needed. Returns false when it does not fit in `arena`; the view
+    // is then the catalog order.
+    bool load_view(AppArena& arena);
+    // Catalog index of the book at `position` in the view
+    int view_index(int position) const;
+
+    CatalogSort get_sort() const { return (CatalogSort)header.sort; }
+    // Sorts the view and remembers the order in the catalog. Sorting by size
+    // first looks up the size of books that were never opened, once.
+    void set_sort(CatalogSort sort);
+    static const char* sort_name(CatalogSort sort);
+
+    static BookEncoding detect_encoding(const uint8_t* data, int len);
+    static const char* encoding_name(uint8_t encoding);
+    // FNV-1a of a name or path, also used to name files kept per folder or book
+    static uint32_t hash_name(const char* name);
+
+private:
+    struct Header {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t entry_size;
+        uint32_t count;
+        uint32_t dir_signature;   // Hash of the folder's book names, in order
+        uint32_t read_seq;
+        uint32_t sort;            // CatalogSort
+        uint32_t reserved;        // Was the folder's time; keeps the header at 32 bytes
+        uint32_t folder_hash;     // Hash of the folder path, 0 = not checked
+    };
+
+    // Sort fields of one entry, in memory
+    struct ViewRecord {
+        uint8_t key[CATALOG_KEY_SIZE];
+        uint32_t last_read;
+        uint32_t size;
+        uint16_t index;
+        uint16_t flags;
+    };
+
+    const char* root;
+    const char* root_catalog_path;
+    char folder[CATALOG_PATH_SIZE];
+    char catalog_path[64];
+    File file;
+    Header header;
+
+    ViewRecord* view;
+    int view_capacity;
+    int view_count;
+    bool view_stale;              // Catalog rebuilt since the view was loaded
+    bool view_unsorted;
+
+    static bool is_book_name(const char* name);
+    static int compare_view(const void* a, const void* b);
+    static CatalogSort comparing;   // Order for compare_view during qsort
+
+    void close_folder();
+    bool open_catalog();
+    bool write_header(File& f, const Header& h);
+    bool rebuild(const char* names, int name_count, uint32_t signature, AppArena& scratch);
+    void sort_view();
+    void fill_sizes();
+};
+
+#endif
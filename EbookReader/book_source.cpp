@@ -0,0 +1,329 @@
+#include "book_source.h"
+#include "esp_heap_caps.h"
+#include <Arduino.h>
+#include <string.h>
+
+static const uint32_t INDEX_MAGIC = 0x315A4245;   // "EBZ1"
+static const uint16_t INDEX_VERSION = 1;
+// A checkpoint on disk: its point, then the window
+static const uint32_t RECORD_SIZE = sizeof(inflate_point_t) + INFLATE_WINDOW_SIZE;
+
+// ========== FileSource ==========
+
+void FileSource::attach(File* f, uint32_t text_base) {
+    file = f;
+    base = text_base;
+    file_size = f && f->size() > text_base ? f->size() - text_base : 0;
+}
+
+int FileSource::read(uint32_t offset, uint8_t* buf, int len) {
+    if (!file || offset >= file_size) return file ? 0 : -1;
+    if (!file->seek(base + offset)) return -1;
+    return file->read(buf, len);
+}
+
+// ========== GzipSource ==========
+
+GzipSource::GzipSource() : file(nullptr), opened(false), dirty(false), book_size(0), book_mtime(0),
+                           data_offset(0), text_size(0), stamp(0), checkpoints(nullptr), count(0),
+                           restores(0) {
+    memset(stream_used, 0, sizeof(stream_used));
+}
+
+GzipSource::~GzipSource() {
+    close();
+}
+
+bool GzipSource::is_compressed_name(const char* name) {
+    // Compressed text only: a .tar.gz or other archive is not a book
+    int len = strlen(name);
+    return len > 7 && (strcasecmp(name + len - 7, ".txt.gz") == 0 || strcasecmp(name + len - 7, ".txt.zz") == 0);
+}
+
+bool GzipSource::open(File* f, uint32_t mtime, const char* index_path) {
+    close();
+    file = f;
+    book_size = f->size();
+    book_mtime = mtime;
+    if (!parse_header()) {
+        Serial.println("Not a gzip or zlib file");
+        return false;
+    }
+
+    checkpoints = (inflate_point_t*)heap_caps_malloc(MAX_CHECKPOINTS * sizeof(inflate_point_t),
+                                                     MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    bool ok = checkpoints != nullptr;
+    for (int i = 0; i < STREAMS && ok; i++) {
+        ok = streams[i].begin();
+        streams[i].set_boundary_cb(boundary_cb, this);
+        streams[i].start(file, data_offset);
+        stream_used[i] = 0;
+    }
+    if (!ok) {
+        Serial.println("No memory for the inflate streams");
+        close();
+        return false;
+    }
+    opened = true;
+
+    // A zlib stream does not record its length: the first open inflates it
+    // all once, which also makes every checkpoint
+    if (!load_index(index_path) && (!create_index(index_path) || (text_size == 0 && !measure()))) {
+        close();
+        return false;
+    }
+    Serial.printf("Compressed book: %lu bytes of text in %lu, %d checkpoints\n", (unsigned long)text_size,
+                  (unsigned long)book_size, count);
+    return true;
+}
+
+void GzipSource::close() {
+    if (opened) {
+        save();
+        Serial.printf("Compressed book closed: %d checkpoints, %lu restores\n", count,
+                      (unsigned long)restores);
+    }
+    if (index_file) index_file.close();
+    for (int i = 0; i < STREAMS; i++) streams[i].end();
+    heap_caps_free(checkpoints);
+    checkpoints = nullptr;
+    count = 0;
+    restores = 0;
+    text_size = 0;
+    opened = false;
+    dirty = false;
+    file = nullptr;
+}
+
+bool GzipSource::parse_header() {
+    uint8_t h[10];
+    if (book_size < 18 || !file->seek(0) || file->read(h, sizeof(h)) != sizeof(h)) return false;
+
+    if (h[0] == 0x1F && h[1] == 0x8B) {
+        // gzip (RFC 1952): optional extra field, name, comment and header CRC
+        if (h[2] != 8) return false;
+        uint8_t flags = h[3];
+        uint32_t pos = 10;
+        if (flags & 0x04) {
+            uint8_t xlen[2];
+            if (!file->seek(pos) || file->read(xlen, 2) != 2) return false;
+            pos += 2 + (xlen[0] | (xlen[1] << 8));
+        }
+        if ((flags & 0x08) && !skip_string(&pos)) return false;
+        if ((flags & 0x10) && !skip_string(&pos)) return false;
+        if (flags & 0x02) pos += 2;
+        data_offset = pos;
+
+        // ISIZE, the text length modulo 2^32, ends the file
+        uint8_t isize[4];
+        if (!file->seek(book_size - 4) || file->read(isize, 4) != 4) return false;
+        text_size = isize[0] | (isize[1] << 8) | (isize[2] << 16) | ((uint32_t)isize[3] << 24);
+        return data_offset < book_size;
+    }
+
+    // zlib (RFC 1950): deflate, no preset dictionary, header check
+    if ((h[0] & 0x0F) == 8 && (h[0] >> 4) <= 7 && ((h[0] << 8) | h[1]) % 31 == 0 && !(h[1] & 0x20)) {
+        data_offset = 2;
+        text_size = 0;
+        return true;
+    }
+    return false;
+}
+
+bool GzipSource::skip_string(uint32_t* pos) {
+    uint8_t buf[64];
+    while (*pos < book_size) {
+        if (!file->seek(*pos)) return false;
+        int got = file->read(buf, sizeof(buf));
+        if (got <= 0) return false;
+        for (int i = 0; i < got; i++) {
+            if (buf[i] == 0) {
+                *pos += i + 1;
+                return true;
+            }
+        }
+        *pos += got;
+    }
+    return false;
+}
+
+bool GzipSource::load_index(const char* path) {
+    File f = SD.open(path, "r+");
+    if (!f) return false;
+
+    IndexHeader h;
+    bool ok = f.read((uint8_t*)&h, sizeof(h)) == sizeof(h) && h.magic == INDEX_MAGIC &&
+              h.version == INDEX_VERSION && h.record_size == RECORD_SIZE &&
+              h.spacing == CHECKPOINT_SPACING && h.book_size == book_size && h.book_mtime == book_mtime &&
+              h.count <= (uint32_t)MAX_CHECKPOINTS && h.text_size != 0;
+    for (uint32_t i = 0; ok && i < h.count; i++) {
+        ok = f.seek(sizeof(h) + i * RECORD_SIZE) &&
+             f.read((uint8_t*)&checkpoints[i], sizeof(inflate_point_t)) == sizeof(inflate_point_t) &&
+             checkpoints[i].out < h.text_size && (i == 0 || checkpoints[i].out > checkpoints[i - 1].out);
+    }
+    if (!ok) {
+        f.close();
+        return false;
+    }
+    index_file = f;
+    text_size = h.text_size;
+    count = h.count;
+    dirty = false;
+    return true;
+}
+
+bool GzipSource::create_index(const char* path) {
+    count = 0;
+    File f = SD.open(path, FILE_WRITE);
+    if (!f) {
+        Serial.printf("Cannot write %s\n", path);
+        return false;
+    }
+    f.close();
+    // Opened for reading too: windows are read back when used
+    index_file = SD.open(path, "r+");
+    if (!index_file) return false;
+    dirty = true;
+    return save();
+}
+
+bool GzipSource::save() {
+    if (!index_file || !dirty) return true;
+    IndexHeader h;
+    memset(&h, 0, sizeof(h));
+    h.magic = INDEX_MAGIC;
+    h.version = INDEX_VERSION;
+    h.record_size = RECORD_SIZE;
+    h.spacing = CHECKPOINT_SPACING;
+    h.book_size = book_size;
+    h.book_mtime = book_mtime;
+    h.text_size = text_size;
+    h.count = count;
+    bool ok = index_file.seek(0) && index_file.write((const uint8_t*)&h, sizeof(h)) == sizeof(h);
+    index_file.flush();
+    if (ok) dirty = false;
+    return ok;
+}
+
+// Inflates the whole stream once to learn its length
+bool GzipSource::measure() {
+    inflate_t* stream = &streams[0];
+    unsigned long start = millis();
+    while (!stream->finished()) {
+        if (stream->read(nullptr, INFLATE_WINDOW_SIZE) < 0) return false;
+    }
+    text_size = stream->out_pos();
+    dirty = true;
+    Serial.printf("Inflated %lu bytes in %lu ms\n", (unsigned long)text_size, millis() - start);
+    return text_size > 0 && save();
+}
+
+// Last checkpoint at or before `pos`, -1 for the start of the stream
+int GzipSource::checkpoint_before(uint32_t pos) const {
+    int lo = 0;
+    int hi = count - 1;
+    int found = -1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        if (checkpoints[mid].out <= pos) {
+            found = mid;
+            lo = mid + 1;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    return found;
+}
+
+bool GzipSource::restore(inflate_t* stream, int checkpoint) {
+    restores++;
+    if (checkpoint < 0) {
+        stream->start(file, data_offset);
+        return true;
+    }
+    stream->resume(file, checkpoints[checkpoint]);
+    uint32_t at = sizeof(IndexHeader) + checkpoint * RECORD_SIZE + sizeof(inflate_point_t);
+    return index_file.seek(at) &&
+           index_file.read(stream->window(), INFLATE_WINDOW_SIZE) == INFLATE_WINDOW_SIZE;
+}
+
+// The stream to decode `pos` with: one already before it and past the
+// checkpoint nearest to it, else the least recently used one, moved to
+// that checkpoint
+inflate_t* GzipSource::stream_for(uint32_t pos) {
+    int checkpoint = checkpoint_before(pos);
+    uint32_t from = checkpoint >= 0 ? checkpoints[checkpoint].out : 0;
+
+    inflate_t* best = nullptr;
+    inflate_t* oldest = &streams[0];
+    for (int i = 0; i < STREAMS; i++) {
+        inflate_t* s = &streams[i];
+        if (!s->failed() && s->out_pos() <= pos && s->out_pos() >= from &&
+            (!best || s->out_pos() > best->out_pos())) {
+            best = s;
+        }
+        if (stream_used[i] < stream_used[oldest - streams]) oldest = s;
+    }
+    stream_used[(best ? best : oldest) - streams] = ++stamp;
+    if (best) return best;
+    return restore(oldest, checkpoint) ? oldest : nullptr;
+}
+
+int GzipSource::read(uint32_t offset, uint8_t* buf, int len) {
+    if (!opened) return -1;
+    if (offset >= text_size) return 0;
+    if ((uint32_t)len > text_size - offset) len = text_size - offset;
+
+    int n = 0;
+    while (n < len) {
+        uint32_t pos = offset + n;
+
+        // Still in a window: no decoding
+        bool copied = false;
+        for (int i = 0; i < STREAMS && !copied; i++) {
+            if (streams[i].window_byte(pos) < 0) continue;
+            uint32_t end = streams[i].out_pos();
+            while (n < len && pos < end) {
+                buf[n++] = streams[i].window()[pos % INFLATE_WINDOW_SIZE];
+                pos++;
+            }
+            copied = true;
+        }
+        if (copied) continue;
+
+        inflate_t* stream = stream_for(pos);
+        if (!stream) break;
+        while (stream->out_pos() < pos) {
+            uint32_t skip = pos - stream->out_pos();
+            if (stream->read(nullptr, skip < INFLATE_WINDOW_SIZE ? skip : INFLATE_WINDOW_SIZE) <= 0) break;
+        }
+        if (stream->out_pos() != pos) break;
+        int got = stream->read(buf + n, len - n);
+        if (got <= 0) break;
+        n += got;
+    }
+    return n > 0 ? n : -1;
+}
+
+void GzipSource::boundary_cb(void* ctx, inflate_t* stream) {
+    ((GzipSource*)ctx)->add_checkpoint(stream);
+}
+
+// Called at every block boundary; keeps one per CHECKPOINT_SPACING bytes
+// of text past the last checkpoint
+void GzipSource::add_checkpoint(inflate_t* stream) {
+    inflate_point_t at;
+    stream->point(&at);
+    uint32_t last = count > 0 ? checkpoints[count - 1].out : 0;
+    if (at.out < last + CHECKPOINT_SPACING || count >= MAX_CHECKPOINTS || !index_file) return;
+
+    uint32_t record = sizeof(IndexHeader) + count * RECORD_SIZE;
+    if (!index_file.seek(record) ||
+        index_file.write((const uint8_t*)&at, sizeof(at)) != sizeof(at) ||
+        index_file.write(stream->window(), INFLATE_WINDOW_SIZE) != INFLATE_WINDOW_SIZE) {
+        Serial.println("Cannot write a checkpoint");
+        return;
+    }
+    checkpoints[count++] = at;
+    dirty = true;
+}
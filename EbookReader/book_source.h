@@ -0,0 +1,119 @@
+#ifndef BOOK_SOURCE_H
+#define BOOK_SOURCE_H
+
+#include <stdint.h>
+#include <SD.h>
+#include "src/compress/inflate.h"
+
+// Where the text of the open book comes from. Offsets are into the text,
+// which for a compressed book is not what is stored on the card.
+class BookSource {
+public:
+    virtual ~BookSource() {}
+
+    virtual uint32_t size() const = 0;
+    // Up to `len` bytes of text at `offset`: the count, 0 at the end of the
+    // book, -1 on a read error
+    virtual int read(uint32_t offset, uint8_t* buf, int len) = 0;
+};
+
+// A plain text file, or the text part of one that starts `base` bytes in
+class FileSource : public BookSource {
+public:
+    FileSource() : file(nullptr), base(0), file_size(0) {}
+
+    void attach(File* f, uint32_t base = 0);
+    void detach() { attach(nullptr); }
+
+    uint32_t size() const override { return file_size; }
+    int read(uint32_t offset, uint8_t* buf, int len) override;
+
+private:
+    File* file;
+    uint32_t base;
+    uint32_t file_size;
+};
+
+// A gzip (.txt.gz) or zlib (.txt.zz) book, inflated as it is read.
+//
+// Reading from an offset needs the deflate stream decoded up to it, so the
+// source keeps checkpoints: every CHECKPOINT_SPACING bytes of text, at the
+// next deflate block boundary, the stream position and the 32 KB window
+// before it are written to the checkpoint file, and reading anywhere starts
+// from the nearest checkpoint before it instead of from the beginning.
+// Checkpoints are made as the book is first read through (the background
+// page indexer does this), only records are kept in memory, and a window is
+// read back from the card when its checkpoint is used.
+//
+// Two decoders run side by side, so the page on screen and the indexer,
+// reading in different parts of the book, do not restart each other; the
+// last 32 KB each decoded is read again without decoding.
+//
+// Only the first member of a multi-member gzip file is read, and the CRC is
+// not checked.
+class GzipSource : public BookSource {
+public:
+    static const uint32_t CHECKPOINT_SPACING = 128 * 1024;
+    static const int MAX_CHECKPOINTS = 1024;
+    static const int STREAMS = 2;
+
+    GzipSource();
+    ~GzipSource();
+
+    static bool is_compressed_name(const char* name);
+
+    // `index_path` is the checkpoint file; it is created if missing or stale
+    bool open(File* file, uint32_t mtime, const char* index_path);
+    void close();
+    bool is_open() const { return opened; }
+    // Writes the checkpoint count if checkpoints were added
+    bool save();
+
+    uint32_t size() const override { return text_size; }
+    int read(uint32_t offset, uint8_t* buf, int len) override;
+
+    int checkpoint_count() const { return count; }
+
+private:
+    struct IndexHeader {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t record_size;
+        uint32_t spacing;
+        uint32_t book_size;
+        uint32_t book_mtime;
+        uint32_t text_size;
+        uint32_t count;
+        uint32_t reserved;
+    };
+
+    File* file;
+    File index_file;
+    bool opened;
+    bool dirty;
+    uint32_t book_size;
+    uint32_t book_mtime;
+    uint32_t data_offset;           // Start of the deflate data
+    uint32_t text_size;
+
+    inflate_t streams[STREAMS];
+    uint32_t stream_used[STREAMS];
+    uint32_t stamp;
+
+    inflate_point_t* checkpoints;   // In text order
+    int count;
+    uint32_t restores;
+
+    bool parse_header();
+    bool skip_string(uint32_t* pos);
+    bool load_index(const char* path);
+    bool create_index(const char* path);
+    bool measure();
+    int checkpoint_before(uint32_t pos) const;
+    inflate_t* stream_for(uint32_t pos);
+    bool restore(inflate_t* stream, int checkpoint);
+    static void boundary_cb(void* ctx, inflate_t* stream);
+    void add_checkpoint(inflate_t* stream);
+};
+
+#endif
@@ -1,13 +1,18 @@
 #include "bottom_bar.h"
+#include "user_config.h"
 #include <Arduino.h>
 #include <stdio.h>
 
 BottomBar bottom_bar;
 
 BottomBar::BottomBar() : bar_container(nullptr), battery_label(nullptr), 
-                         app_info_label(nullptr), battery_percentage(100) {
+                         app_info_label(nullptr), battery_percentage(100),
+                         dirty(false), content_invalidated(false), committing(false),
+                         stale_timer(nullptr) {
     strcpy(battery_text, "100%");
     strcpy(app_info_text, "");
+    strcpy(battery_shown, battery_text);
+    strcpy(app_info_shown, app_info_text);
 }
 
 BottomBar::~BottomBar() {
@@ -33,13 +38,19 @@ void BottomBar::create() {
     battery_label = lv_label_create(bar_container);
     lv_obj_set_style_text_font(battery_label, &lv_font_montserrat_16, 0);
     lv_obj_align(battery_label, LV_ALIGN_LEFT_MID, 2, 0);
-    lv_label_set_text(battery_label, battery_text);
+    lv_label_set_text_static(battery_label, battery_shown);
     
     // App info label on the right
     app_info_label = lv_label_create(bar_container);
     lv_obj_set_style_text_font(app_info_label, &lv_font_montserrat_16, 0);
     lv_obj_align(app_info_label, LV_ALIGN_RIGHT_MID, -2, 0);
-    lv_label_set_text(app_info_label, app_info_text);
+    lv_label_set_text_static(app_info_label, app_info_shown);
+    
+    // Watch the rest of the screen for changes to ride along with
+    lv_display_add_event_cb(lv_display_get_default(), invalidate_event_cb, LV_EVENT_INVALIDATE_AREA, this);
+    
+    stale_timer = lv_timer_create(stale_timer_cb, BOTTOM_BAR_STALE_MS, this);
+    lv_timer_pause(stale_timer);
     
     Serial.println("Bottom bar created");
 }
@@ -47,26 +58,71 @@ void BottomBar::create() {
 void BottomBar::update_battery(int percentage) {
     if (percentage < 0) percentage = 0;
     if (percentage > 100) percentage = 100;
+    if (percentage == battery_percentage) return;
     
     battery_percentage = percentage;
     snprintf(battery_text, sizeof(battery_text), "%d%%", percentage);
+    mark_dirty();
+}
+
+void BottomBar::update_app_info(const char* info) {
+    if (!info) info = "";
+    if (strncmp(info, app_info_text, sizeof(app_info_text) - 1) == 0) return;
     
-    if (battery_label) {
-        lv_label_set_text(battery_label, battery_text);
+    strncpy(app_info_text, info, sizeof(app_info_text) - 1);
+    app_info_text[sizeof(app_info_text) - 1] = '\0';
+    mark_dirty();
+}
+
+void BottomBar::mark_dirty() {
+    if (dirty) return;
+    dirty = true;
+    
+    // The staleness deadline runs from the oldest uncommitted change
+    if (stale_timer) {
+        lv_timer_reset(stale_timer);
+        lv_timer_resume(stale_timer);
     }
 }
 
-void BottomBar::update_app_info(const char* info) {
-    if (info) {
-        strncpy(app_info_text, info, sizeof(app_info_text) - 1);
-        app_info_text[sizeof(app_info_text) - 1] = '\0';
-    } else {
-        app_info_text[0] = '\0';
+void BottomBar::commit_with_content() {
+    if (dirty && content_invalidated) {
+        commit();
     }
+    content_invalidated = false;
+}
+
+void BottomBar::commit() {
+    if (stale_timer) {
+        lv_timer_pause(stale_timer);
+    }
+    if (!dirty) return;
+    dirty = false;
+    
+    memcpy(battery_shown, battery_text, sizeof(battery_shown));
+    memcpy(app_info_shown, app_info_text, sizeof(app_info_shown));
     
+    committing = true;
+    if (battery_label) {
+        lv_label_set_text_static(battery_label, battery_shown);
+    }
     if (app_info_label) {
-        lv_label_set_text(app_info_label, app_info_text);
+        lv_label_set_text_static(app_info_label, app_info_shown);
     }
+    committing = false;
+}
+
+void BottomBar::invalidate_event_cb(lv_event_t* e) {
+    BottomBar* bar = (BottomBar*)lv_event_get_user_data(e);
+    if (!bar->committing) {
+        bar->content_invalidated = true;
+    }
+}
+
+void BottomBar::stale_timer_cb(lv_timer_t* timer) {
+    BottomBar* bar = (BottomBar*)lv_timer_get_user_data(timer);
+    // Nothing else changed for too long: refresh the bar on its own
+    bar->commit();
 }
 
 void BottomBar::show() {
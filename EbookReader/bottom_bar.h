@@ -13,6 +13,21 @@ private:
     char battery_text[16];
     char app_info_text[64];
     
+    // What the labels show (lv_label_set_text_static), updated on commit
+    char battery_shown[16];
+    char app_info_shown[64];
+    
+    // Deferred commit: staged texts reach the labels together with the
+    // next content change, or when the staleness timer fires
+    bool dirty;
+    bool content_invalidated;
+    bool committing;
+    lv_timer_t* stale_timer;
+    
+    void mark_dirty();
+    static void invalidate_event_cb(lv_event_t* e);
+    static void stale_timer_cb(lv_timer_t* timer);
+    
 public:
     BottomBar();
     ~BottomBar();
@@ -20,12 +35,19 @@ public:
     // Create the bottom bar UI
     void create();
     
-    // Update battery level (0-100)
+    // Update battery level (0-100), shown at the next commit
     void update_battery(int percentage);
     
-    // Update app-specific info
+    // Update app-specific info, shown at the next commit
     void update_app_info(const char* info);
     
+    // Commit staged texts if the screen content changed since the last call.
+    // Called on the LVGL task before each lv_timer_handler().
+    void commit_with_content();
+    
+    // Write staged texts to the labels now
+    void commit();
+    
     // Show/hide bottom bar
     void show();
     void hide();
@@ -0,0 +1,184 @@
+#include "button_input.h"
+#include "user_app.h"
+#include "user_config.h"
+#include <Arduino.h>
+
+ButtonInput button_input;
+
+ButtonInput::ButtonInput() : notify_task(nullptr), dropped_edges(0), indev(nullptr),
+                             indev_key(0), indev_key_down(false) {
+    static const int pins[BUTTON_COUNT] = { BOOT_BUTTON_PIN, PWR_BUTTON_PIN };
+    for (int i = 0; i < BUTTON_COUNT; i++) {
+        Button& b = buttons[i];
+        b.owner = this;
+        b.id = (ButtonId)i;
+        b.pin = pins[i];
+        b.state = BUTTON_IDLE;
+        b.long_fired = false;
+        b.press_us = 0;
+        b.change_us = 0;
+        b.raw_level = 1;
+        b.raw_us = 0;
+        b.settle_pending = false;
+    }
+}
+
+void ButtonInput::begin(TaskHandle_t task) {
+    notify_task = task;
+    uint32_t now = (uint32_t)esp_timer_get_time();
+
+    for (int i = 0; i < BUTTON_COUNT; i++) {
+        Button& b = buttons[i];
+        pinMode(b.pin, INPUT_PULLUP);
+        b.raw_level = digitalRead(b.pin);
+        b.raw_us = now;
+        b.change_us = now - DEBOUNCE_US;
+        attachInterruptArg(digitalPinToInterrupt(b.pin), gpio_isr, &b, CHANGE);
+    }
+}
+
+// Runs in interrupt context: timestamp, queue, wake the input task
+void IRAM_ATTR ButtonInput::gpio_isr(void* arg) {
+    Button* b = (Button*)arg;
+    ButtonInput* self = b->owner;
+
+    RawEdge edge;
+    edge.time_us = (uint32_t)esp_timer_get_time();
+    edge.button = (uint8_t)b->id;
+    edge.level = (uint8_t)gpio_get_level((gpio_num_t)b->pin);
+    if (!self->edges.push(edge)) {
+        self->dropped_edges++;
+    }
+
+    if (self->notify_task) {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(self->notify_task, &woken);
+        portYIELD_FROM_ISR(woken);
+    }
+}
+
+void ButtonInput::emit(const ButtonEvent& event, ButtonEventHandler handler) {
+    if (handler) handler(event);
+
+    if (indev && lvgl_keys.push(lvgl_key_for(event))) {
+        lvgl_port_wake();
+    }
+}
+
+// Button levels are active low
+void ButtonInput::apply_level(Button& b, uint8_t level, uint32_t time_us, ButtonEventHandler handler) {
+    bool down = (level == 0);
+
+    if (down && b.state == BUTTON_IDLE) {
+        b.state = BUTTON_HELD;
+        b.long_fired = false;
+        b.press_us = time_us;
+        b.change_us = time_us;
+    } else if (!down && b.state == BUTTON_HELD) {
+        b.state = BUTTON_IDLE;
+        b.change_us = time_us;
+        if (!b.long_fired && time_us - b.press_us >= DEBOUNCE_US) {
+            ButtonEvent event = { b.id, BUTTON_SHORT_PRESS, time_us };
+            emit(event, handler);
+        }
+    }
+}
+
+uint32_t ButtonInput::process(ButtonEventHandler handler) {
+    RawEdge edge;
+    while (edges.pop(edge)) {
+        Button& b = buttons[edge.button];
+        b.raw_level = edge.level;
+        b.raw_us = edge.time_us;
+
+        // The first edge acts immediately; bounces during the lockout are
+        // only remembered and the settled level is applied when it ends
+        if (edge.time_us - b.change_us < DEBOUNCE_US) {
+            b.settle_pending = true;
+        } else {
+            b.settle_pending = false;
+            apply_level(b, edge.level, edge.time_us, handler);
+        }
+    }
+
+    uint32_t now = (uint32_t)esp_timer_get_time();
+    uint32_t next_us = UINT32_MAX;
+
+    for (int i = 0; i < BUTTON_COUNT; i++) {
+        Button& b = buttons[i];
+
+        if (b.settle_pending) {
+            uint32_t elapsed = now - b.change_us;
+            if (elapsed >= DEBOUNCE_US) {
+                b.settle_pending = false;
+                apply_level(b, b.raw_level, b.raw_us, handler);
+            } else if (DEBOUNCE_US - elapsed < next_us) {
+                next_us = DEBOUNCE_US - elapsed;
+            }
+        }
+
+        if (b.state == BUTTON_HELD && !b.long_fired) {
+            uint32_t held = now - b.press_us;
+            if (held >= LONG_PRESS_US) {
+                b.long_fired = true;
+                ButtonEvent event = { b.id, BUTTON_LONG_PRESS, b.press_us + LONG_PRESS_US };
+                emit(event, handler);
+            } else if (LONG_PRESS_US - held < next_us) {
+                next_us = LONG_PRESS_US - held;
+            }
+        }
+    }
+
+    if (next_us == UINT32_MAX) return UINT32_MAX;
+    return (next_us + 999) / 1000;
+}
+
+// BOOT steps forward, PWR steps back; long presses confirm and cancel
+uint32_t ButtonInput::lvgl_key_for(const ButtonEvent& event) {
+    if (event.button == BUTTON_BOOT) {
+        return event.action == BUTTON_LONG_PRESS ? LV_KEY_ESC : LV_KEY_NEXT;
+    }
+    return event.action == BUTTON_LONG_PRESS ? LV_KEY_ENTER : LV_KEY_PREV;
+}
+
+void ButtonInput::create_indev() {
+    if (indev) return;
+
+    indev = lv_indev_create();
+    lv_indev_set_type(indev, LV_INDEV_TYPE_KEYPAD);
+    lv_indev_set_read_cb(indev, indev_read_cb);
+    // Read on demand from lvgl_read() rather than on a polling timer
+    lv_indev_set_mode(indev, LV_INDEV_MODE_EVENT);
+}
+
+void ButtonInput::lvgl_read() {
+    if (indev && (indev_key_down || !lvgl_keys.empty())) {
+        lv_indev_read(indev);
+    }
+}
+
+// Every queued key is reported as a press followed by a release
+void ButtonInput::indev_read_cb(lv_indev_t* indev, lv_indev_data_t* data) {
+    LV_UNUSED(indev);
+    ButtonInput& self = button_input;
+
+    if (self.indev_key_down) {
+        self.indev_key_down = false;
+        data->key = self.indev_key;
+        data->state = LV_INDEV_STATE_RELEASED;
+        data->continue_reading = !self.lvgl_keys.empty();
+        return;
+    }
+
+    uint32_t key;
+    if (self.lvgl_keys.pop(key)) {
+        self.indev_key = key;
+        self.indev_key_down = true;
+        data->key = key;
+        data->state = LV_INDEV_STATE_PRESSED;
+        data->continue_reading = true;
+    } else {
+        data->key = self.indev_key;
+        data->state = LV_INDEV_STATE_RELEASED;
+    }
+}
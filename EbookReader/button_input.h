@@ -0,0 +1,104 @@
+#ifndef BUTTON_INPUT_H
+#define BUTTON_INPUT_H
+
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "lvgl.h"
+#include "spsc_ring.h"
+
+enum ButtonId {
+    BUTTON_BOOT = 0,
+    BUTTON_PWR,
+    BUTTON_COUNT
+};
+
+enum ButtonAction {
+    BUTTON_SHORT_PRESS = 0,  // Reported on release
+    BUTTON_LONG_PRESS        // Reported once the hold time is reached
+};
+
+struct ButtonEvent {
+    ButtonId button;
+    ButtonAction action;
+    uint32_t time_us;  // Edge (or long-press threshold) time, esp_timer clock
+};
+
+typedef void (*ButtonEventHandler)(const ButtonEvent& event);
+
+// Interrupt-driven buttons.
+// The GPIO ISR timestamps every edge into a lock-free ring and notifies the
+// input task. process() runs the debounce/long-press state machine on the
+// input task and hands the resulting events to the apps; the same events are
+// queued for an LVGL keypad indev read on the LVGL task.
+class ButtonInput {
+private:
+    struct RawEdge {
+        uint32_t time_us;
+        uint8_t button;
+        uint8_t level;
+    };
+
+    enum ButtonState {
+        BUTTON_IDLE = 0,
+        BUTTON_HELD
+    };
+
+    struct Button {
+        ButtonInput* owner;
+        ButtonId id;
+        int pin;
+        ButtonState state;
+        bool long_fired;
+        uint32_t press_us;        // Accepted press edge
+        uint32_t change_us;       // Last accepted edge, starts the lockout
+        uint8_t raw_level;        // Latest level seen by the ISR
+        uint32_t raw_us;          // Time of that edge
+        bool settle_pending;      // Edges arrived during the lockout
+    };
+
+    // Edges closer than this to the last accepted one are contact bounce;
+    // presses shorter than this are glitches
+    static const uint32_t DEBOUNCE_US = 30000;
+    static const uint32_t LONG_PRESS_US = 800000;
+
+    SpscRing<RawEdge, 32> edges;       // ISR -> input task
+    SpscRing<uint32_t, 16> lvgl_keys;  // Input task -> LVGL task
+    Button buttons[BUTTON_COUNT];
+    TaskHandle_t notify_task;
+    volatile uint32_t dropped_edges;
+
+    lv_indev_t* indev;
+    uint32_t indev_key;
+    bool indev_key_down;
+
+    static void gpio_isr(void* arg);
+    static void indev_read_cb(lv_indev_t* indev, lv_indev_data_t* data);
+    static uint32_t lvgl_key_for(const ButtonEvent& event);
+
+    void apply_level(Button& b, uint8_t level, uint32_t time_us, ButtonEventHandler handler);
+    void emit(const ButtonEvent& event, ButtonEventHandler handler);
+
+public:
+    ButtonInput();
+
+    // Configures the pins and attaches the edge interrupts.
+    // Edges notify `task`, which should then call process().
+    void begin(TaskHandle_t task);
+
+    // Drains the edge ring and fires due long presses.
+    // Returns the time until the next deadline in ms, or UINT32_MAX if none.
+    uint32_t process(ButtonEventHandler handler);
+
+    // LVGL side: create the keypad indev, and read it when keys are queued.
+    // Both must run with the LVGL lock held.
+    void create_indev();
+    void lvgl_read();
+    lv_indev_t* get_indev() { return indev; }
+
+    uint32_t get_dropped_edges() const { return dropped_edges; }
+};
+
+extern ButtonInput button_input;
+
+#endif
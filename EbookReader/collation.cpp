@@ -0,0 +1,97 @@
+#include "collation.h"
+#include "pinyin_table.h"
+#include <string.h>
+
+static const uint8_t KEY_OTHER = 0x7C;
+
+// Decodes one UTF-8 character; a broken sequence yields its first byte
+static uint32_t next_codepoint(const uint8_t*& p, const uint8_t* end) {
+    uint8_t c = *p++;
+    int extra;
+    uint32_t cp;
+    if (c < 0x80) return c;
+    else if ((c & 0xE0) == 0xC0) { extra = 1; cp = c & 0x1F; }
+    else if ((c & 0xF0) == 0xE0) { extra = 2; cp = c & 0x0F; }
+    else if ((c & 0xF8) == 0xF0) { extra = 3; cp = c & 0x07; }
+    else return c;
+
+    if (end - p < extra) return c;
+    for (int i = 0; i < extra; i++) {
+        if ((p[i] & 0xC0) != 0x80) return c;
+        cp = (cp << 6) | (p[i] & 0x3F);
+    }
+    p += extra;
+    return cp;
+}
+
+static uint8_t pinyin_letter(uint16_t rank) {
+    int letter = 0;
+    while (letter < 25 && PINYIN_LETTER_START[letter + 1] <= rank) letter++;
+    return 'a' + letter;
+}
+
+static bool is_digit(uint32_t cp) {
+    return cp >= '0' && cp <= '9';
+}
+
+void collation_key(const char* name, uint8_t* key, size_t key_size) {
+    memset(key, 0, key_size);
+
+    const uint8_t* p = (const uint8_t*)name;
+    const uint8_t* end = p + strlen(name);
+    const char* dot = strrchr(name, '.');
+    if (dot && dot != name) end = (const uint8_t*)dot;
+
+    uint8_t token[12];
+    size_t pos = 0;
+    while (p < end) {
+        const uint8_t* start = p;
+        uint32_t cp = next_codepoint(p, end);
+        // Full-width forms of ASCII
+        if (cp >= 0xFF01 && cp <= 0xFF5E) cp -= 0xFEE0;
+
+        size_t len = 0;
+        if (is_digit(cp)) {
+            // The whole run, leading zeros dropped but keeping one digit
+            char digits[10];
+            int count = 0;
+            while (true) {
+                if (count > 0 || cp != '0') {
+                    if (count < 9) digits[count] = (char)cp;
+                    count++;
+                }
+                start = p;
+                if (p >= end) break;
+                cp = next_codepoint(p, end);
+                if (cp >= 0xFF01 && cp <= 0xFF5E) cp -= 0xFEE0;
+                if (!is_digit(cp)) {
+                    p = start;
+                    break;
+                }
+            }
+            if (count == 0) digits[count++] = '0';
+            if (count > 9) count = 9;
+            token[len++] = '0' + count;
+            memcpy(token + len, digits, count);
+            len += count;
+        } else if ((cp >= 'a' && cp <= 'z') || (cp >= 'A' && cp <= 'Z')) {
+            token[len++] = (uint8_t)(cp | 0x20);
+        } else if (cp < 0x80 || (cp >= 0x3000 && cp <= 0x303F) || (cp >= 0xFF00 && cp <= 0xFF65)) {
+            continue;   // Spaces and punctuation
+        } else if (cp >= PINYIN_FIRST && cp <= PINYIN_LAST && PINYIN_RANK[cp - PINYIN_FIRST]) {
+            uint16_t rank = PINYIN_RANK[cp - PINYIN_FIRST] | 0x8000;
+            token[len++] = pinyin_letter(rank & 0x7FFF);
+            token[len++] = rank >> 8;
+            token[len++] = rank & 0xFF;
+        } else {
+            if (cp > 0xFFFF) cp = 0xFFFF;
+            token[len++] = KEY_OTHER;
+            token[len++] = cp >> 8;
+            token[len++] = cp & 0xFF;
+        }
+
+        if (pos + len > key_size) break;
+        memcpy(key + pos, token, len);
+        pos += len;
+    }
+}
@@ -0,0 +1,21 @@
+#ifndef COLLATION_H
+#define COLLATION_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Sort key of a book name, compared with memcmp.
+// Built from the name without its extension, token by token:
+//   digit run   '0' + digit count (at most 9), then the digits without
+//               leading zeros, so "2" < "10"
+//   letter      lower case, so case is ignored
+//   ideograph   initial letter of its pinyin, then its rank in pinyin
+//               order | 0x8000, so it files under that letter after the
+//               Latin names
+//   other       0x7C and the code point, after letters and ideographs
+// Spaces and punctuation, ASCII or full width, are skipped; full-width
+// letters and digits count as ASCII. A token that does not fit is dropped
+// and the rest of the key is zero, so a prefix sorts first.
+void collation_key(const char* name, uint8_t* key, size_t key_size);
+
+#endif
@@ -0,0 +1,456 @@
+#include "epub_book.h"
+#include <Arduino.h>
+#include <new>
+#include <string.h>
+
+static const uint32_t CACHE_MAGIC = 0x31454245;   // "EBE1"
+static const uint16_t CACHE_VERSION = 1;
+static const int PATH_SIZE = 256;
+
+// Tags whose content is not text
+static const char* const SKIPPED_TAGS[] = {"head", "style", "script", "rt", "rp"};
+// Tags that start or end a line
+static const char* const BLOCK_TAGS[] = {
+    "p", "div", "br", "hr", "h1", "h2", "h3", "h4", "h5", "h6", "li", "dt", "dd", "tr",
+    "blockquote", "section", "article", "aside", "header", "footer", "figure", "figcaption",
+    "table", "ul", "ol", "pre"};
+
+static bool in_list(const char* name, const char* const* list, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        if (strcmp(name, list[i]) == 0) return true;
+    }
+    return false;
+}
+
+// Value of attribute `attr` in the tag text [tag, end), or nullptr
+static const char* find_attr(const char* tag, const char* end, const char* attr, size_t* len) {
+    size_t attr_len = strlen(attr);
+    for (const char* p = tag; p + attr_len < end; p++) {
+        if (memcmp(p, attr, attr_len) != 0 || (p > tag && p[-1] != ' ' && p[-1] != '\t' &&
+                                               p[-1] != '\n' && p[-1] != '\r' && p[-1] != ':')) {
+            continue;
+        }
+        const char* q = p + attr_len;
+        while (q < end && *q == ' ') q++;
+        if (q >= end || *q != '=') continue;
+        q++;
+        while (q < end && *q == ' ') q++;
+        if (q >= end || (*q != '"' && *q != '\'')) continue;
+        char quote = *q++;
+        const char* value_end = (const char*)memchr(q, quote, end - q);
+        if (!value_end) return nullptr;
+        *len = value_end - q;
+        return q;
+    }
+    return nullptr;
+}
+
+// Name of the tag at `tag` (just after '<'), without a namespace prefix
+static bool tag_is(const char* tag, const char* end, const char* name) {
+    const char* p = tag;
+    const char* colon = nullptr;
+    while (p < end && *p != ' ' && *p != '/' && *p != '\t' && *p != '\n' && *p != '\r') {
+        if (*p == ':') colon = p;
+        p++;
+    }
+    const char* start = colon ? colon + 1 : tag;
+    size_t len = strlen(name);
+    return (size_t)(p - start) == len && memcmp(start, name, len) == 0;
+}
+
+static int hex_value(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// `href`, relative to the folder `base`, as a path inside the archive:
+// percent escapes decoded, fragment dropped, "." and ".." resolved
+static bool resolve_path(const char* base, size_t base_len, const char* href, size_t href_len,
+                         char* out, size_t out_size) {
+    char joined[PATH_SIZE];
+    size_t n = 0;
+    if (base_len + 1 >= sizeof(joined)) return false;
+    if (base_len > 0) {
+        memcpy(joined, base, base_len);
+        n = base_len;
+        joined[n++] = '/';
+    }
+    for (size_t i = 0; i < href_len && href[i] != '#'; i++) {
+        char c = href[i];
+        if (c == '%' && i + 2 < href_len && hex_value(href[i + 1]) >= 0 && hex_value(href[i + 2]) >= 0) {
+            c = (char)(hex_value(href[i + 1]) * 16 + hex_value(href[i + 2]));
+            i += 2;
+        }
+        if (n + 1 >= sizeof(joined)) return false;
+        joined[n++] = c;
+    }
+    joined[n] = '\0';
+
+    // Segment by segment
+    size_t len = 0;
+    const char* p = joined;
+    while (*p) {
+        const char* slash = strchr(p, '/');
+        size_t seg = slash ? (size_t)(slash - p) : strlen(p);
+        if (seg == 0 || (seg == 1 && p[0] == '.')) {
+            // Skip
+        } else if (seg == 2 && p[0] == '.' && p[1] == '.') {
+            while (len > 0 && out[len - 1] != '/') len--;
+            if (len > 0) len--;
+        } else {
+            if (len + seg + 2 > out_size) return false;
+            if (len > 0) out[len++] = '/';
+            memcpy(out + len, p, seg);
+            len += seg;
+        }
+        p += seg;
+        if (*p == '/') p++;
+    }
+    out[len] = '\0';
+    return len > 0;
+}
+
+bool EpubBook::is_epub_name(const char* name) {
+    int len = strlen(name);
+    return len > 5 && strcasecmp(name + len - 5, ".epub") == 0;
+}
+
+EpubBook::EpubBook(File& f) : out(f), out_len(0), text_size(0), write_failed(false), state(X_TEXT),
+                              name_len(0), closing(false), in_name(false), self_closing(false),
+                              quote(0), skip_depth(0), dashes(0), line_started(false),
+                              space_pending(false) {
+    name[0] = '\0';
+}
+
+uint32_t EpubBook::open_text(File& epub, uint32_t mtime, const char* cache_path, File& text,
+                             AppArena& scratch) {
+    uint32_t epub_size = epub.size();
+    Header h;
+
+    // The cache, if it was made from this file
+    text = SD.open(cache_path, FILE_READ);
+    if (text) {
+        if (text.read((uint8_t*)&h, sizeof(h)) == sizeof(h) && h.magic == CACHE_MAGIC &&
+            h.version == CACHE_VERSION && h.header_size == HEADER_SIZE && h.epub_size == epub_size &&
+            h.epub_mtime == mtime && h.text_size > 0 && text.size() == HEADER_SIZE + h.text_size) {
+            return h.text_size;
+        }
+        text.close();
+    }
+
+    unsigned long start = millis();
+    File f = SD.open(cache_path, FILE_WRITE);
+    if (!f) {
+        Serial.printf("Cannot write %s\n", cache_path);
+        return 0;
+    }
+    memset(&h, 0, sizeof(h));
+    h.magic = CACHE_MAGIC;
+    h.version = CACHE_VERSION;
+    h.header_size = HEADER_SIZE;
+    h.epub_size = epub_size;
+    h.epub_mtime = mtime;
+    bool ok = f.write((const uint8_t*)&h, sizeof(h)) == sizeof(h);
+
+    // The converter's buffers are scratch too
+    AppArena::Mark mark = scratch.mark();
+    ZipArchive zip;
+    void* mem = scratch.alloc(sizeof(EpubBook));
+    ok = ok && mem && zip.open(&epub, scratch);
+    if (ok) {
+        EpubBook* book = new (mem) EpubBook(f);
+        ok = book->extract(zip, scratch, &h.chapters);
+        h.text_size = book->text_size;
+        book->~EpubBook();
+    }
+    zip.close();
+    scratch.release(mark);
+
+    ok = ok && h.text_size > 0 && f.seek(0) && f.write((const uint8_t*)&h, sizeof(h)) == sizeof(h);
+    f.close();
+    if (!ok) {
+        Serial.println("Cannot extract the EPUB text");
+        SD.remove(cache_path);
+        return 0;
+    }
+    Serial.printf("EPUB: %lu chapters, %lu bytes of text in %lu ms\n", (unsigned long)h.chapters,
+                  (unsigned long)h.text_size, millis() - start);
+
+    text = SD.open(cache_path, FILE_READ);
+    return text ? h.text_size : 0;
+}
+
+// A small member, whole and NUL-terminated, in `scratch`
+char* EpubBook::read_entry(ZipArchive& zip, const char* path, AppArena& scratch) {
+    ZipEntry entry;
+    if (!zip.find(path, entry) || !zip.begin_entry(entry)) {
+        Serial.printf("EPUB has no %s\n", path);
+        return nullptr;
+    }
+    char* data = (char*)scratch.alloc(entry.size + 1, 1);
+    if (!data) {
+        Serial.printf("%s: %lu bytes do not fit\n", path, (unsigned long)entry.size);
+        return nullptr;
+    }
+    uint32_t n = 0;
+    while (n < entry.size) {
+        int got = zip.read((uint8_t*)data + n, entry.size - n);
+        if (got <= 0) return nullptr;
+        n += got;
+    }
+    data[n] = '\0';
+    return data;
+}
+
+bool EpubBook::extract(ZipArchive& zip, AppArena& scratch, uint32_t* chapters) {
+    // container.xml names the package file
+    char* container = read_entry(zip, "META-INF/container.xml", scratch);
+    if (!container) return false;
+    const char* full_path = nullptr;
+    size_t len = 0;
+    for (const char* tag = strchr(container, '<'); tag && !full_path; tag = strchr(tag + 1, '<')) {
+        const char* end = strchr(tag, '>');
+        if (!end) break;
+        if (tag_is(tag + 1, end, "rootfile")) full_path = find_attr(tag, end, "full-path", &len);
+    }
+    char opf_path[PATH_SIZE];
+    if (!full_path || !resolve_path("", 0, full_path, len, opf_path, sizeof(opf_path))) {
+        Serial.println("EPUB has no package file");
+        return false;
+    }
+    char* opf = read_entry(zip, opf_path, scratch);
+    if (!opf) return false;
+    const char* slash = strrchr(opf_path, '/');
+    size_t base_len = slash ? slash - opf_path : 0;
+
+    // The spine, in reading order; each itemref names a manifest item
+    *chapters = 0;
+    for (const char* tag = strchr(opf, '<'); tag; tag = strchr(tag + 1, '<')) {
+        const char* end = strchr(tag, '>');
+        if (!end) break;
+        if (!tag_is(tag + 1, end, "itemref")) continue;
+
+        size_t idref_len = 0;
+        const char* idref = find_attr(tag, end, "idref", &idref_len);
+        size_t linear_len = 0;
+        const char* linear = find_attr(tag, end, "linear", &linear_len);
+        if (!idref || (linear && linear_len == 2 && memcmp(linear, "no", 2) == 0)) continue;
+
+        const char* href = nullptr;
+        size_t href_len = 0;
+        for (const char* item = strchr(opf, '<'); item && !href; item = strchr(item + 1, '<')) {
+            const char* item_end = strchr(item, '>');
+            if (!item_end) break;
+            if (!tag_is(item + 1, item_end, "item")) continue;
+            size_t id_len = 0;
+            const char* id = find_attr(item, item_end, "id", &id_len);
+            if (id && id_len == idref_len && memcmp(id, idref, id_len) == 0) {
+                href = find_attr(item, item_end, "href", &href_len);
+            }
+        }
+
+        char path[PATH_SIZE];
+        ZipEntry entry;
+        if (!href || !resolve_path(opf_path, base_len, href, href_len, path, sizeof(path)) ||
+            !zip.find(path, entry)) {
+            Serial.printf("EPUB chapter %.*s is missing\n", (int)idref_len, idref);
+            continue;
+        }
+        if (!convert(zip, entry)) return false;
+        (*chapters)++;
+    }
+    flush();
+    return *chapters > 0 && !write_failed;
+}
+
+// One chapter, streamed through the XHTML to text conversion
+bool EpubBook::convert(ZipArchive& zip, const ZipEntry& entry) {
+    if (!zip.begin_entry(entry)) return false;
+    state = X_TEXT;
+    skip_depth = 0;
+    space_pending = false;
+
+    // A blank line between chapters
+    if (text_size > 0) {
+        end_line();
+        put('\n');
+    }
+    uint8_t buf[512];
+    int got;
+    bool first = true;
+    while ((got = zip.read(buf, sizeof(buf))) > 0) {
+        // Past a byte order mark
+        int i = first && got >= 3 && buf[0] == 0xEF && buf[1] == 0xBB && buf[2] == 0xBF ? 3 : 0;
+        first = false;
+        for (; i < got; i++) feed(buf[i]);
+    }
+    end_line();
+    return got == 0 && !write_failed;
+}
+
+void EpubBook::feed(uint8_t c) {
+    switch (state) {
+        case X_TEXT:
+            if (c == '<') {
+                state = X_TAG;
+                name_len = 0;
+                closing = false;
+                in_name = true;
+                self_closing = false;
+                quote = 0;
+            } else if (c == '&') {
+                state = X_ENTITY;
+                name_len = 0;
+            } else {
+                text_char(c);
+            }
+            break;
+
+        case X_TAG:
+            if (quote) {
+                if (c == quote) quote = 0;
+            } else if (c == '>') {
+                end_tag_name();
+                state = X_TEXT;
+            } else if (in_name) {
+                if (name_len == 0 && c == '/') {
+                    closing = true;
+                } else if (c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '/') {
+                    in_name = false;
+                    self_closing = c == '/';
+                } else if (name_len < NAME_SIZE - 1) {
+                    name[name_len++] = (c >= 'A' && c <= 'Z') ? c + 32 : c;
+                    if (name_len == 3 && memcmp(name, "!--", 3) == 0) {
+                        state = X_COMMENT;
+                        dashes = 0;
+                    }
+                }
+            } else if (c == '"' || c == '\'') {
+                quote = c;
+                self_closing = false;
+            } else if (c != ' ' && c != '\t' && c != '\r' && c != '\n') {
+                self_closing = c == '/';
+            }
+            break;
+
+        case X_COMMENT:
+            if (c == '>' && dashes >= 2) {
+                state = X_TEXT;
+            } else {
+                dashes = c == '-' ? dashes + 1 : 0;
+            }
+            break;
+
+        case X_ENTITY:
+            if (c == ';') {
+                entity();
+                state = X_TEXT;
+            } else if (name_len < NAME_SIZE - 1 && ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+                                                    (c >= '0' && c <= '9') || c == '#')) {
+                name[name_len++] = c;
+            } else {
+                // Not an entity: a bare '&' and what followed it
+                state = X_TEXT;
+                text_char('&');
+                for (int i = 0; i < name_len; i++) text_char(name[i]);
+                feed(c);
+            }
+            break;
+    }
+}
+
+void EpubBook::end_tag_name() {
+    name[name_len] = '\0';
+    // Without a namespace prefix
+    const char* colon = strchr(name, ':');
+    const char* tag = colon ? colon + 1 : name;
+
+    if (in_list(tag, SKIPPED_TAGS, sizeof(SKIPPED_TAGS) / sizeof(SKIPPED_TAGS[0]))) {
+        if (closing) {
+            if (skip_depth > 0) skip_depth--;
+        } else if (!self_closing) {
+            skip_depth++;
+        }
+    } else if (in_list(tag, BLOCK_TAGS, sizeof(BLOCK_TAGS) / sizeof(BLOCK_TAGS[0]))) {
+        end_line();
+    }
+}
+
+void EpubBook::entity() {
+    name[name_len] = '\0';
+    uint32_t cp = 0;
+    if (name[0] == '#') {
+        bool hex = name[1] == 'x' || name[1] == 'X';
+        for (const char* p = name + (hex ? 2 : 1); *p; p++) {
+            int digit = hex ? hex_value(*p) : (*p >= '0' && *p <= '9' ? *p - '0' : -1);
+            if (digit < 0 || cp > 0x10FFFF) return;
+            cp = cp * (hex ? 16 : 10) + digit;
+        }
+    } else if (strcmp(name, "amp") == 0) {
+        cp = '&';
+    } else if (strcmp(name, "lt") == 0) {
+        cp = '<';
+    } else if (strcmp(name, "gt") == 0) {
+        cp = '>';
+    } else if (strcmp(name, "quot") == 0) {
+        cp = '"';
+    } else if (strcmp(name, "apos") == 0) {
+        cp = '\'';
+    } else if (strcmp(name, "nbsp") == 0) {
+        cp = ' ';
+    }
+    if (cp == 0 || cp > 0x10FFFF) return;
+    put_utf8(cp);
+}
+
+// Runs of white space become one space, none at the start or end of a line
+void EpubBook::text_char(uint8_t c) {
+    if (skip_depth > 0) return;
+    if (c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+        if (line_started) space_pending = true;
+        return;
+    }
+    if (space_pending) {
+        put(' ');
+        space_pending = false;
+    }
+    put(c);
+    line_started = true;
+}
+
+void EpubBook::put_utf8(uint32_t cp) {
+    if (cp < 0x80) {
+        text_char((uint8_t)cp);
+    } else if (cp < 0x800) {
+        text_char(0xC0 | (cp >> 6));
+        text_char(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+        text_char(0xE0 | (cp >> 12));
+        text_char(0x80 | ((cp >> 6) & 0x3F));
+        text_char(0x80 | (cp & 0x3F));
+    } else {
+        text_char(0xF0 | (cp >> 18));
+        text_char(0x80 | ((cp >> 12) & 0x3F));
+        text_char(0x80 | ((cp >> 6) & 0x3F));
+        text_char(0x80 | (cp & 0x3F));
+    }
+}
+
+void EpubBook::end_line() {
+    if (line_started) put('\n');
+    line_started = false;
+    space_pending = false;
+}
+
+void EpubBook::put(uint8_t c) {
+    out_buf[out_len++] = c;
+    text_size++;
+    if (out_len == OUT_SIZE) flush();
+}
+
+void EpubBook::flush() {
+    if (out_len > 0 && out.write(out_buf, out_len) != (size_t)out_len) write_failed = true;
+    out_len = 0;
+}
@@ -0,0 +1,87 @@
+#ifndef EPUB_BOOK_H
+#define EPUB_BOOK_H
+
+#include <stdint.h>
+#include <SD.h>
+#include "app_arena.h"
+#include "zip_archive.h"
+
+// Plain text of an EPUB, extracted once and cached on the card.
+//
+// The first time a book is opened, its ZIP directory is read, then
+// META-INF/container.xml for the package file and the package file's
+// manifest and spine for the chapters in reading order. Each chapter is
+// inflated and converted as it streams past: markup is dropped, every
+// paragraph, heading, list item or line break becomes one line, white space
+// collapses and entities are decoded. Head, style, script and ruby
+// annotations are left out. Only the inflate window and a small output
+// buffer are in memory; the package file and ZIP directory sit in the app
+// arena until the text is written.
+//
+// The cache is a header followed by the text, and is rebuilt when the
+// EPUB's size or date changes. From then on the book reads like a .txt.
+class EpubBook {
+public:
+    static const uint32_t HEADER_SIZE = 32;
+
+    static bool is_epub_name(const char* name);
+
+    // Opens the text of `epub` into `text`, where it starts at HEADER_SIZE,
+    // and returns its length; 0 when the EPUB cannot be read. `scratch` holds the
+    // directory and package file while extracting and is released after.
+    static uint32_t open_text(File& epub, uint32_t mtime, const char* cache_path, File& text,
+                              AppArena& scratch);
+
+private:
+    struct Header {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t header_size;
+        uint32_t epub_size;
+        uint32_t epub_mtime;
+        uint32_t text_size;
+        uint32_t chapters;
+        uint32_t reserved[2];
+    };
+
+    // Chapter text being written
+    static const int OUT_SIZE = 2048;
+    static const int NAME_SIZE = 24;
+
+    File& out;
+    uint8_t out_buf[OUT_SIZE];
+    int out_len;
+    uint32_t text_size;
+    bool write_failed;
+
+    // XHTML to text state
+    enum { X_TEXT, X_TAG, X_ENTITY, X_COMMENT };
+    int state;
+    char name[NAME_SIZE];          // Tag or entity being read
+    int name_len;
+    bool closing;                  // "</"
+    bool in_name;
+    bool self_closing;             // "/>"
+    char quote;                    // Inside a quoted attribute value
+    int skip_depth;                // Inside head, style, script, rt or rp
+    int dashes;                    // '-' just before a '>' in a comment
+    bool line_started;             // Something written on this line
+    bool space_pending;
+
+    EpubBook(File& out);
+
+    bool extract(ZipArchive& zip, AppArena& scratch, uint32_t* chapters);
+    static char* read_entry(ZipArchive& zip, const char* path, AppArena& scratch);
+    bool convert(ZipArchive& zip, const ZipEntry& entry);
+
+    void feed(uint8_t c);
+    void end_tag_name();
+    void entity();
+    void text_char(uint8_t c);
+    void put_utf8(uint32_t cp);
+    void end_line();
+    void put(uint8_t c);
+    void flush();
+};
+
+#endif
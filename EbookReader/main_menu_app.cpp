@@ -3,38 +3,40 @@
 #include "bottom_bar.h"
 #include "user_config.h"
 #include "src/power/board_power_bsp.h"
+#include "src/display/epd_trace.h"
+#include "src/font/glyph_cache.h"
 #include <Arduino.h>
 
-// External font
-LV_FONT_DECLARE(my_font_chinese_16);
-
 // External power manager
 extern board_power_bsp_t board_power_bsp;
 
-MainMenuApp::MainMenuApp() : menu_container(nullptr), menu_items_labels(nullptr),
-                             menu_items_names(nullptr), total_menu_items(0), 
-                             selected_index(0), last_key_time(0) {
+MainMenuApp::MainMenuApp() : menu_container(nullptr), total_menu_items(0), 
+                             selected_index(0) {
+    memset(menu_items_names, 0, sizeof(menu_items_names));
 }
 
 MainMenuApp::~MainMenuApp() {
-    if (menu_items_labels) {
-        delete[] menu_items_labels;
-        menu_items_labels = nullptr;
-    }
-    if (menu_items_names) {
-        delete[] menu_items_names;
-        menu_items_names = nullptr;
-    }
 }
 
 void MainMenuApp::init() {
     Serial.println("Main menu app init");
     
+    selected_index = 0;
+    create_ui();
+    
+    update_menu_display();
+    lv_obj_clear_flag(menu_container, LV_OBJ_FLAG_HIDDEN);
+    bottom_bar.update_app_info("Menu");
+}
+
+void MainMenuApp::create_ui() {
+    if (menu_container) return;
+    
     // Get app count (excluding main menu itself which is at index 0)
     int app_count = app_manager.get_app_count() - 1;
+    if (app_count > MAX_MENU_ITEMS - 1) app_count = MAX_MENU_ITEMS - 1;
     // Total menu items = apps + 1 shutdown option
     total_menu_items = app_count + 1;
-    selected_index = 0;
     
     // Create container for menu (leave space for bottom bar)
     menu_container = lv_obj_create(lv_scr_act());
@@ -46,85 +48,52 @@ void MainMenuApp::init() {
     
     // Create title
     lv_obj_t* title = lv_label_create(menu_container);
-    lv_obj_set_style_text_font(title, &my_font_chinese_16, 0);
-    lv_label_set_text(title, "选择应用");
+    lv_obj_set_style_text_font(title, glyph_cache.font(), 0);
+    lv_label_set_text_static(title, "选择应用");
     lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 5);
     
-    // Create menu items labels (apps + shutdown)
-    if (total_menu_items > 0) {
-        menu_items_labels = new lv_obj_t*[total_menu_items];
-        menu_items_names = new const char*[total_menu_items];
-        
-        // Add app items
-        for (int i = 0; i < app_count; i++) {
-            menu_items_labels[i] = lv_label_create(menu_container);
-            lv_obj_set_style_text_font(menu_items_labels[i], &my_font_chinese_16, 0);
-            
+    // Add app items, then the shutdown option as the last item
+    for (int i = 0; i < total_menu_items; i++) {
+        if (i < app_count) {
             // Get app name (index + 1 because main menu is at 0)
             BaseApp* app = app_manager.get_app(i + 1);
-            if (app) {
-                menu_items_names[i] = app->get_app_name();
-                lv_label_set_text(menu_items_labels[i], menu_items_names[i]);
-            } else {
-                // Initialize to empty string if app is null
-                menu_items_names[i] = "";
-                lv_label_set_text(menu_items_labels[i], "");
-            }
-            
-            lv_obj_align(menu_items_labels[i], LV_ALIGN_TOP_LEFT, 10, 35 + i * 25);
+            menu_items_names[i] = app ? app->get_app_name() : "";
+        } else {
+            menu_items_names[i] = "关机";
         }
-        
-        // Add shutdown option as the last item
-        menu_items_labels[app_count] = lv_label_create(menu_container);
-        lv_obj_set_style_text_font(menu_items_labels[app_count], &my_font_chinese_16, 0);
-        menu_items_names[app_count] = "关机";
-        lv_label_set_text(menu_items_labels[app_count], menu_items_names[app_count]);
-        lv_obj_align(menu_items_labels[app_count], LV_ALIGN_TOP_LEFT, 10, 35 + app_count * 25);
     }
     
-    update_menu_display();
-    bottom_bar.update_app_info("Menu");
+    // Pages by screenfuls once there are more items than rows
+    menu_list.create(menu_container, VISIBLE_ROWS, 35, 25, glyph_cache.font());
+    menu_list.set_source(item_text, this, total_menu_items);
+}
+
+void MainMenuApp::item_text(void* ctx, int index, char* buf, size_t len) {
+    MainMenuApp* self = (MainMenuApp*)ctx;
+    snprintf(buf, len, "%s", self->menu_items_names[index]);
 }
 
 void MainMenuApp::deinit() {
     Serial.println("Main menu app deinit");
     
-    // Delete container which also deletes child LVGL objects
-    // (including all items in menu_items_labels array)
+    // Keep the widgets for the next visit
     if (menu_container) {
-        lv_obj_del(menu_container);
-        menu_container = nullptr;
-    }
-    
-    // Delete the arrays (the LVGL objects were already freed above)
-    if (menu_items_labels) {
-        delete[] menu_items_labels;
-        menu_items_labels = nullptr;
-    }
-    
-    if (menu_items_names) {
-        delete[] menu_items_names;
-        menu_items_names = nullptr;
+        lv_obj_add_flag(menu_container, LV_OBJ_FLAG_HIDDEN);
     }
 }
 
+void MainMenuApp::suspend() {
+    lv_obj_add_flag(menu_container, LV_OBJ_FLAG_HIDDEN);
+}
+
+// The cursor stays on the app that was opened last
+void MainMenuApp::resume() {
+    lv_obj_clear_flag(menu_container, LV_OBJ_FLAG_HIDDEN);
+    bottom_bar.update_app_info("Menu");
+}
+
 void MainMenuApp::update_menu_display() {
-    // Add cursor indicator for selected item
-    // No background highlighting for e-ink display
-    for (int i = 0; i < total_menu_items; i++) {
-        if (menu_items_labels[i] && menu_items_names[i]) {
-            if (i == selected_index) {
-                // Selected item: add cursor prefix "▶ "
-                // Use larger buffer to accommodate multi-byte UTF-8 characters
-                char text_with_cursor[128];
-                snprintf(text_with_cursor, sizeof(text_with_cursor), "▶ %s", menu_items_names[i]);
-                lv_label_set_text(menu_items_labels[i], text_with_cursor);
-            } else {
-                // Unselected item: show name without cursor
-                lv_label_set_text(menu_items_labels[i], menu_items_names[i]);
-            }
-        }
-    }
+    menu_list.set_selected(selected_index);
 }
 
 void MainMenuApp::select_menu_item() {
@@ -135,14 +104,11 @@ void MainMenuApp::select_menu_item() {
         Serial.println("Shutting down system...");
         
         // Clear screen and display "GuGu"
-        if (menu_container) {
-            lv_obj_del(menu_container);
-            menu_container = nullptr;
-        }
+        lv_obj_add_flag(menu_container, LV_OBJ_FLAG_HIDDEN);
         
         // Create a simple label with "GuGu"
         lv_obj_t* shutdown_label = lv_label_create(lv_scr_act());
-        lv_obj_set_style_text_font(shutdown_label, &my_font_chinese_16, 0);
+        lv_obj_set_style_text_font(shutdown_label, glyph_cache.font(), 0);
         lv_label_set_text(shutdown_label, "GuGu");
         lv_obj_align(shutdown_label, LV_ALIGN_CENTER, 0, 0);
         
@@ -159,12 +125,10 @@ void MainMenuApp::select_menu_item() {
     }
 }
 
-void MainMenuApp::loop() {
-    if (millis() - last_key_time < 300) return; // Debounce
-    
+void MainMenuApp::on_button(const ButtonEvent& event) {
     // Navigate down (BOOT button)
-    if (digitalRead(BOOT_BUTTON_PIN) == LOW) {
-        last_key_time = millis();
+    if (event.button == BUTTON_BOOT && event.action == BUTTON_SHORT_PRESS) {
+        EPD_TRACE_MARK("main_nav");
         
         selected_index++;
         if (selected_index >= total_menu_items) {
@@ -175,11 +139,10 @@ void MainMenuApp::loop() {
         Serial.printf("Selected: %d\n", selected_index);
     }
     
-    // Select menu item (PWR button)
-    if (digitalRead(PWR_BUTTON_PIN) == LOW) {
-        last_key_time = millis();
-        
+    // Select menu item (PWR button, short or long)
+    if (event.button == BUTTON_PWR) {
         if (total_menu_items > 0) {
+            EPD_TRACE_MARK("main_select");
             Serial.printf("Selecting menu item: %d\n", selected_index);
             select_menu_item();
         }
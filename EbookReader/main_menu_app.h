@@ -3,17 +3,23 @@
 
 #include "app_manager.h"
 #include "lvgl.h"
+#include "virtual_list.h"
 
 class MainMenuApp : public BaseApp {
 private:
+    // Registered apps plus the shutdown entry
+    static const int MAX_MENU_ITEMS = 8;
+    static const int VISIBLE_ROWS = 5;
+    
+    // Built on the first init() and hidden on deinit()
     lv_obj_t* menu_container;
-    lv_obj_t** menu_items_labels;
-    const char** menu_items_names;  // Store original menu item names
+    VirtualList menu_list;
+    const char* menu_items_names[MAX_MENU_ITEMS];  // Store original menu item names
     int total_menu_items;
     int selected_index;
     
-    unsigned long last_key_time;
-    
+    void create_ui();
+    static void item_text(void* ctx, int index, char* buf, size_t len);
     void update_menu_display();
     void select_menu_item();
     
@@ -23,7 +29,10 @@ public:
     
     void init() override;
     void deinit() override;
-    void loop() override;
+    bool supports_suspend() override { return true; }
+    void suspend() override;
+    void resume() override;
+    void on_button(const ButtonEvent& event) override;
     const char* get_app_info() override;
     const char* get_app_name() override;
 };
@@ -0,0 +1,173 @@
+#include "page_index.h"
+#include "esp_heap_caps.h"
+#include <Arduino.h>
+#include <SD.h>
+#include <string.h>
+
+static const uint32_t INDEX_MAGIC = 0x31504245;   // "EBP1"
+static const uint16_t INDEX_VERSION = 1;
+// Pages are rarely shorter than this; a book that has more stops indexing
+// and numbers the rest by estimate
+static const uint32_t MIN_PAGE_BYTES = 48;
+static const int MAX_PAGES = 256 * 1024;
+// Page length assumed before any page has been laid out
+static const uint32_t DEFAULT_PAGE_BYTES = 350;
+
+PageIndex::PageIndex() : offsets(nullptr), capacity(0), page_count(0), is_complete(false),
+                         dirty(false), layout_signature(0), size(0), mtime(0), anchor_offset(0) {
+}
+
+PageIndex::~PageIndex() {
+    end();
+}
+
+bool PageIndex::begin(uint32_t book_size) {
+    end();
+    uint32_t pages = book_size / MIN_PAGE_BYTES + 64;
+    capacity = pages > (uint32_t)MAX_PAGES ? MAX_PAGES : (int)pages;
+    offsets = (uint32_t*)heap_caps_malloc(capacity * sizeof(uint32_t), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!offsets) {
+        Serial.printf("No memory for a page index of %d pages\n", capacity);
+        capacity = 0;
+        return false;
+    }
+    reset(0, book_size, 0, 0, 0);
+    return true;
+}
+
+void PageIndex::end() {
+    heap_caps_free(offsets);
+    offsets = nullptr;
+    capacity = 0;
+    page_count = 0;
+    is_complete = false;
+    dirty = false;
+}
+
+void PageIndex::reset(uint32_t signature, uint32_t book_size, uint32_t book_mtime, uint32_t first,
+                      uint32_t anchor) {
+    layout_signature = signature;
+    size = book_size;
+    mtime = book_mtime;
+    anchor_offset = anchor;
+    page_count = 0;
+    is_complete = false;
+    dirty = true;
+    if (!offsets) return;
+    offsets[0] = first;
+    page_count = 1;
+    is_complete = first >= size;
+}
+
+bool PageIndex::load(const char* path, uint32_t signature, uint32_t book_size, uint32_t book_mtime) {
+    if (!offsets) return false;
+    File f = SD.open(path, FILE_READ);
+    if (!f) return false;
+
+    Header h;
+    bool ok = f.read((uint8_t*)&h, sizeof(h)) == sizeof(h) && h.magic == INDEX_MAGIC &&
+              h.version == INDEX_VERSION && h.signature == signature && h.book_size == book_size &&
+              h.book_mtime == book_mtime && h.count >= 1 && h.count <= (uint32_t)capacity;
+    if (ok) {
+        size_t bytes = h.count * sizeof(uint32_t);
+        ok = f.read((uint8_t*)offsets, bytes) == bytes;
+    }
+    f.close();
+    if (!ok) return false;
+
+    layout_signature = signature;
+    size = book_size;
+    mtime = book_mtime;
+    anchor_offset = h.anchor;
+    page_count = h.count;
+    is_complete = h.complete != 0;
+    dirty = false;
+    Serial.printf("Page index: %d pages%s\n", page_count, is_complete ? "" : " so far");
+    return true;
+}
+
+bool PageIndex::save(const char* path) {
+    if (!offsets || !dirty) return true;
+
+    File f = SD.open(path, FILE_WRITE);
+    if (!f) {
+        Serial.printf("Cannot write %s\n", path);
+        return false;
+    }
+    Header h;
+    h.magic = INDEX_MAGIC;
+    h.version = INDEX_VERSION;
+    h.complete = is_complete ? 1 : 0;
+    h.signature = layout_signature;
+    h.book_size = size;
+    h.book_mtime = mtime;
+    h.anchor = anchor_offset;
+    h.count = page_count;
+    size_t bytes = page_count * sizeof(uint32_t);
+    bool ok = f.write((const uint8_t*)&h, sizeof(h)) == sizeof(h) &&
+              f.write((const uint8_t*)offsets, bytes) == bytes;
+    f.close();
+    if (ok) dirty = false;
+    return ok;
+}
+
+bool PageIndex::add(uint32_t next) {
+    if (!offsets || is_complete || next <= frontier()) return false;
+    if (next >= size) {
+        is_complete = true;
+    } else if (page_count < capacity) {
+        offsets[page_count++] = next;
+    } else {
+        return false;
+    }
+    dirty = true;
+    return true;
+}
+
+bool PageIndex::set_anchor(uint32_t offset) {
+    if (!offsets || is_complete || offset < frontier()) return false;
+    anchor_offset = offset;
+    dirty = true;
+    return true;
+}
+
+int PageIndex::find(uint32_t offset) const {
+    int page = page_of(offset);
+    return page >= 0 && offsets[page] == offset ? page : -1;
+}
+
+int PageIndex::page_of(uint32_t offset) const {
+    if (!offsets || offset < offsets[0]) return offsets ? 0 : -1;
+    if (offset > frontier()) return is_complete ? page_count - 1 : -1;
+    // Last page starting at or before `offset`
+    int lo = 0;
+    int hi = page_count - 1;
+    while (lo < hi) {
+        int mid = (lo + hi + 1) / 2;
+        if (offsets[mid] <= offset) {
+            lo = mid;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    return lo;
+}
+
+uint32_t PageIndex::page_bytes() const {
+    if (page_count < 2) return DEFAULT_PAGE_BYTES;
+    return (frontier() - offsets[0]) / (page_count - 1);
+}
+
+int PageIndex::page_number(uint32_t offset) const {
+    int page = page_of(offset);
+    if (page >= 0) return page + 1;
+    if (!offsets) return 1;
+    return page_count + (offset - frontier()) / page_bytes();
+}
+
+int PageIndex::total_pages() const {
+    if (!offsets) return 1;
+    if (is_complete) return page_count;
+    uint32_t average = page_bytes();
+    return page_count + (size - frontier() + average - 1) / average;
+}
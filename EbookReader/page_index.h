@@ -0,0 +1,86 @@
+#ifndef PAGE_INDEX_H
+#define PAGE_INDEX_H
+
+#include <stdint.h>
+
+// Where every page of the open book starts, for one layout.
+//
+// The index is built front to back: offsets[0] is the first page, and the
+// last entry, the frontier, is the next page to lay out. It is filled a few
+// pages at a time in the background and by the reader whenever it turns
+// past the frontier, and saved next to the catalog so the book opens with
+// it the next time.
+//
+// A new layout keeps the page on screen where it is: its first character,
+// the anchor, starts a page. Pages laid out before it stop at the anchor,
+// so the last page before it may be short, and the pages after it are the
+// ones the reader reaches by turning forward from it.
+class PageIndex {
+public:
+    PageIndex();
+    ~PageIndex();
+
+    // Room for the pages of a book of `book_size` bytes, in PSRAM
+    bool begin(uint32_t book_size);
+    void end();
+
+    // Starts over with only the first page known
+    void reset(uint32_t signature, uint32_t book_size, uint32_t book_mtime, uint32_t first,
+               uint32_t anchor);
+    // False unless the file was made for this layout and this version of the book
+    bool load(const char* path, uint32_t signature, uint32_t book_size, uint32_t book_mtime);
+    // Writes the index if pages were added since it was loaded or saved
+    bool save(const char* path);
+
+    int count() const { return page_count; }
+    bool complete() const { return is_complete; }
+    uint32_t frontier() const { return offsets[page_count - 1]; }
+    uint32_t page_start(int page) const { return offsets[page]; }
+    uint32_t anchor() const { return anchor_offset; }
+
+    // Where layout of the page at `start` must stop
+    uint32_t limit_for(uint32_t start) const {
+        return start < anchor_offset ? anchor_offset : size;
+    }
+
+    // The frontier page ends at `next`; false when nothing more can be added
+    bool add(uint32_t next);
+    // Makes `offset`, past the frontier, the anchor instead; the pages built
+    // so far all end before it, so they stay valid
+    bool set_anchor(uint32_t offset);
+
+    // Page starting exactly at `offset`, or -1
+    int find(uint32_t offset) const;
+    // Page containing `offset`, or -1 past the frontier
+    int page_of(uint32_t offset) const;
+
+    // 1-based; estimated from the average page length past the frontier
+    int page_number(uint32_t offset) const;
+    int total_pages() const;
+    // Average length of the pages built so far
+    uint32_t page_bytes() const;
+
+private:
+    struct Header {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t complete;
+        uint32_t signature;
+        uint32_t book_size;
+        uint32_t book_mtime;
+        uint32_t anchor;
+        uint32_t count;
+    };
+
+    uint32_t* offsets;
+    int capacity;
+    int page_count;
+    bool is_complete;
+    bool dirty;
+    uint32_t layout_signature;
+    uint32_t size;
+    uint32_t mtime;
+    uint32_t anchor_offset;
+};
+
+#endif
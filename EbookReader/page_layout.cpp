@@ -0,0 +1,345 @@
+#include "page_layout.h"
+#include <string.h>
+
+// Bump when a change to the rules moves page breaks, so saved page indexes
+// are rebuilt
+static const uint32_t LAYOUT_VERSION = 2;
+
+// Characters that may not begin a line
+static bool is_closing_punct(uint32_t cp) {
+    switch (cp) {
+        case ',': case '.': case ';': case ':': case '!': case '?': case ')':
+        case 0x2019: case 0x201D: case 0x2026:                   // ’ ” …
+        case 0x3001: case 0x3002:                                // 、 。
+        case 0x3009: case 0x300B: case 0x300D: case 0x300F: case 0x3011:   // 〉 》 」 』 】
+        case 0xFF01: case 0xFF09: case 0xFF0C: case 0xFF0E:      // ！ ） ， ．
+        case 0xFF1A: case 0xFF1B: case 0xFF1F:                   // ： ； ？
+            return true;
+    }
+    return false;
+}
+
+// Latin, Greek, Cyrillic and the like: a line breaks only at spaces
+// between them. From U+2E80 on (CJK and up) it may break anywhere.
+static bool is_word_char(uint32_t cp) {
+    return cp > ' ' && cp < 0x2E80;
+}
+
+// Left out of the page: control characters, DEL and a stray byte order mark
+static bool is_stripped(uint32_t cp) {
+    return (cp < ' ' && cp != '\n' && cp != '\r' && cp != '\t') || cp == 0x7F || cp == 0xFEFF;
+}
+
+// White space at the start of a paragraph
+static bool is_indent(uint32_t cp) {
+    return cp == ' ' || cp == '\t' || cp == 0x3000;
+}
+
+// Length of the line ending at `pos`: '\n', CRLF or a lone '\r'; 0 if none
+static int line_end(TextWindow& text, uint32_t pos, uint32_t limit) {
+    int c = text.byte_at(pos);
+    if (c == '\n') return 1;
+    if (c != '\r') return 0;
+    return pos + 1 < limit && text.byte_at(pos + 1) == '\n' ? 2 : 1;
+}
+
+// Past the white space and stripped characters from `pos`
+static uint32_t skip_space(TextWindow& text, uint32_t pos, uint32_t limit) {
+    while (pos < limit) {
+        uint32_t cp;
+        int n = text.decode(pos, &cp);
+        if (n == 0 || !(is_indent(cp) || is_stripped(cp))) break;
+        pos += n;
+    }
+    return pos;
+}
+
+// A line starting at `pos` begins a paragraph
+static bool starts_paragraph(TextWindow& text, uint32_t pos) {
+    if (pos == 0) return true;
+    int c = text.byte_at(pos - 1);
+    return c == '\n' || (c == '\r' && text.byte_at(pos) != '\n');
+}
+
+// The line from `pos` has nothing to show before its end. One cut off at
+// `limit` counts as not blank.
+static bool is_blank_line(TextWindow& text, uint32_t pos, uint32_t limit) {
+    pos = skip_space(text, pos, limit);
+    return pos < limit && line_end(text, pos, limit) > 0;
+}
+
+static uint32_t fnv(uint32_t h, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        h ^= (value >> (i * 8)) & 0xFF;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+PageLayout::PageLayout() : font(nullptr), width(0), lines(1), layout_signature(0), indent_cp(0x3000),
+                           indent_chars(2), indent_width(0), line_count(0), lines_end(0), lines_floor(0),
+                           lines_text(nullptr) {
+}
+
+void PageLayout::configure(const lv_font_t* f, uint32_t font_id, int32_t w, int32_t height,
+                           int32_t line_space) {
+    font = f;
+    width = w;
+    int32_t line_height = lv_font_get_line_height(font);
+    lines = (height + line_space) / (line_height + line_space);
+    if (lines < 1) lines = 1;
+    if (lines > LINE_CACHE) lines = LINE_CACHE;
+    line_count = 0;
+
+    // Two ideographic spaces, or four spaces in a font without them
+    int32_t ideographic = lv_font_get_glyph_width(font, 0x3000, 0);
+    indent_cp = ideographic > 0 ? 0x3000 : ' ';
+    indent_chars = ideographic > 0 ? 2 : 4;
+    indent_width = indent_chars * lv_font_get_glyph_width(font, indent_cp, 0);
+
+    uint32_t h = 2166136261u;
+    h = fnv(h, LAYOUT_VERSION);
+    h = fnv(h, font_id);
+    h = fnv(h, (uint32_t)line_height);
+    h = fnv(h, (uint32_t)width);
+    h = fnv(h, (uint32_t)lines);
+    layout_signature = h;
+}
+
+uint32_t PageLayout::layout_page(TextWindow& text, uint32_t start, uint32_t limit, char* out,
+                                 size_t out_size) {
+    if (limit > text.size()) limit = text.size();
+    uint32_t pos = start;
+    size_t used = 0;
+    bool full = false;
+    // Still at the top of the page: a blank line there is not shown
+    bool top = true;
+
+    for (int i = 0; i < lines && pos < limit; i++) {
+        size_t line_start = used;
+        if (out && !top) {
+            if (used + 2 >= out_size) break;
+            out[used++] = '\n';
+        }
+        size_t n = 0;
+        uint32_t next = layout_line(text, pos, limit, out ? out + used : nullptr,
+                                    out ? out_size - used - 1 : 0, &n, &full);
+        if (full && i > 0) {
+            // The next page starts with this line
+            used = line_start;
+            break;
+        }
+        used += n;
+        if (n > 0) top = false;
+        if (next == pos || full) {
+            pos = next;
+            break;
+        }
+        pos = next;
+    }
+    if (out && out_size > 0) out[used] = '\0';
+    return pos;
+}
+
+uint32_t PageLayout::page_before(TextWindow& text, uint32_t end, uint32_t floor) {
+    int needed = lines;
+    while (end > floor) {
+        int count = cached_lines_before(text, end, floor);
+        if (count < 0) count = paragraph_lines(text, end, floor);
+        if (count <= 0) break;
+        if (count >= needed) return line_start(count - needed);
+        needed -= count;
+        end = line_start(0);
+    }
+    return end;
+}
+
+// Lines before `end` in the paragraph laid out last, when `end` starts one
+// of them other than the first and the page before it is still kept; -1
+// otherwise
+int PageLayout::cached_lines_before(const TextWindow& text, uint32_t end, uint32_t floor) const {
+    if (line_count == 0 || lines_text != &text || lines_floor != floor) return -1;
+    int oldest = line_count > LINE_CACHE ? line_count - LINE_CACHE : 0;
+    int count = -1;
+    if (end == lines_end) {
+        count = line_count;
+    } else {
+        for (int i = oldest > 0 ? oldest : 1; i < line_count && count < 0; i++) {
+            if (line_start(i) == end) count = i;
+        }
+    }
+    if (count < 0 || (oldest > 0 && count - oldest < lines)) return -1;
+    return count;
+}
+
+// Lays out the paragraph that `end` is in or ends, from its start up to
+// `end`, keeping the line starts; returns the number of lines, -1 on a
+// read error. Blank lines go with the paragraph before them, since a run
+// of them is one line wherever it is entered.
+int PageLayout::paragraph_lines(TextWindow& text, uint32_t end, uint32_t floor) {
+    // Back to the line end before the paragraph; one right before `end`
+    // ends its last line
+    uint32_t lowest = end - floor > MAX_PARAGRAPH ? end - MAX_PARAGRAPH : floor;
+    uint32_t start = end - 1;
+    while (start > lowest) {
+        int c = text.byte_at_back(start - 1);
+        if (c < 0) return -1;
+        if ((c == '\n' || (c == '\r' && text.byte_at_back(start) != '\n')) &&
+            !is_blank_line(text, start, end)) {
+            break;
+        }
+        start--;
+    }
+    // Not in the middle of a UTF-8 sequence
+    while (start < end && (text.byte_at(start) & 0xC0) == 0x80) {
+        start++;
+    }
+
+    line_count = 0;
+    lines_text = &text;
+    lines_floor = floor;
+    lines_end = end;
+    uint32_t pos = start;
+    while (pos < end) {
+        line_starts[line_count % LINE_CACHE] = pos;
+        line_count++;
+        size_t n = 0;
+        bool full = false;
+        uint32_t next = layout_line(text, pos, end, nullptr, 0, &n, &full);
+        if (next == pos) {
+            line_count = 0;
+            return -1;
+        }
+        pos = next;
+    }
+    return line_count;
+}
+
+// One line from `start`: returns where the next line starts and writes the
+// bytes shown into `out`. Sets `full` when `out` ran out of room.
+//
+// The text is cleaned up on the way, without changing where anything is in
+// the book: CRLF and a lone CR end a line like '\n', a run of blank lines
+// is one blank line, a paragraph's leading white space becomes the
+// standard indent, a tab shows as a space, and control characters are left
+// out.
+uint32_t PageLayout::layout_line(TextWindow& text, uint32_t start, uint32_t limit, char* out,
+                                 size_t out_size, size_t* out_len, bool* full) {
+    // Last place the line may break before overflowing, and the character
+    // before the overflowing one
+    uint32_t break_pos = start;
+    size_t break_len = 0;
+    uint32_t prev_pos = start;
+    size_t prev_len = 0;
+
+    uint32_t pos = start;
+    size_t len = 0;
+    int32_t x = 0;
+    int chars = 0;
+
+    if (starts_paragraph(text, start)) {
+        pos = skip_space(text, start, limit);
+        int n = pos < limit ? line_end(text, pos, limit) : 0;
+        if (n > 0) {
+            // A blank line, and the blank lines after it
+            pos += n;
+            while (pos < limit && is_blank_line(text, pos, limit)) {
+                pos = skip_space(text, pos, limit);
+                pos += line_end(text, pos, limit);
+            }
+            *out_len = 0;
+            return pos;
+        }
+        if (pos > start && pos < limit) {
+            if (out) {
+                int bytes = indent_cp == ' ' ? 1 : 3;
+                if ((size_t)(indent_chars * bytes) > out_size) {
+                    *full = true;
+                    *out_len = 0;
+                    return start;
+                }
+                for (int i = 0; i < indent_chars; i++) {
+                    if (bytes == 1) {
+                        out[len++] = ' ';
+                    } else {
+                        out[len++] = (char)0xE3;
+                        out[len++] = (char)0x80;
+                        out[len++] = (char)0x80;
+                    }
+                }
+            }
+            x = indent_width;
+            chars = indent_chars;
+            prev_pos = pos;
+            prev_len = len;
+        } else {
+            pos = start;
+        }
+    }
+
+    while (pos < limit) {
+        uint32_t cp;
+        int n = text.decode(pos, &cp);
+        if (n == 0) break;
+        if (cp == '\n') {
+            pos += n;
+            break;
+        }
+        if (cp == '\r') {
+            // CRLF ends with the '\n', a lone CR right here
+            pos += n;
+            if (pos >= limit || text.byte_at(pos) != '\n') break;
+            continue;
+        }
+        if (is_stripped(cp)) {
+            pos += n;
+            continue;
+        }
+        if (cp == '\t') cp = ' ';
+
+        int32_t w = lv_font_get_glyph_width(font, cp, 0);
+        if (chars > 0 && x + w > width) {
+            if (cp == ' ') {
+                pos += n;
+            } else if (is_closing_punct(cp) && chars > 1) {
+                pos = prev_pos;
+                len = prev_len;
+            } else if (is_word_char(cp) && break_pos > start) {
+                pos = break_pos;
+                len = break_len;
+            }
+            // Nothing left to show before the line end: it ends this line,
+            // not one of its own
+            uint32_t rest = skip_space(text, pos, limit);
+            int end = rest < limit ? line_end(text, rest, limit) : 0;
+            if (end > 0) pos = rest + end;
+            break;
+        }
+        if (out && len + n > out_size) {
+            *full = true;
+            break;
+        }
+
+        if (!is_word_char(cp) && chars > 0) {
+            break_pos = pos;
+            break_len = len;
+        }
+        prev_pos = pos;
+        prev_len = len;
+        if (out && cp == ' ') {
+            out[len] = ' ';
+        } else if (out) {
+            for (int i = 0; i < n; i++) out[len + i] = (char)text.byte_at(pos + i);
+        }
+        len += n;
+        pos += n;
+        x += w;
+        chars++;
+        if (!is_word_char(cp)) {
+            break_pos = pos;
+            break_len = len;
+        }
+    }
+    *out_len = out ? len : 0;
+    return pos;
+}
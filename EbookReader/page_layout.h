@@ -0,0 +1,82 @@
+#ifndef PAGE_LAYOUT_H
+#define PAGE_LAYOUT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "lvgl.h"
+#include "text_window.h"
+
+// Breaks book text into lines and pages the way the page label shows it.
+//
+// Lines are filled greedily with the font's advance widths. Latin words
+// move to the next line whole when they fit on one, a space at a break is
+// dropped, and Chinese closing punctuation never starts a line: it takes
+// the character before it along. A page is the number of lines that fit
+// the text area. The page text is written with a '\n' at every line end,
+// so the label never has to wrap it and shows exactly the lines measured
+// here.
+//
+// Page starts are byte offsets into the book. Laying out from a page start
+// always gives the same page, so the next page starts where this one ends.
+// Going back, a paragraph is laid out from its start, which is where its
+// lines break however it was reached, and the page before is the last lines
+// of it.
+class PageLayout {
+public:
+    PageLayout();
+
+    // `font_id` tells fonts apart in signature(), e.g. a hash of the file name
+    void configure(const lv_font_t* font, uint32_t font_id, int32_t width, int32_t height,
+                   int32_t line_space);
+
+    int lines_per_page() const { return lines; }
+    // Changes whenever a setting changes the position of page breaks
+    uint32_t signature() const { return layout_signature; }
+
+    // Lays out the page starting at `start` and returns where the next page
+    // starts; the end of the book when this is the last page. The page stops
+    // early at `limit`, where another page is known to start. With `out`,
+    // the text of the page is written there (NUL-terminated); when it does
+    // not fit, the page ends at the last line that does.
+    uint32_t layout_page(TextWindow& text, uint32_t start, uint32_t limit, char* out, size_t out_size);
+
+    // Start of the page that ends at `end`: the last lines before it, taken
+    // from earlier paragraphs too when its own is short. `floor` is a line
+    // start at or before `end` that is never gone past: the first page, the
+    // anchor or an indexed page. Laying out from the result ends at `end`,
+    // unless less than a page lies between `floor` and `end`: then it is
+    // `floor`.
+    uint32_t page_before(TextWindow& text, uint32_t end, uint32_t floor);
+    // Drops the lines kept from page_before(), when the book changes
+    void forget_lines() { line_count = 0; }
+
+private:
+    // A paragraph longer than this is laid out from this far back only
+    static const uint32_t MAX_PARAGRAPH = 16384;
+    // More than a page of the smallest font
+    static const int LINE_CACHE = 64;
+
+    const lv_font_t* font;
+    int32_t width;
+    int32_t lines;
+    uint32_t layout_signature;
+    uint32_t indent_cp;             // Paragraph indent
+    int indent_chars;
+    int32_t indent_width;
+
+    // Line starts of the paragraph page_before() laid out last, the latest
+    // LINE_CACHE of them, so paging back through it lays it out once
+    uint32_t line_starts[LINE_CACHE];
+    int line_count;                 // Lines laid out, may exceed LINE_CACHE
+    uint32_t lines_end;
+    uint32_t lines_floor;
+    const TextWindow* lines_text;
+
+    uint32_t layout_line(TextWindow& text, uint32_t start, uint32_t limit, char* out, size_t out_size,
+                         size_t* out_len, bool* full);
+    int cached_lines_before(const TextWindow& text, uint32_t end, uint32_t floor) const;
+    int paragraph_lines(TextWindow& text, uint32_t end, uint32_t floor);
+    uint32_t line_start(int line) const { return line_starts[line % LINE_CACHE]; }
+};
+
+#endif
@@ -0,0 +1,1334 @@
+// Generated by tools/gen_pinyin_table.py from Unicode::Collate's
+// Pinyin.pm. Do not edit.
+#ifndef PINYIN_TABLE_H
+#define PINYIN_TABLE_H
+
+#include <stdint.h>
+
+static const uint32_t PINYIN_FIRST = 0x4E00;
+static const uint32_t PINYIN_LAST = 0x9FFF;
+static const uint16_t PINYIN_RANK_COUNT = 20892;
+
+// First rank of each initial letter a..z
+static const uint16_t PINYIN_LETTER_START[26] = {
+    1, 197, 1088, 2427, 3422, 3607, 4228, 5054, 6117, 6117, 7722, 8276, 9845,
+    10653, 11132, 11166, 11763, 12769, 13094, 14406, 15296, 15296, 15296, 15926, 17261, 19212,
+};
+
+// Pinyin rank of U+4E00..U+9FFF, 0 = not listed
+static const uint16_t PINYIN_RANK[20992] = {
+    17849,3043,7833,11763,13402,16223,5123,15391,19619,13133,13403,16224,6117,1059,18778,10333,
+    4259,1893,1894,20412,12266,11398,13723,13722,12463,897,17790,2253,3090,14036,1642,3086,
+    12464,9004,3087,18621,9005,17372,921,13172,4980,7285,4494,17261,12155,20149,6292,7016,
+    3908,4819,2036,1367,9135,20545,20340,5058,15347,2525,15591,20341,7186,8756,7432,11573,
+    4038,17887,18003,10685,15921,7307,7308,15219,10062,18004,17850,19906,15780,19484,5630,3615,
+    8544,18259,11604,11242,12214,5574,4777,1650,1657,17965,18299,17338,10388,7306,11888,17782,
+    16051,16428,4260,7309,16225,5583,13840,3186,13708,6123,10732,6416,7450,13677,10027,5503,
+    9894,9734,20588,13011,17134,17427,4131,13238,10660,4292,14384,18701,2375,19725,4297,20062,
+    4890,4299,9736,9175,18102,7573,8560,9884,18779,19845,13731,13734,3594,1960,18686,8127,
+    18685,19130,5584,11798,15837,7185,14082,14307,4510,4511,17313,16618,17316,11806,17319,6225,
+    15062,15417,7820,14427,6791,5072,18012,1364,5366,10607,17847,16466,7150,14963,9016,16467,
+    7154,17798,12297,981,18661,16695,2566,8905,3394,10158,12830,12831,6213,6409,15418,18005,
+    13535,12832,8542,3044,19398,7071,11708,1858,198,19612,7050,7017,891,12892,2252,3988,
+    13140,9746,892,1163,20647,13724,14406,19620,4163,16424,16239,15220,5407,15001,12854,11980,
+    4309,4430,968,2483,9288,17967,1509,1426,13094,13410,17888,10623,10167,12855,6478,1510,
+    17622,12042,20192,11476,15754,15839,6645,6497,17717,3910,1164,12857,15421,3890,2765,3742,
+    20150,11890,11313,18688,2971,3334,15874,18013,16767,7821,17852,6215,40,15923,6316,4041,
+    3616,16868,7096,11399,2555,4001,14627,20193,18563,6070,5936,18780,2347,2017,13141,15529,
+    2018,1514,17282,16370,13379,1409,9747,1165,17232,16769,15530,20358,19405,16284,11081,969,
+    4644,10840,10861,16673,322,16979,9292,20250,13495,12547,2204,524,13727,6418,11400,18017,
+    14086,17969,19846,2921,5083,9902,2574,20359,1061,12548,571,19641,2196,15593,2766,20360,
+    20871,18645,17623,14782,19568,5267,593,15244,13458,18689,18018,4044,20874,4596,11022,15003,
+    10841,16244,12592,18491,15314,11989,13803,7728,436,11315,5912,5328,8512,16457,4456,17589,
+    268,3633,10485,6421,3597,922,6226,5361,6065,4925,12664,14880,6833,2205,18029,13710,
+    16809,13497,15227,7780,19951,4240,8314,17897,1758,8026,4850,8763,18217,13735,10263,20284,
+    16983,18646,74,9569,10586,3556,9751,3123,1286,1703,17235,4556,20212,17857,12981,2383,
+    16183,14091,19253,9659,14457,6834,19747,1210,12215,8041,1296,11023,11043,7073,15847,5470,
+    7271,1692,19821,20880,1898,12298,9660,7396,13912,14983,13562,15185,977,10710,16513,754,
+    15180,18785,16119,2290,3433,12501,16959,4871,8008,15848,7693,18044,4136,8990,20793,12243,
+    8771,18532,6045,7215,12095,13154,11312,14212,4063,15941,8725,4137,11606,393,18702,11815,
+    16185,16772,16869,18786,2841,1516,1860,20146,17430,8893,8772,8315,14120,6585,16870,4141,
+    6081,7469,16599,11183,6654,824,1970,3811,3972,17324,103,466,18835,16750,579,5578,
+    1411,19927,925,7326,17677,2350,8894,15364,8316,1169,20738,4497,4793,467,14857,13850,
+    13851,10168,2699,14517,7594,2071,16833,11358,14629,5502,17979,11768,14794,4333,7219,7032,
+    14283,1463,6966,3750,19955,7952,7546,20686,7470,12097,10815,9753,20526,15737,9812,14128,
+    8645,6046,3098,20672,515,15849,7471,10693,1107,6588,19510,17767,19956,13265,12375,12294,
+    18351,1618,6523,17435,13037,20201,2122,6486,6342,15544,18792,929,13080,14743,15455,11510,
+    17502,3925,14630,15760,3486,16641,1523,13614,7783,2847,20886,1254,14966,471,16687,5806,
+    17730,19573,1899,17345,18600,6655,16969,19447,2159,4180,555,20063,20722,10341,6241,17984,
+    16688,17210,1094,3258,1217,19761,11157,15056,15057,472,19226,9454,6970,15545,3895,1432,
+    4891,14190,20080,14228,16174,4223,19051,12949,8801,11087,19188,6754,9874,358,2889,14593,
+    5236,6975,15972,13345,12100,7609,1171,1977,13142,476,16605,18541,17681,14566,14368,17632,
+    3610,930,6438,2482,19256,14632,4741,853,1950,11111,1129,8598,2330,18496,19324,20728,
+    530,14147,181,2024,18800,19512,20784,13383,2056,7237,1796,13263,5153,19593,12384,17514,
+    2865,16702,9458,477,11563,7079,8967,9590,9920,12014,16261,14568,18422,3142,20441,16496,
+    13349,12222,7280,15182,20854,11725,15992,8498,1455,4861,9036,11783,1623,1329,15567,6161,
+    959,5967,2033,14933,2596,6856,7337,13233,3898,16404,7411,3514,6805,6679,15027,9194,
+    1002,4733,16425,14241,16405,6735,10453,17816,7124,6503,12253,11499,3937,20269,54,13129,
+    17945,7708,11049,1334,18127,2656,7198,17056,8049,6618,1986,2546,6862,13264,19259,1161,
+    864,101,12993,14479,1878,1301,8375,10852,7092,12111,10179,15865,11008,12453,10853,1445,
+    9116,8605,9679,8093,430,18913,800,19275,19983,14118,18575,5215,1600,1602,8838,14723,
+    15579,9437,1954,1348,12792,13877,6006,8864,9798,19278,11112,14636,17474,8584,10745,3553,
+    15870,19163,19261,18981,16846,1818,19660,16847,16241,4848,3295,7896,3296,10335,15135,1427,
+    3555,3297,3557,7053,15137,14087,17428,17431,13713,0,2630,12001,3150,3845,10009,13518,
+    3151,0,7173,8739,5846,13015,15419,10801,12662,9006,18703,197,4551,9364,15927,5177,
+    8361,4587,14823,4788,16827,895,11807,7460,2907,20591,3842,17626,6521,13826,6356,18103,
+    6377,1390,7256,10035,12782,10802,18982,10024,4346,12783,1208,7257,1209,19250,4760,7266,
+    10038,20255,10040,4628,16966,10342,10278,12946,18258,16669,7778,7666,11042,17893,10229,13742,
+    4791,10172,20180,7472,18954,10469,7978,9136,4181,16670,10307,890,3091,14462,4348,3954,
+    894,5589,1819,7576,5590,8099,17784,8644,11223,4045,10436,3122,16334,9092,11970,6514,
+    7211,13913,10114,15096,11769,4720,20516,14129,7220,8991,12415,2951,9223,3133,4334,6592,
+    18229,2278,17929,8802,2065,10487,20522,2331,14054,3376,7125,9176,9177,11009,16011,3209,
+    6290,3661,3662,3663,3969,7351,1946,19905,3911,10651,20145,4042,3912,11616,3916,7739,
+    5807,7745,4300,2753,11644,12077,16845,8038,15077,136,1909,6119,2640,5098,5101,19329,
+    2670,2947,2671,12851,12852,2042,3833,12267,18007,6120,7770,12093,2385,1916,15691,6124,
+    2556,16804,5662,15348,7577,8650,19074,9090,9299,19359,4349,2060,4046,1911,12639,7352,
+    13294,10437,9207,20152,11224,835,6952,6953,11270,8757,13295,836,1365,7188,4745,4514,
+    2698,2062,8128,7991,3399,3598,20032,13950,12716,13239,2206,7897,6957,4949,2207,4950,
+    7740,3400,6324,14791,7194,9452,9811,19367,18953,2410,17124,7898,8284,12047,13240,2063,
+    4762,6649,2411,8653,14732,3812,11694,1370,11818,2064,20673,4359,15336,945,6136,3358,
+    12391,13339,3189,6656,6337,946,17341,7473,6056,13621,6593,3367,3259,15795,4763,4182,
+    13619,6661,4444,2448,7746,2066,2014,1378,15150,9591,8669,11392,13314,11538,7969,6850,
+    4753,12194,7617,5675,19452,20586,8917,7496,11424,9321,4963,6863,4964,6683,6684,14580,
+    6059,6378,6693,18140,6694,20124,1349,6638,10517,8715,20354,8749,17310,12715,320,4553,
+    6415,15922,9900,9091,7097,7935,16625,19993,3121,20361,11082,6954,12593,13436,18019,20283,
+    10522,8758,7098,8487,8488,7544,7974,17590,15297,16597,10587,8073,6958,9093,5268,13736,
+    7899,7103,4416,978,10441,1783,8444,18533,18534,10338,7900,17168,7547,12392,9574,1071,
+    10206,1786,8563,7766,10343,3136,16996,16999,7772,15924,18071,17171,15723,13622,8495,10635,
+    9592,11564,13773,6154,12329,6775,1485,12718,16497,18116,7618,3645,7528,15028,7497,2547,
+    16652,9910,17176,17177,9698,8826,1537,12793,12720,372,13428,19131,7286,412,4595,15871,
+    19132,15663,704,4261,4262,373,2217,18205,16848,11340,7354,14670,4457,11717,3481,11278,
+    4083,4565,2449,7329,12429,567,5661,452,10770,13807,3722,7319,17889,19213,6765,7822,
+    6786,8072,5504,16182,12549,745,4926,12271,19303,8076,3790,5516,18793,4938,8175,5959,
+    2541,4962,8912,8918,14273,3210,7343,7647,16108,11473,12545,17854,7849,17432,733,10866,
+    12563,13673,17230,11979,10907,13104,20777,13584,15838,5934,321,13728,16109,15392,5642,16626,
+    15393,439,20779,20523,16629,2527,9905,10711,2529,6242,992,13960,1039,8095,743,1052,
+    19567,7727,9497,18622,9540,15935,4765,15757,16683,6946,6947,15590,129,12430,19908,10025,
+    18329,15452,13437,6222,12729,9733,1759,7534,16680,16984,7074,12730,15885,6230,3487,12376,
+    15985,13161,1450,15528,3463,14943,8750,19689,5124,8751,17301,17263,17485,13464,2813,19473,
+    11249,17283,5269,17286,20033,1211,11251,14740,8652,13467,5491,14950,20812,2412,3813,18992,
+    1218,18998,16433,17436,8803,7610,13271,2890,1919,7330,7080,142,4944,17519,14055,8810,
+    1456,8372,8819,17405,17467,19037,14034,4552,9132,12954,12637,12638,3576,8592,3188,16371,
+    20413,13135,1121,1122,1123,1126,50,2510,18642,1248,6214,18667,13967,3696,13816,4785,
+    218,3607,13078,13732,13845,20540,12629,13824,752,16987,6480,11229,14188,4417,15599,14189,
+    3020,13067,2271,7973,4673,7449,9289,4761,2672,7975,19992,6885,19659,256,3045,7886,
+    14463,1776,13706,18643,12490,11671,17791,5224,14037,14562,1756,8545,2948,6121,9070,5388,
+    10389,16918,9966,1702,4495,17035,17657,20648,5266,6216,2972,2388,15002,10463,5489,8754,
+    15132,16484,19440,16226,17783,9657,17264,9885,11155,6055,17855,7667,1895,9188,15193,18260,
+    3801,572,12359,12360,7018,1062,3994,257,3315,3834,3430,5096,14947,7937,14005,11894,
+    5411,19911,18303,15808,15809,1502,10791,17155,15928,2068,3147,15692,5487,5389,15810,4414,
+    17339,7692,9658,3469,4455,10068,2476,11895,1645,15811,4415,4003,6886,5390,1757,13587,
+    10792,15194,4129,18020,2477,11156,8759,497,18985,5002,15713,12124,15787,3473,13637,7535,
+    11337,15695,10793,9845,9290,12769,18566,2818,20213,13737,20251,14940,16114,18030,11923,11617,
+    20655,4645,2155,15594,16963,2,10748,4229,11295,18031,16511,13498,5506,10490,2440,12640,
+    7429,5099,19216,15228,3355,11703,11271,837,4051,17568,5270,19237,5271,5059,7322,18530,
+    4220,2427,20252,15316,7722,4738,7723,20891,1064,9383,3092,10996,14458,14040,16372,6079,
+    11927,3599,3476,4853,19487,16120,17904,9127,20592,10390,10226,20007,17724,6133,20256,4438,
+    13914,19267,16598,5060,5873,8027,5707,14672,16289,3477,17089,16871,5003,17490,8513,17859,
+    7,11599,13542,15007,5393,16852,3356,15327,5054,19241,18649,3038,11194,16468,6,4508,
+    8077,17303,2428,16514,604,5939,10915,5638,16842,8043,3381,3840,6326,11044,10584,18488,
+    5228,18993,9444,11704,9978,4440,11134,1704,13440,8887,10661,20780,5284,7996,16517,16383,
+    8491,947,19696,19446,9017,208,10391,9099,14284,4077,1054,5138,5367,4532,14015,4492,
+    18659,17495,4653,4681,498,5103,14365,2106,18057,8,6458,15083,16290,15365,8781,15947,
+    14591,20883,12507,1518,15814,19343,17304,3148,11899,2785,12363,9873,10535,4590,3160,12641,
+    8492,9007,14385,19344,5766,8483,13242,6137,20872,15740,3967,7111,5632,11933,13827,15497,
+    13951,1465,3564,8793,12182,104,19369,18489,10911,18679,14858,8341,13266,15956,15287,5517,
+    19,19649,11068,7925,20550,20551,13381,2848,5369,9138,5,1108,16434,15196,15851,15707,
+    2356,13267,4685,11902,11903,14677,2581,2582,17804,20663,583,2357,2006,5290,17305,11905,
+    19700,3766,9008,16301,11450,13268,8309,19370,18354,4769,11170,19726,13202,20436,10947,5053,
+    9779,17346,2849,12673,1372,1040,3072,8443,16604,7400,14594,1792,14744,99,7297,2588,
+    7724,18522,15604,10717,13346,18853,19705,8288,6929,5473,5127,3009,20226,1300,15329,11115,
+    18842,18235,19227,17663,11132,10345,5542,19171,2031,5952,5775,5776,16084,5261,6145,8177,
+    20181,15502,13272,17004,5810,3370,10951,17043,9021,18854,13173,1712,12221,17506,2537,11339,
+    1127,8665,18490,19448,15460,10363,18414,11330,1056,8147,16129,18855,6976,9493,8015,19347,
+    5608,14753,17686,5334,4,16905,12137,13207,18497,14231,5459,16645,45,14372,9886,1255,
+    5077,7864,2432,13165,1544,13017,14167,15304,6155,11261,15798,12082,13774,4471,20605,6930,
+    9833,15717,15319,14109,1714,5206,14405,0,5061,14390,12330,10954,5263,19971,13127,10653,
+    4500,10657,2885,14,12185,14999,637,144,145,8906,20814,19686,10549,14201,14191,14556,
+    2796,11784,6899,1827,6806,7747,14569,13316,1190,6445,23,16541,11565,9494,4230,4701,
+    16542,5522,5968,5012,11159,16262,19377,1439,16942,11665,2723,9888,9877,5553,8634,3191,
+    4231,14578,17787,533,18365,13132,6900,10299,16608,5639,9897,12778,2007,11351,8499,16610,
+    6165,20350,1494,8186,20819,16547,14061,5212,4153,9042,12224,16002,1987,1382,2600,5356,
+    17251,3461,20855,3646,1719,5898,19273,2053,2298,2597,18894,15199,1240,6904,17771,16003,
+    11945,5209,8919,16946,2741,5900,18289,11712,7568,12335,17220,10957,9495,14062,17461,18475,
+    2435,19530,11133,20272,7130,11051,5980,16707,11947,3523,19350,17875,13792,6907,19060,17,
+    18505,7632,8052,18811,11331,2709,4234,5387,3323,2622,16784,13123,11428,11485,18254,20821,
+    11010,2804,8433,14417,6060,12995,5199,16230,17831,3364,11501,1880,6383,7134,5216,14812,
+    1446,17260,10064,1088,14814,9556,5997,1017,18577,10969,18293,5622,10066,5404,19717,8696,
+    9335,5082,10733,16563,10509,17536,8846,9514,9404,10512,2611,1603,11594,11487,16502,6104,
+    10513,16158,3397,8022,17411,1352,18389,12803,2919,8312,14453,16569,7648,2152,5717,6110,
+    20451,10978,16570,1093,8707,1396,1309,8871,18192,9781,10735,19234,14211,16104,19419,6578,
+    19235,20355,8399,10984,10731,8426,9380,15483,5909,18213,12491,14083,10991,6582,5910,16770,
+    18214,10706,15147,15148,3335,7824,18951,7267,11509,19133,2218,5531,5911,18986,3431,5019,
+    8247,2219,14995,15094,15486,9748,5020,12760,12899,9209,4718,5021,14459,5022,15095,18650,
+    5023,18267,6047,11739,18789,5104,18994,9755,12657,18794,12378,5024,2022,15503,18999,12658,
+    8000,4193,19006,19007,17334,15109,15117,15118,15151,9740,5972,18141,5740,9715,9726,15130,
+    17311,15131,14981,13616,11737,9566,8059,17262,19251,15485,4431,18822,15781,4879,11477,17890,
+    2732,11982,11983,19817,20535,2641,11969,16236,13375,8097,1451,11801,10940,10523,6125,6452,
+    19996,19997,307,17167,18021,12348,10069,7668,12948,15203,3759,513,514,14501,7779,5706,
+    20875,7938,594,7189,2835,7147,6318,8039,2814,7148,6511,14515,8760,240,15877,3855,
+    20485,11656,323,14575,8203,12554,14550,19914,15247,4288,11618,2923,4766,10811,14466,11404,
+    7258,17624,3989,178,9570,12466,10609,7887,4621,17156,221,1733,1527,9210,20364,4167,
+    5507,20034,2070,8276,9433,9434,9500,179,2485,11272,10461,16811,3124,6327,5329,9684,
+    2168,1761,8595,4244,18218,5492,3284,19663,4064,4854,17673,3382,3383,4929,1266,17594,
+    18265,3618,4625,18989,2998,16631,7923,13395,13820,3478,936,2925,5420,17268,8028,2471,
+    7731,2644,7741,5196,10766,102,16786,16384,19049,339,4013,243,18058,18333,5139,16991,
+    2072,12316,4533,9,536,3738,12731,18536,7696,6430,2843,9891,8477,7537,1651,13303,
+    7060,19697,9100,9101,1072,1658,5686,1073,13689,17169,5004,7260,17785,10912,2827,18843,
+    1079,17272,12674,14312,11451,12379,15368,7478,9770,19852,7953,1846,3100,2501,14564,105,
+    1116,1973,537,7784,19959,3386,18072,19960,18073,11304,6143,20517,11827,13191,7479,10820,
+    7998,7906,14592,8205,10868,6524,3285,7077,4361,18844,3488,11360,4722,15138,8646,3760,
+    17291,12099,8250,119,13581,3409,10771,15086,1669,18236,6035,625,8968,5006,3010,20437,
+    5496,397,398,18721,2772,10013,6931,13030,17807,4545,7774,20689,18722,5811,3497,17682,
+    17507,421,2173,10084,1454,3232,15258,18334,3959,20203,7036,7064,5384,4366,2091,6598,
+    11654,8633,16491,5803,8637,3267,15339,17044,6351,6252,8046,18423,14413,1677,18547,7750,
+    14232,14233,13695,10296,14420,15725,1678,15110,14597,12740,20183,8811,20184,362,13120,19319,
+    3286,14843,15901,19900,17172,4472,19832,46,4566,17398,7787,14844,19008,15647,16703,9367,
+    5081,8472,1440,11365,547,1573,9599,9547,11142,12107,10097,10550,20418,13982,13884,9479,
+    1749,9948,785,7239,1230,13933,20100,19595,7798,18500,2937,1586,19974,16142,5010,12176,
+    7121,2870,13384,10637,2333,17520,14422,19420,12060,12158,8998,15642,20495,12199,19422,16943,
+    13351,13352,234,11727,8050,3115,3677,12746,10566,3319,3320,20843,2871,13627,3416,3418,
+    14527,2756,10605,3872,5823,14528,2473,17812,20404,6719,189,12164,6174,12202,7928,18142,
+    11465,670,2938,6738,17789,18506,17143,14533,8415,7501,5709,2660,12802,12116,17180,16416,
+    16098,5343,55,17278,2693,5217,13032,7146,8606,8113,9515,17412,14543,15583,5710,9439,
+    9440,13068,8847,9167,12804,1408,17188,17417,8585,252,15345,13719,12833,13159,20467,20468,
+    13588,17856,9903,7882,20370,20471,5537,5539,8235,17865,5543,17005,8241,13832,9995,20844,
+    13833,17876,19990,4672,1961,6766,3955,459,19515,755,14279,12759,9211,4171,2413,16228,
+    16866,16738,10762,16234,8164,15926,15332,19043,10026,14214,3353,3354,17796,12389,15333,4629,
+    4630,11935,10220,10222,18286,6075,1587,2468,19397,14822,14486,4218,4784,17656,17567,5179,
+    4399,13635,14646,14487,15063,17424,569,17891,8023,6417,3365,5663,8092,19165,6419,202,
+    3546,8895,5762,2767,17429,11284,7543,11808,10696,3970,16632,3892,2908,17652,8140,20770,
+    5764,11928,7734,19442,500,18045,6752,14698,19316,509,15948,5855,3792,2952,17244,526,
+    2932,182,13448,15724,5057,183,15902,184,6756,8913,3375,19123,6757,13788,3900,6095,
+    685,9716,3398,11089,11076,3056,10686,11984,6508,14408,7310,11097,1283,5222,16242,3702,
+    6293,14018,12980,3763,15443,5409,20453,4164,9846,2526,12862,4004,7210,17373,5073,15704,
+    20153,11166,3241,6319,7939,20194,17658,7099,19134,10382,3995,1816,19075,20455,11027,17487,
+    10664,16741,3856,573,18690,15275,3913,15394,3735,15840,18826,4880,3244,222,10809,20239,
+    20541,19643,2441,10690,19045,15068,16286,19952,3422,10128,10524,11766,598,13499,12268,3423,
+    5272,16964,3617,19847,10410,324,10610,4005,9212,20649,20650,13711,12784,13298,17569,9917,
+    7047,4646,14088,16829,15535,20593,7453,13299,11577,12870,17674,3125,6724,13849,6231,4245,
+    16485,5643,7519,6793,4626,8514,6519,6520,17905,10910,19954,6134,6138,16379,5371,4855,
+    7670,8024,17491,10486,9094,11317,3479,18651,17381,1288,13503,18219,13683,4930,12666,20594,
+    14126,15453,5421,15312,9453,17321,12812,6794,9705,11607,16385,13441,8728,1652,16684,9979,
+    4014,14366,10077,15539,7903,2135,2136,14984,10922,16816,10713,18708,10667,11695,10794,7520,
+    13509,20051,5105,2844,20457,3434,11585,15187,16386,10340,15815,17382,15852,10,17386,18709,
+    14097,18710,15300,8888,16294,7368,12631,20488,11773,16295,20552,3101,1412,9578,31,3424,
+    3425,9455,10319,2255,11705,7401,11664,1095,9231,15369,818,16526,13881,11904,5884,3710,
+    15752,13046,14520,3767,3831,6971,14824,10821,12675,7216,6021,7160,12006,2929,16835,5604,
+    15337,8322,618,18237,1852,10780,4183,7226,9756,120,8365,8206,18274,17326,7369,8794,
+    2910,16296,5687,5669,18355,1321,13547,14967,2648,17731,15895,10729,2137,6487,15058,17006,
+    18856,15504,2859,12957,10118,2538,13039,12302,5885,15763,12056,2092,10365,4185,7011,3260,
+    17936,20204,10085,5812,10321,81,18356,17045,6932,15461,10136,19052,19867,12471,13765,16696,
+    15277,8969,10047,12788,14045,11511,15605,15303,7332,5544,173,12295,399,16932,15059,4896,
+    1924,17687,11493,16057,19009,18473,12914,13018,1715,9310,10121,11208,174,9848,4632,8178,
+    12331,6500,13190,19767,19010,6933,12919,10474,18362,6253,14234,10927,16307,14653,11255,8450,
+    10773,387,47,11494,11588,18117,11549,18883,8565,17082,9915,17870,19596,7808,18501,10870,
+    8677,2797,4901,17360,7083,20419,1441,19378,5089,10806,8528,10498,19687,5612,5613,185,
+    10807,12159,9889,11576,4667,15861,12225,15280,19562,10015,16311,16312,10559,9043,8920,5678,
+    4905,2742,19977,16947,17874,5671,16004,8187,12816,16005,17523,1335,6809,10124,3719,3647,
+    16267,18143,5981,6908,4207,13793,671,13355,14321,12165,8955,5741,16759,10931,3116,18144,
+    1130,56,10917,11011,9849,14917,1881,7135,2187,18759,11591,12938,12996,10695,17364,14481,
+    18381,1140,10933,19099,18431,10327,708,9850,13557,16840,10879,3211,9362,18976,8419,17537,
+    13970,9272,6881,10918,8421,12035,18390,13972,6009,12700,10276,8713,9717,17418,20334,8423,
+    20682,6948,7574,7575,7961,19181,9847,20668,2382,14343,4047,455,20589,16595,16771,10218,
+    14092,14460,374,6325,4647,11077,17135,18668,20431,5063,9706,14346,10747,10392,2256,12007,
+    13882,1153,17273,20606,10849,4028,20615,8678,17144,1034,12997,10684,10973,10974,18391,9718,
+    10316,10995,12947,14407,4920,19506,12432,18781,13819,73,15078,14155,15352,12977,17718,5412,
+    17894,7190,20509,10282,20342,2642,5417,20685,4790,20253,3069,15363,18207,390,13679,13680,
+    1845,13540,7901,17038,13743,18652,5765,17914,14909,13714,16380,4560,1653,12763,4561,16518,
+    19248,19491,395,5075,17496,16519,6431,13544,1560,12911,5853,10287,7979,8060,850,14223,
+    1109,19271,6343,18958,6344,18275,10289,7980,12380,12733,19764,6667,4186,11002,931,5732,
+    10137,12353,5113,18857,13692,11003,7115,11005,20089,18801,401,8061,11006,12355,10551,1276,
+    7491,4764,12356,5523,15907,9037,13699,11007,19513,13550,15571,16671,8062,5973,9044,7712,
+    5742,18160,17954,409,12312,1847,410,3946,2387,3294,14084,17192,2681,9683,3298,13823,
+    11672,3918,20414,4015,13468,7904,6725,6730,20416,15601,20842,17211,13927,3305,2691,16585,
+    6949,13435,3577,3578,3579,4236,6509,13842,1551,13404,13405,10581,4233,1431,9084,16346,
+    16347,8251,18582,15412,18583,9080,9081,17670,9970,15416,15413,15414,4238,17671,3404,8174,
+    20182,7333,4301,4690,4302,15172,4306,4307,13634,18301,1755,7831,10810,7072,15531,10934,
+    7394,11488,1241,16111,554,7355,7023,14831,12555,14818,7024,15790,2969,13642,13715,11622,
+    6139,16685,19800,16686,10816,19550,15949,15540,9936,3426,9486,11630,14819,3816,13889,16697,
+    15104,9669,9672,16090,1243,9676,7498,16708,7508,7571,9057,7641,13904,16161,1525,15202,
+    10859,13291,15325,16240,8752,3464,2719,6014,9382,18014,11891,12858,15875,5133,13493,18782,
+    1910,14308,11892,12859,19076,308,17719,130,17284,15878,6955,3467,6217,11990,3857,15353,
+    11802,1235,12043,11803,1285,7019,12550,4371,16373,176,8362,2682,203,20877,20878,17625,
+    7454,4353,7888,4610,17136,11657,8764,14888,12556,17376,4052,16898,6479,9283,15248,11439,
+    180,2486,8101,19079,12557,5596,11676,10411,112,14889,9213,1734,11653,3093,5137,8129,
+    16899,10029,15005,17137,18032,772,5275,205,9822,3480,4172,17199,2999,9573,3550,3559,
+    4246,12653,3126,17906,10611,13684,75,15491,5725,20042,10285,8726,6328,15008,15492,18653,
+    4739,16186,8727,17675,6887,19853,9707,6795,3435,3436,18836,16633,1043,12246,12761,3923,
+    3924,10751,8729,18593,16387,5427,2683,13510,1654,15097,4534,7697,5229,16191,18268,18790,
+    8478,7797,8493,8317,16338,12732,7954,1837,1838,14432,9139,5667,7370,8323,11828,10421,
+    8207,8208,20781,4723,2329,17292,17293,4372,9757,9758,8636,7598,3359,19860,5007,18276,
+    3102,5107,19861,15546,16579,11452,17347,14130,6972,527,20782,7999,3103,19552,4724,18277,
+    20683,19404,5813,18723,15331,17603,3928,12519,17604,14745,17985,20081,13766,19249,17732,3498,
+    20385,7775,9689,17442,10119,5114,6146,6147,5777,14968,13624,10086,12101,15896,18724,20690,
+    8367,7891,17392,17393,15551,20691,1270,14313,12915,7919,12303,18725,14821,9477,15111,3287,
+    15986,15726,1172,2652,12920,6980,7751,9311,15903,14135,12190,20607,15505,531,2891,2398,
+    12083,18548,10955,2399,6303,13808,13093,14150,20699,6777,9038,7809,1379,3024,1234,3060,
+    15090,9480,19631,19558,19559,146,1191,12572,12140,2334,20818,2689,2690,16061,18884,11326,
+    9398,16498,1244,960,12307,6810,17457,8500,19580,9150,9045,9046,7067,2757,3417,20845,
+    6905,4965,17702,6811,17703,7622,19531,18145,17145,10759,17826,17827,17949,10963,16354,6263,
+    16711,7894,16006,2880,190,20820,15645,17955,12939,2694,9287,19230,18812,19102,18321,13028,
+    7005,8832,4913,9405,9406,2898,12942,16040,7424,1353,18467,8138,17413,15480,10765,12701,
+    1508,2319,9719,2902,2903,10990,17420,17419,17478,8166,17479,2010,8037,2011,20209,5798,
+    7149,17194,1488,1489,9114,4549,20870,12239,7448,4578,7451,15788,11759,11760,1289,12520,
+    12530,6291,17966,14081,255,19912,19644,16486,17915,7075,17236,7545,209,17245,7049,4039,
+    19212,589,13725,1060,3046,13957,3642,10939,13636,3835,11178,19998,15933,5592,2575,15487,
+    19622,14628,2487,10525,11316,11179,14925,940,8897,20035,20279,973,20036,2842,10532,18046,
+    18047,11623,11971,7536,12982,13958,2492,19895,13993,12247,19753,13646,12764,16053,340,2499,
+    4887,1861,11631,19626,13155,15338,2502,15498,1433,13269,11829,19371,5025,10048,3233,5474,
+    19898,16933,10294,15506,15764,4096,18089,345,11635,3041,4567,11209,5857,14654,10297,6501,
+    14714,5895,20167,13317,9949,10638,786,5027,19379,10639,346,19632,7200,1383,4115,20108,
+    5526,3648,2054,654,706,19638,10309,12203,1318,3873,10186,348,1882,10401,1937,7002,
+    16361,8388,4328,11614,10883,6510,920,923,16830,4339,17655,5761,18644,18569,6300,4865,
+    11474,14944,19399,4866,20454,10579,12414,595,12313,3336,2051,4924,17302,278,7020,16980,
+    9498,15841,20476,8007,18348,2819,11273,2924,17265,10383,4515,2208,4132,15006,11250,3803,
+    16459,17975,20043,14881,20044,16872,3245,20884,16520,15098,4936,8010,9980,14964,18626,1044,
+    924,1697,8324,619,6243,78,13921,7807,18495,15276,14131,13922,12408,18858,18795,10386,
+    14168,1222,16437,3818,7334,3508,4897,9368,13273,8907,8451,14169,20090,11707,12410,7338,
+    7335,7084,147,8264,9460,18337,9085,2509,9600,18118,1933,1336,15119,14063,16757,10387,
+    1457,15862,3822,4868,8020,8053,672,12166,16712,9179,9180,9058,9516,6413,18468,16276,
+    14958,18516,8714,14960,18300,17191,17371,14962,2780,11193,6647,5913,10691,5914,4577,10908,
+    7733,744,18015,11919,11063,3891,7430,17433,18048,19317,655,18006,17851,3595,13134,13729,
+    3596,13767,13775,4550,2970,18302,5585,4040,5408,15782,15169,1729,6767,241,13539,2836,
+    19590,7580,14647,4133,2820,10230,16287,5533,1477,11083,7212,19797,17916,10266,12654,15335,
+    13412,13081,17039,7221,2953,19591,6771,12156,11361,2583,12157,626,627,13474,2589,6608,
+    4633,4502,3613,638,7970,6718,845,16552,2601,5013,6779,5451,10240,5017,15344,7655,
+    6311,6312,4878,2617,9571,9572,15163,5949,20082,5960,5961,17950,17951,17958,17959,19070,
+    19071,13292,16807,15665,15004,17492,17493,18837,1705,1110,781,2954,851,11362,18549,11555,
+    19597,18461,1727,1775,20536,15274,6218,3744,20154,18022,15422,1526,576,2768,9214,4053,
+    15427,19848,2288,15428,7213,2493,15942,17237,5362,17595,5694,9685,5493,15430,1693,20052,
+    16960,7222,15099,2254,20147,8318,2257,2734,11184,16082,3107,6345,1434,20064,2258,20220,
+    8325,18859,16689,7035,6662,13768,6488,758,5814,4187,17212,15552,11256,17688,15468,15987,
+    19870,11566,14758,2729,19875,19878,840,2730,1829,1534,6864,5982,6868,5904,10105,9447,
+    16448,433,12615,16739,16783,590,18008,8546,12834,2673,3066,4256,6320,12843,12836,1399,
+    14549,14699,14700,4281,11915,13730,2386,20028,15444,9967,15929,3664,18349,14855,10412,15693,
+    20155,1820,15882,6219,15842,16115,6453,18564,15395,2221,14123,8040,18827,746,20029,11804,
+    2348,1553,14488,15204,12044,10909,6031,16850,11030,8085,16245,16742,7803,5508,7761,3893,
+    5693,14490,14143,15843,11163,1460,2061,7455,18033,391,1478,10413,11296,20879,19415,17643,
+    7461,325,11086,10749,19849,11180,1065,14926,5601,5597,7462,2442,8898,14042,1859,2840,
+    2494,17898,15081,18590,4008,6232,11341,16831,19047,10812,4786,4054,16116,599,18567,12269,
+    17097,2223,900,5850,16985,1963,600,13915,15943,14504,18561,20721,3300,10580,20004,18034,
+    13744,10805,17200,13745,16121,8515,5372,8078,10588,20008,16634,8964,14882,5851,3000,5230,
+    7962,4931,5373,15944,6835,13919,14121,5513,12467,17644,5945,5915,1784,6459,17907,16853,
+    4787,9189,5874,20674,16988,1763,13406,11094,5365,3547,7902,3127,14833,4562,12655,16164,
+    11972,19081,11343,7924,2724,5946,3482,16616,15051,17340,7742,1212,10767,19185,9975,18540,
+    18537,18955,11410,8232,12187,19082,18845,15100,7033,15957,19701,9190,14795,5140,5231,12273,
+    14798,1074,18059,12098,5927,15950,468,9918,17861,5368,14144,12656,1694,8130,15888,15889,
+    18571,8657,9018,5771,2224,18074,19083,8782,10992,10768,3489,12734,17078,12002,15890,10444,
+    2259,3793,443,3371,2358,1466,10162,13156,6346,4827,4822,16836,2700,11774,7955,14859,
+    9759,15973,7785,4982,10869,12393,1863,3316,5036,19524,7161,15370,18963,7063,6352,8366,
+    18846,6089,5299,12676,14521,14799,14802,10948,15431,2138,5518,6022,15958,1453,16751,15499,
+    5953,3499,14388,20724,6525,18542,2930,7480,1143,1670,2726,478,12276,1135,2584,4823,
+    3411,10772,19189,16472,20489,3011,5815,2124,12440,12827,16788,1223,735,10447,20692,14746,
+    12241,1870,483,17046,15462,4465,12015,15553,18872,18726,628,17047,5778,10450,629,18104,
+    10346,18543,7767,2649,18238,3500,1568,10052,11976,7910,18737,48,12279,17443,11118,4319,
+    19190,20725,13118,8647,3896,18480,8179,8180,12744,4568,19149,14235,14242,11847,17689,14148,
+    5862,6254,4691,7492,2067,10871,16646,7752,19889,18550,1201,17249,13571,996,7768,19056,
+    16136,6052,18552,17635,8812,13176,14655,18245,2177,17011,12104,14498,5804,19192,13572,10488,
+    4594,13475,2262,11539,10640,10644,5028,1807,1145,1139,1137,2335,10454,14705,19598,15054,
+    186,13983,9950,4829,12747,19348,7339,5974,7748,8908,11164,14151,12334,18340,9695,13385,
+    15612,15152,9922,12020,13479,18502,12421,7810,2877,19978,9461,7562,11789,11785,18895,11645,
+    9039,2275,18574,1830,20109,15055,1624,11946,12573,11373,493,828,12454,6812,19423,1802,
+    8921,11648,8188,5975,12226,1684,18342,18343,16093,16012,2602,14529,3392,3307,3306,14249,
+    7633,1232,16548,3649,3899,8501,8529,1831,5091,11948,16313,10455,7201,9075,15863,1146,
+    7623,2299,16411,14557,13609,11432,18146,1989,16268,10760,2603,14558,7202,14138,5165,6869,
+    15617,17063,3117,12344,12339,7502,1202,7930,16713,18382,191,10061,18147,9181,13212,7713,
+    5699,10165,8416,57,9182,17367,8271,16231,1811,18813,18345,2479,10212,60,10187,3311,
+    11867,10520,8378,10166,1883,20125,11127,11128,17365,17640,1018,20130,8115,8094,18641,4037,
+    9336,10402,1690,6017,1402,10215,8420,5701,17088,12809,1404,6393,7514,5718,13486,18196,
+    8986,10728,10252,14637,7656,4377,4378,20475,4429,19073,15872,6507,16919,13908,12904,16110,
+    1643,15751,7021,4434,6515,12126,6077,12127,19569,3134,11956,6461,3007,19408,6464,6301,
+    19934,7776,6246,8151,4272,2751,19578,12141,4447,6615,6991,18885,6616,17458,9606,5527,
+    19582,16150,16152,2132,2514,12617,5586,5587,5588,3465,13733,14789,10028,5598,8765,3736,
+    14383,731,2926,7259,13396,17917,17980,13340,5605,3771,17444,13818,13838,1097,19439,12492,
+    8547,11710,199,2467,12891,3697,13024,19252,15222,19621,2968,7818,18671,7990,4310,13494,
+    1249,15223,4674,7976,15876,2736,11985,19950,12860,8254,10149,13188,17581,11031,336,1522,
+    12821,15930,12045,291,6454,18691,4048,177,15934,11401,19999,20030,3470,2737,19656,1646,
+    6321,17425,8086,747,1476,7353,15694,5532,19077,7581,236,12361,2557,19884,19166,15354,
+    10788,18023,13843,20405,11696,15064,3156,7825,19690,11697,4130,11267,220,168,19360,15149,
+    7966,9744,12172,19210,5593,413,901,20005,11342,14502,1066,11405,14467,17720,19795,19441,
+    17570,414,5259,10843,17797,2821,1782,11406,6420,10519,10129,1540,17266,1851,12558,10439,
+    1964,6422,4055,19474,20343,2528,1293,10652,10881,8277,4134,11268,326,11182,9131,10654,
+    4780,12046,7456,14428,223,15229,15230,170,7356,20524,11226,19645,281,279,2822,10842,
+    7463,8255,9435,6583,11966,18492,8363,10997,941,19362,11998,5358,8256,13746,6962,19886,
+    10993,4580,4581,12670,13962,2384,19217,7836,17908,16635,1213,5875,11578,20410,13806,10655,
+    263,1736,4768,20045,8257,3384,3385,20009,12274,113,11064,19822,4458,6888,8030,3128,
+    10656,14883,9095,19443,9661,3001,15298,7587,9128,7434,20053,9708,17322,15736,14429,16636,
+    10750,2629,6836,19854,6297,5876,16291,18947,11,15232,11109,2414,982,4535,14783,19825,
+    1659,13095,13096,7940,10116,9445,7361,11356,6589,18060,14985,13304,13029,15366,16637,1253,
+    3956,6840,15850,7698,7327,15045,8233,6082,15101,20527,11698,9663,210,5141,13413,10936,
+    7521,19403,13920,17775,7595,1055,15357,1075,20858,18061,19500,9662,14165,15233,8485,14355,
+    341,6590,5767,2684,15639,15396,12322,11389,13463,9105,10422,10154,4144,271,7481,2680,
+    15753,20,7538,19089,20723,1542,2074,6973,15085,516,10672,10892,13077,20864,15761,15959,
+    16255,1663,2888,13189,9745,12416,4362,3360,13828,2977,11699,2828,19616,6048,6298,14650,
+    11964,11830,11185,13855,12010,9232,17768,17327,7599,19862,9009,4770,18075,6086,13343,19887,
+    3490,1111,14565,1531,896,6923,14800,7963,15166,17437,2417,20221,7371,14874,12053,7932,
+    264,11174,6924,9542,4778,10493,4547,20065,2564,10224,1152,13175,4824,11393,19053,11116,
+    6599,19868,7298,6600,18727,17399,8148,10723,5397,12958,11491,15463,13119,20771,17048,10366,
+    14747,10937,1256,13769,20726,19833,17866,17213,18523,713,17605,5779,17445,19272,108,16934,
+    17330,15765,7883,2003,6237,14803,8286,8291,1569,7735,7299,7300,15107,6934,5886,4513,
+    1849,16539,3012,16619,19000,12054,17776,1257,19449,444,17683,15464,553,8409,15709,12365,
+    1313,4445,9478,20727,4520,6847,4634,12366,12921,12741,1853,2004,19556,14359,14348,997,
+    1980,12916,363,2390,13177,7865,17690,2687,19937,11088,8281,6537,14170,12541,4402,16348,
+    14025,13166,7116,10396,3509,2076,11119,13315,14434,19478,14598,11211,297,2433,8813,14656,
+    5545,20091,15306,5651,12021,15710,12174,14845,19768,3510,16647,11121,12685,1271,19496,4475,
+    15855,3551,13476,7819,13477,13865,275,17691,876,14176,14508,13110,1380,14375,7302,1828,
+    2047,4779,912,3961,13955,2872,11941,14178,19503,8952,1625,1716,4830,9601,9834,9481,
+    20730,4267,5614,19453,2057,14643,5676,2336,10683,10504,6733,4902,18460,19975,152,20110,
+    10958,9951,1401,7971,1912,13480,15153,6857,10496,10500,19710,1155,7946,787,6778,18246,
+    4641,12022,9086,6264,18366,7569,11570,11569,8486,3324,16408,13031,4966,19274,18128,16314,
+    1628,1629,13097,10758,5463,14064,5157,4875,2436,20856,10898,9178,19890,5899,20474,6865,
+    6306,1185,2567,2568,1535,961,1524,7570,4154,9031,521,4155,12254,962,2394,20561,
+    20443,15568,11713,12367,3321,10899,5652,16653,9496,6866,2311,14441,5166,12255,15748,6620,
+    4323,18507,8569,10741,9552,13356,20562,19384,11715,2148,6183,2632,13213,1186,12402,12400,
+    5790,6941,12336,8036,2548,16654,7726,11484,265,193,7503,17821,3542,10225,14193,10241,
+    6307,14482,20571,2695,16826,8418,1089,7444,17781,13014,17836,17832,10855,15773,6276,880,
+    11012,4451,20126,20118,8267,10510,6704,16662,9119,14511,276,14195,9557,9743,12823,14736,
+    11203,17641,8627,1090,13878,19276,10904,16362,7720,6063,8848,8300,5760,18444,9517,9441,
+    12030,12031,19277,12036,8389,16277,18392,10108,12805,1320,18483,2315,16665,13487,9801,7721,
+    10253,8708,19279,9720,14512,20810,8872,2904,15311,2635,6882,7657,8424,8879,10743,19907,
+    4948,4932,11778,17222,11709,14280,13817,7834,18565,4257,17970,4554,4284,292,3757,19896,
+    11679,2887,7977,10442,15886,4719,5285,1215,16600,10268,1971,4462,2786,16997,6894,10445,
+    1564,7331,13515,3368,18796,1789,141,282,16998,6895,3369,8948,10952,620,1473,2912,
+    3361,18090,4315,13157,7892,17508,3317,6148,15071,16606,3372,6851,7233,17607,16202,10425,
+    13929,24,12195,25,19891,2802,19834,4030,13936,9047,12575,16867,17994,6870,13378,6871,
+    20572,18161,8956,680,8701,16614,16615,15664,17133,11809,11819,19501,854,7600,19502,8452,
+    3794,296,298,8376,18815,8395,15589,3163,13589,9083,6483,5540,16642,6489,18798,19769,
+    6901,15771,14915,3180,7051,1777,18263,4135,12128,19548,12594,20543,19553,3266,2419,14046,
+    16755,20554,20563,12337,9154,20573,1990,3280,20356,3723,1368,5182,18696,13643,11318,18591,
+    10131,11253,11820,19519,10007,9664,11319,11415,9305,4017,3751,17079,7162,7163,10847,20783,
+    19669,17986,9312,13419,6668,18738,17991,11853,20119,3651,11542,3652,19539,8056,14336,18771,
+    15806,6313,6329,6347,6090,12897,2573,7320,19994,19331,16627,14879,17193,16978,4228,8283,
+    4329,5136,14464,2837,16920,1366,13678,8100,17585,13681,15446,10414,10415,15218,2087,15844,
+    19138,460,131,19401,309,6956,8204,13590,5599,3746,5225,4951,1410,17037,10464,6018,
+    3838,12349,5509,18035,15936,16745,17377,19402,3747,14516,13563,7464,17596,19268,904,16785,
+    18470,17099,11680,19798,9218,2089,5226,10132,20861,10533,756,16989,6019,19646,20736,13747,
+    13748,18831,3808,3002,10031,10863,1452,15646,3096,30,905,132,20257,9386,16336,8104,
+    14910,1487,13690,5869,5854,17091,8141,16926,6841,7106,20054,7107,13397,15011,5458,17497,
+    4248,16470,13288,16586,17801,19115,5880,5108,5145,7702,15371,16391,8209,20263,15960,1660,
+    13618,1046,19702,19703,15893,5146,5950,5234,1609,15377,14861,20555,20827,20245,11742,7197,
+    15974,13331,10848,15975,12395,11907,7167,4939,19888,18091,20083,121,15378,9141,9022,1417,
+    15433,16587,19283,3832,17051,4546,17937,16203,19118,5890,16971,10451,8152,17770,18471,13891,
+    15559,13890,12399,10053,10718,6609,11099,122,17608,2093,17695,14391,7122,10478,6858,7755,
+    4404,15728,1469,11942,5242,17521,8820,51,6364,6373,10163,19284,16709,5243,10645,10556,
+    2233,10875,19604,5976,426,5161,17084,2026,9051,16265,2604,7203,11571,9155,15200,16094,
+    18148,6379,5865,2511,17817,17818,8827,14534,15035,16591,3823,13554,19677,5247,18162,16476,
+    16798,13531,6874,431,7245,17532,61,17833,13001,13899,10189,17183,17757,11758,8839,1581,
+    8116,3033,9077,17540,6111,9522,16041,12944,9412,10742,9819,9721,13290,14638,17480,20336,
+    19064,19065,12546,17792,4544,17794,5510,5276,13852,1189,1188,13632,9946,1239,1242,14804,
+    20826,1144,17007,5962,18314,12281,3851,11471,19072,18620,13034,11355,3859,4056,9219,3789,
+    12595,14792,11095,14911,14020,19826,8470,8469,20813,10470,5802,15448,15197,1490,6149,11779,
+    18359,20697,15449,15036,8476,8539,10190,9413,10622,2749,15592,10521,507,19461,13906,13907,
+    10624,20282,12835,200,11738,3420,3380,2674,8755,4922,6126,7288,570,16893,1644,2202,
+    13235,13026,19224,12663,11991,18692,4285,15789,1250,13296,17196,3665,15879,20651,8885,16828,
+    1099,2377,12863,775,15226,2838,19623,9971,1778,18024,4264,4555,3242,8651,11896,13909,
+    4350,14887,6787,13376,15410,8313,7349,9972,17586,9869,10372,14093,18988,5183,3804,440,
+    6959,3094,4400,17721,16247,1947,2088,11172,13846,5664,16746,1896,20365,1897,14124,310,
+    14125,6223,15758,7102,4622,6132,10003,11440,601,15450,133,3727,3860,18036,4057,10708,
+    15937,5600,17267,3157,16764,19796,17659,9134,13059,3458,10072,19662,5035,19915,2222,19183,
+    20840,3158,13847,19332,3421,8766,9641,6584,1647,14163,12129,3917,10709,16512,16251,7994,
+    11624,14469,16079,20010,4781,16515,6499,6426,4613,376,10534,18049,17799,17802,13749,10941,
+    577,3405,17909,9220,906,10846,8278,5277,328,3666,20159,2495,2169,17627,4009,269,
+    10602,4293,11767,12786,12956,10041,13431,14127,19733,16187,18654,13504,4952,15285,19488,10712,
+    11000,18538,2824,20046,19444,1267,2579,4651,1069,7324,137,4065,6586,206,3406,7851,
+    10697,20371,605,9349,1297,13305,14098,1967,11298,13738,4782,19445,17725,1612,7325,13750,
+    19920,9350,10075,8886,12906,19489,19358,776,19570,20047,9387,3129,9503,13594,8773,8364,
+    18535,13916,17206,13964,11930,19754,11770,8783,17918,16460,19827,8784,13200,4747,7771,503,
+    12845,16601,270,12846,926,20596,1862,18062,2210,16967,20289,6657,20823,3562,3584,18627,
+    3624,4582,7838,8518,19520,9102,18225,17645,5286,4506,18063,13754,4463,19242,9709,4078,
+    6967,5374,4955,14675,4858,15495,8080,12984,116,76,7548,17919,20528,7997,20055,12436,
+    15012,13164,13163,5729,7398,7328,17158,3408,20486,18711,19270,0,18352,7048,9379,19571,
+    17270,12815,19755,2646,11771,12218,5668,4956,6753,20458,17207,14369,13248,19762,442,14952,
+    8258,7227,11692,517,4084,13047,15046,7601,15961,8453,9352,3926,11775,15698,7676,4316,
+    14224,8992,12514,14987,18630,10080,342,9446,11345,20460,2850,17041,15105,19346,138,4725,
+    621,2789,5109,20661,19933,12877,473,4539,6594,5772,15372,11110,6434,14892,6348,16527,
+    9665,6033,13416,1238,3866,14132,10219,15820,8658,8659,3171,12351,18456,14370,7372,14733,
+    16690,8236,20553,13856,1312,3711,15547,7228,8660,852,16237,3990,14678,20066,8326,8902,
+    6595,20529,9233,8666,11936,932,9762,2225,12102,10322,11841,11842,1118,4997,1323,2727,
+    3795,11187,359,360,6025,20693,1671,19334,6247,8804,11363,18860,18861,4727,7705,3138,
+    14595,4364,15434,2860,2420,3673,1614,19576,11908,18966,17446,18862,12659,18092,13229,12849,
+    2077,8638,11780,20531,4097,7860,8331,20755,20756,19670,4794,3846,3867,13519,12396,10825,
+    15379,5041,9586,5205,6935,17987,1867,7435,7406,1672,20865,8994,12134,19964,2078,17274,
+    7375,445,6801,20556,20608,855,11364,3074,1949,1474,10169,5688,6601,4898,16130,3200,
+    12103,2721,4979,2946,9787,19935,12722,10491,4224,4548,11394,19554,18210,15278,13230,3388,
+    17769,4194,15560,15469,3270,6490,20698,6538,17938,13573,16058,17515,17452,2025,6539,2094,
+    18802,5302,19451,15769,11520,558,17665,6091,16939,13085,17609,8292,17400,512,5891,8153,
+    7037,8154,14050,3932,16621,15279,20067,6669,10641,10054,1996,5607,5550,8973,8639,14973,
+    10719,18739,18608,10092,14149,17110,17111,17633,19770,11521,17813,6255,6981,17814,1951,3346,
+    18728,20772,15470,10093,14805,6248,6982,7753,12473,18424,12974,5820,9459,8554,12723,16507,
+    11600,13809,4273,14523,8411,15649,18740,1598,9649,7437,13582,1997,11508,16704,6493,18119,
+    19560,4111,11122,10300,8456,12925,4702,6680,7438,14414,17735,19778,352,13256,19016,20667,
+    10479,14243,6502,17696,6992,5864,4340,3796,19497,12061,9878,14360,19017,16705,12926,13700,
+    19941,2337,19154,14974,9318,12922,14602,12745,19504,14056,13628,14438,7870,15993,4696,11786,
+    4405,4406,14352,11212,14658,4476,17214,2893,11069,6258,14027,4638,2080,12142,1274,12085,
+    5696,10098,17015,4376,4387,20564,15263,12262,17648,2894,6494,7789,20832,2722,9449,858,
+    20301,13174,16065,6166,8914,5977,18504,12112,5042,4274,4278,15155,5679,11790,13231,2339,
+    11370,18638,5556,6759,5617,5788,4967,10959,18129,4390,7812,4906,4907,1194,9957,7090,
+    2775,20465,8556,8474,1574,2234,8679,16882,12401,13985,3678,15050,4833,19381,14250,8600,
+    9550,9001,10308,9465,1495,14251,7873,1913,14608,792,9607,7303,19737,19455,13872,19605,
+    9924,10501,10930,17650,14899,11371,20397,13257,16013,12693,5378,6549,2235,6411,17564,12161,
+    17164,18373,3606,17223,19981,12229,20815,2269,11746,13939,5677,8194,19785,20847,19100,13357,
+    16014,2098,2939,3631,4322,10505,15866,12204,12818,9196,9328,12230,16412,13075,3679,19564,
+    15266,8522,19159,14010,3325,1631,14612,10180,7418,1687,14258,7634,7635,2940,5983,6175,
+    11113,16500,15281,11020,13053,20305,15037,19425,3877,12455,12789,5379,12068,4668,9361,8532,
+    4391,1936,16166,13633,20684,13162,6273,3153,7254,9553,6720,1998,19024,14445,13875,6741,
+    14538,9184,11054,18318,16068,14330,13321,20836,17086,1635,4341,7419,20839,18163,12340,11748,
+    17408,8570,3941,5931,2661,6384,14326,1035,11650,1688,1955,20406,4968,6274,7015,6496,
+    12403,19507,6621,12168,2712,17996,823,14140,13456,9185,8891,1278,10191,18294,14692,14484,
+    10328,11870,15157,869,6099,6390,12029,10857,11015,17880,4412,7791,18346,11072,12413,17464,
+    11871,10313,19680,4972,2101,6190,8159,11670,2761,1938,4503,10329,18579,20132,5861,12032,
+    8609,8574,13114,9559,8840,2318,9701,10404,6002,11149,9513,20127,4395,3213,19032,8849,
+    3827,20575,14197,8933,6788,1942,12427,20313,9523,17415,8856,20312,1605,7006,3534,14210,
+    5703,10975,18926,9414,8357,6918,16363,4919,7445,16568,9275,18396,6573,18326,18619,18448,
+    16451,11061,1027,1355,8396,7447,13974,13490,15527,2273,12703,12618,1184,7350,18932,9805,
+    8876,2320,9722,2637,7660,17566,8427,8402,20337,8589,8748,254,10739,18939,9278,4877,
+    12092,2203,5795,16747,18693,18037,11995,11138,16923,1479,1968,11934,7764,18064,7596,16124,
+    16992,5260,18847,8176,8447,8066,14022,15962,12,17867,11781,2001,1768,12304,8067,7786,
+    8068,7788,2032,13274,4749,18241,16756,16622,18741,12108,16543,17819,4448,15799,14572,7126,
+    11144,5528,14808,5713,16948,11332,16095,16611,2002,13482,13358,5093,1991,18164,3531,18763,
+    2151,5797,19991,19892,2195,1063,15845,11810,1067,1068,15328,7465,12049,1739,13205,1769,
+    13209,20185,14315,14316,8821,2424,18752,8828,4914,2480,3466,14080,6512,19691,10526,10527,
+    17660,10528,2289,17572,14856,13595,2496,13380,16993,17241,13853,1133,7602,11554,11974,12515,
+    14225,12394,19170,8966,18093,3998,19965,17808,1136,6026,2539,6249,3021,19779,19174,15650,
+    1907,877,14809,7127,13389,18290,2960,7340,5984,2323,18149,2549,3252,6742,8980,882,
+    3214,6722,6574,13841,11139,3265,20372,18226,12417,18076,13243,12249,7884,16582,17246,2934,
+    5928,5929,4697,12196,6162,18130,11145,5930,3277,17881,16574,15807,4818,10606,10112,10113,
+    29,7010,3195,18886,568,591,606,11444,11445,611,1343,10001,5202,1105,11441,9126,
+    6427,19518,13117,10631,15286,17208,3585,12912,16339,7399,10603,5204,12516,3172,13249,14554,
+    11305,7407,3362,2361,556,13136,13160,10055,13121,13866,18682,15290,5303,6670,14439,13137,
+    9652,10604,10017,15038,12951,1458,11747,9645,19535,13193,19536,10192,9560,12619,3037,13720,
+    2764,10409,7578,9973,11913,11568,10688,11916,2675,16246,2012,3839,17591,10803,888,4066,
+    13505,3097,12373,11931,18227,15951,5076,17629,77,17325,7907,12381,17331,3108,2590,9690,
+    12397,17636,19119,19122,13992,14002,19883,893,18528,2639,14003,8548,10860,15216,3700,4921,
+    14945,19909,12497,846,19400,10334,2310,5935,2949,5132,1284,20537,2035,15349,3703,2469,
+    15931,15224,9968,12495,11917,13337,11602,5134,11986,15783,15784,17233,14085,13009,4579,6723,
+    1730,15785,15140,7348,14574,19913,20000,11992,10280,4675,15415,7191,7192,13057,7669,5413,
+    14489,12709,6220,748,749,4330,15705,20151,3725,16851,7582,5575,11029,11920,3858,16981,
+    16986,12362,17895,15755,19135,18987,5195,17426,1554,1555,2576,18585,3337,5594,6076,11765,
+    10626,11093,10070,2443,10336,10281,1821,11243,574,13236,20001,11314,11225,20484,19214,4597,
+    9300,10071,19361,3914,11137,8761,9749,1166,3915,15488,5595,10529,10130,13910,7431,19269,
+    15231,15249,15250,5273,8767,10264,17899,3608,3805,18588,14832,20037,19657,4648,19517,17378,
+    14041,8102,7268,7357,16675,12499,18038,6423,20156,12667,11658,5938,10283,501,19363,20318,
+    8551,18568,4649,5418,4289,3634,10030,14094,5511,11619,2197,3704,19916,14215,11024,1611,
+    9215,11285,942,11924,14089,10813,7395,13105,20366,13591,8616,17098,7584,4058,11227,10440,
+    14493,17571,6295,18531,4821,544,17139,9384,9501,2616,9821,16676,11691,19364,7151,18266,
+    11205,6963,18050,5877,5916,19254,1655,18220,15493,5494,6650,17597,9096,14100,6330,3560,
+    16812,4067,13098,13199,20011,18331,15816,16080,7837,20287,6769,9823,9827,114,3130,14793,
+    10589,8617,17860,10267,12668,7055,11681,15538,16576,16681,5422,16990,14217,8079,14673,12275,
+    7457,3582,20214,13016,11625,17201,16854,20048,4856,5726,10466,6066,15299,11973,11195,15791,
+    12559,9303,18051,6428,7217,12078,6727,6796,19748,13644,20544,1214,3619,5940,6331,9302,
+    1369,6032,5577,11045,17202,7104,9103,12508,15541,19734,7699,5106,343,9981,20546,18594,
+    15952,983,3166,5768,5428,18065,11740,18455,8408,5232,8479,5126,8730,4517,4079,15817,
+    8965,2107,3957,18066,18838,15013,8494,5067,7108,6432,1823,7274,10117,14285,1615,11320,
+    16388,13565,15141,8248,11608,10943,5142,7158,16521,13469,10891,15084,18539,16602,16292,14986,
+    3437,14218,15195,7522,1236,14796,8785,13994,14101,8619,13995,14648,3197,8524,8319,8899,
+    15496,15738,19143,5769,2787,5385,13071,6658,19615,13201,4085,4825,16837,13829,13965,17294,
+    2139,19627,17805,7956,15762,5110,15237,3104,5291,15741,7373,13470,8993,6023,14433,20530,
+    2931,12277,2725,7552,20601,15963,16580,11831,4686,5037,17348,9140,14631,20222,11390,5235,
+    1413,13857,11776,3730,19961,9579,10781,7402,14679,2260,8620,19736,11632,3785,14133,14860,
+    11489,2585,18848,10822,18680,9580,4335,10290,7229,9234,9760,18278,2359,12599,5695,18849,
+    10893,13516,780,2110,5519,18964,8327,6049,12382,17349,12080,14825,10375,20015,18308,10291,
+    518,18959,15708,13083,3768,12383,18960,7890,6349,13471,18961,13226,9581,20676,3199,11957,
+    6663,10344,11490,16165,18716,18962,13548,13567,12959,5780,20346,6602,11098,18729,12521,14969,
+    12600,3248,3674,19450,993,15766,15742,2861,15465,15648,12987,16698,1224,15606,5292,4373,
+    17447,5436,17108,10271,7893,10010,18357,17448,18604,5398,10376,13615,10120,19245,6036,10701,
+    4940,1793,3501,11196,10087,8970,11937,11938,10088,14842,2279,15507,1128,15143,10347,5954,
+    10546,16935,6250,11335,6531,6596,5546,3973,16438,18094,18335,19577,13693,6936,1620,5816,
+    14567,18730,630,10448,13649,15087,13601,18544,7408,3139,15164,6848,6852,12522,17354,14577,
+    9396,6092,19001,10724,330,18634,12680,20461,9023,1324,17394,2112,10953,20609,15340,13650,
+    9937,18419,8310,8181,3984,6671,17008,9456,15508,4268,16238,18420,11660,7117,17516,14599,
+    19011,14392,19012,8909,17733,10221,20518,1679,7911,14497,14421,15307,9296,4602,13178,10475,
+    19494,13696,18105,9775,9861,11743,15471,8814,1103,15904,15988,15651,12135,19375,13653,14236,
+    22,12332,14171,19150,16906,18242,12923,6051,14237,14402,10872,14415,13654,13019,13,11236,
+    1981,1920,11246,15718,1173,10397,4473,2892,5239,5863,16137,20610,2793,20092,16820,4149,
+    6983,5649,4446,20665,14657,14718,14290,639,6897,5963,4987,18283,4386,9397,20084,17517,
+    13478,9939,18425,2114,9692,8431,9712,16617,856,14509,18873,16894,5615,640,788,20101,
+    6776,7984,13578,13386,2774,10301,148,9548,5582,5524,18573,1381,3718,18503,4989,9940,
+    12411,18747,11567,6365,17299,1493,11787,16091,6366,9602,9462,9399,7085,5029,2263,9487,
+    19979,4277,12162,8670,17455,1192,6902,2228,2116,15154,11143,14717,17788,16062,10302,14603,
+    10552,13387,5158,8910,8412,15308,1750,4304,3962,17083,17871,9952,20681,9996,7811,9835,
+    11350,13934,19617,19599,20473,17016,5786,6074,6681,17361,13984,9040,2343,14759,17649,6736,
+    2264,18462,5446,17215,13935,4831,18427,16544,20748,8252,17017,8976,20102,15511,11497,18896,
+    6906,11693,2654,5978,6997,15864,11177,6265,11202,15515,14256,12064,12065,16007,9615,16146,
+    17252,3349,5824,10456,13074,14252,8521,19783,2265,18120,19738,15342,13353,14530,1496,17221,
+    8189,17772,13446,15120,20302,13101,5357,665,13319,1337,1338,13896,15033,11714,9151,15516,
+    13217,13211,1685,7283,1686,5680,6813,8530,1536,4320,2380,5464,14065,13937,11352,5119,
+    19156,9369,5465,4116,5244,5304,16315,6685,13320,16147,18949,9644,8373,11026,18760,9183,
+    10355,19335,2623,5791,19385,16714,18904,8740,13794,17146,9259,15402,20630,18508,5985,1156,
+    8978,2941,17828,192,5743,19786,1340,9959,2569,2605,18150,14322,11500,7504,14442,12341,
+    6176,20569,8926,11052,5014,7131,3874,13214,6266,14294,5986,1953,14447,14139,3062,13227,
+    20351,8347,865,8927,10275,13667,13940,10310,11025,18435,18436,10188,7136,11868,681,6385,
+    5218,12998,2370,15774,14664,18322,18323,3308,2188,6096,7248,8434,7716,35,11730,20574,
+    15519,866,4709,12073,18437,889,8268,3826,1182,10065,6705,15580,9843,19289,9700,8833,
+    18578,17651,9558,14119,20120,18442,3212,15441,5906,16725,11218,13558,802,1346,10568,9337,
+    6565,11757,13219,1689,4714,871,6105,16419,9518,12368,5174,18445,12943,8850,7249,16564,
+    18446,14303,15584,16727,5702,17162,20311,9407,8353,3312,3688,5569,8354,13945,9295,18447,
+    10248,6399,8983,6707,18449,3904,9168,18185,6571,19105,1354,2519,12794,6635,8390,3689,
+    13987,18978,20580,3947,13488,8611,8391,2272,12616,18517,12075,3635,4838,12755,17554,5253,
+    18485,13102,19296,9723,17545,8709,10277,13372,14513,2636,6883,1397,18486,5256,253,20335,
+    8425,8400,10744,15346,9727,17229,16369,17557,4345,17561,18944,6069,774,10393,4849,2738,
+    5871,16509,16510,6015,5391,9208,19340,20435,7311,19485,16674,1779,20539,19238,19239,1151,
+    17587,11925,20157,3861,11034,7269,15668,11677,18039,9502,2069,11407,7762,11228,17379,7763,
+    11264,10628,1503,9082,4953,7827,3338,4851,16748,20038,4876,4852,15536,12181,773,2444,
+    16188,19855,20320,7889,19664,4068,225,16682,3407,9291,20525,17100,7466,14563,11286,7272,
+    11275,14470,14471,907,17628,14996,5084,20373,19490,2909,15596,13685,8963,1785,5852,20280,
+    5514,14019,8430,14951,6842,16994,5375,12711,9104,5770,17599,16873,16874,16340,18264,15794,
+    20216,17678,13755,15454,15014,10394,19243,7765,5395,8525,16192,20323,17092,19857,11683,17342,
+    5919,4859,1529,5881,7839,1608,3670,13414,17803,5947,0,14642,7109,12828,9129,15964,
+    4086,7275,16691,11741,14953,20547,14988,15359,5069,11346,8471,17498,17000,3927,1790,12913,
+    5541,15965,13858,5332,17170,8013,7523,16528,15966,17350,5147,20472,7703,2851,16692,6244,
+    15894,17351,9704,5111,17503,5773,10161,7403,2701,479,3868,9192,8213,6050,15198,15976,
+    2362,15823,5399,1505,4146,15767,6802,2226,3974,11636,12441,13084,15977,12442,16777,1482,
+    17509,17510,18095,7611,18863,4374,12776,11456,16864,15451,13602,1467,13417,16862,10894,4521,
+    15640,1571,5335,8170,20186,3271,16176,5892,3975,8974,17052,16790,5821,6853,6540,641,
+    18360,20348,15561,15145,13332,15994,11100,11101,1327,17357,7276,7281,18874,10141,13253,15608,
+    19466,16778,12447,12961,10094,5783,17012,19672,15472,3675,12526,14317,17610,9110,20347,6939,
+    4423,4750,379,5551,19120,16177,13810,9029,716,4639,15188,14604,1506,13318,3549,1003,
+    5859,16650,16143,15908,15995,19196,5311,5337,15996,19155,16861,10682,13334,12462,17751,17173,
+    10303,8915,18428,15858,12927,4571,17563,12183,9297,15997,656,793,2236,9608,6550,13885,
+    18131,9466,11372,14293,18132,14709,7624,20703,19197,5618,17946,20111,153,15613,9358,5162,
+    11146,12829,7282,9958,8253,13390,2324,19426,6557,16015,16016,16017,18133,16612,1810,5827,
+    1388,17820,14535,12780,17527,16319,12205,7715,2743,3350,13527,6816,3878,14070,9052,18905,
+    9156,15039,13424,3852,3680,17528,17224,8432,10125,14645,18151,7204,10164,7255,6872,18432,
+    18906,18165,17147,8379,14499,19352,1158,14327,16024,12751,2242,8934,5932,20330,16721,9266,
+    15478,18166,16661,19678,5992,2474,11055,8380,13002,16359,7842,17184,7138,1885,2714,17758,
+    5346,8435,805,12940,8841,10574,432,13089,9702,8301,140,17255,8117,14032,9089,8857,
+    9524,7642,9079,17541,16042,16728,9415,17837,1162,12806,19108,8436,2274,7653,1844,4839,
+    7517,1539,10256,14639,8438,20338,8441,9279,2328,18946,19655,19683,11173,19850,11276,1613,
+    18990,41,15607,5178,7625,7636,4161,17846,242,2993,17848,17669,20794,13981,3588,11204,
+    2052,7852,19304,3022,12143,18524,12169,11533,311,11230,1486,6532,11188,3201,2046,18742,
+    19467,717,3023,353,1004,2048,18639,18670,3215,17281,1621,11028,11041,11601,7289,10585,
+    14409,10608,8489,12864,9964,3728,10004,10629,4354,15883,17489,4436,461,14099,6651,4679,
+    18655,4439,13596,10612,2825,11999,12717,12671,20675,14701,15953,9983,7942,12008,15853,4726,
+    15978,8661,8667,11706,6150,4365,19966,504,12681,2113,3202,7484,6442,6533,3933,11512,
+    7866,7409,7844,1931,16144,486,9836,7041,9854,13138,15614,10018,3326,15040,12263,6780,
+    16167,8842,3216,9121,11192,11545,1024,16043,1856,15525,8168,1857,12708,12721,219,3701,
+    12493,6294,1098,20538,111,4432,20469,4867,9868,18586,7826,970,5488,17317,18261,5712,
+    20470,19167,8087,11032,2781,12370,20195,10627,456,11408,7397,17900,13592,11274,16184,15251,
+    5534,9216,3806,11442,10844,17722,18647,4611,17157,7358,2577,974,8005,16335,10998,5727,
+    5363,6837,5278,19665,6233,17238,13306,14430,12907,13825,15009,8516,3196,16189,13645,8044,
+    19856,18832,14344,18712,612,9982,15954,7549,8889,16193,18269,14270,8448,469,20056,17383,
+    13244,8786,5143,16341,7164,11186,3772,16529,283,11832,10823,782,18336,8328,9106,6526,
+    12132,8210,17355,5038,20739,10234,1414,17862,20068,19863,17295,10207,1096,2291,13449,9130,
+    2911,9783,5547,20694,4957,15554,3929,15743,19002,16789,20292,9999,15641,2015,16399,15144,
+    17332,10754,16620,6439,5475,714,18605,18609,10089,1272,17692,14349,998,10476,5650,19013,
+    14172,9875,19014,2478,18887,13655,5207,12186,18106,19771,1174,5213,9953,7240,6760,10553,
+    19600,1330,154,149,5210,2338,522,7626,666,657,5825,11728,9152,17023,15034,17754,
+    9048,14028,16549,13839,3322,6909,4480,7565,3207,5987,8054,16355,16715,14423,16356,17181,
+    11013,11592,6097,11071,10213,9120,10777,4869,13836,9519,14425,16421,10249,12795,5719,10778,
+    9802,16366,11886,7658,17075,10384,20597,9687,9507,18820,14213,15420,12494,4237,3047,8550,
+    201,6127,5414,2839,2037,4286,7312,18694,11897,18695,1461,9857,4557,15846,4006,15669,
+    7025,17287,848,753,356,19080,7585,10150,7586,15355,6516,10073,2558,11583,15537,5723,
+    16375,12130,9221,2497,18052,98,11626,2927,4069,17076,16081,944,2198,4614,6481,13432,
+    11682,2167,7853,12787,13597,13506,17910,20795,6429,10417,13307,9351,607,19749,19750,7588,
+    3636,9388,7061,6890,6659,8787,4872,16253,20217,4583,17343,16900,17600,16968,9828,14219,
+    20290,12317,18270,17209,396,3586,16489,17679,16194,5185,4888,1824,16995,293,11321,8535,
+    2618,18479,5882,15674,3439,1664,2852,15854,15821,1661,7704,10081,474,14989,16392,1974,
+    5112,17080,17388,12517,17105,8454,8732,16903,4087,9306,17288,15967,9235,8662,7112,8949,
+    14387,14404,3983,15360,2933,11587,19555,13206,10423,18864,7376,1543,8332,15676,13625,15509,
+    14862,1978,20866,540,1616,5580,11843,3511,8214,1418,11844,541,15380,9587,2261,4809,
+    17449,2956,480,9142,12324,11457,11175,12735,20557,12325,3637,7145,12443,3234,7038,6037,
+    18803,10056,10095,2095,17053,14754,16791,2508,12962,10426,6541,15562,13040,5784,16648,2016,
+    6610,20439,1468,8975,12686,16204,3272,19054,17296,10774,5552,18361,18743,5822,13062,13208,
+    9319,13661,12928,14393,17697,15652,15859,19780,7123,18429,9862,14659,9322,14605,8822,8457,
+    4899,19835,12144,2391,7619,19658,17698,52,859,13869,1442,8224,20420,2237,7091,17877,
+    2344,2238,11861,8680,18463,14395,12533,17085,155,8953,10156,19606,18291,5691,18374,15618,
+    9621,15830,2744,16907,19427,17225,12606,2662,9157,9053,12456,14259,5828,4909,11729,7205,
+    3681,7128,9329,6177,6016,7206,62,686,1159,12610,19336,2624,6875,5000,14560,5993,
+    5746,13218,14328,14851,1999,18764,7139,9520,870,13886,15712,20822,8385,16103,20639,17087,
+    13044,15775,4279,8575,3217,8851,20133,12969,8702,19291,12458,14815,4917,14302,8304,9416,
+    9525,8858,19294,8437,18397,10254,16452,12461,4840,2717,19298,5757,4744,975,3005,984,
+    5606,19972,11550,335,12798,8880,15313,0,16456,11993,312,11333,3748,2559,15731,11140,
+    0,0,15326,5535,9222,17911,11629,2174,272,7524,1435,1709,0,2650,10208,1080,
+    20490,11637,718,20267,19772,0,2178,18367,11943,16309,9482,2878,11147,10178,20421,548,
+    9197,19435,15867,11502,2550,15733,18385,17468,4280,2488,13536,14839,14840,5116,1437,13585,
+    12390,13511,1373,1374,13048,13603,14203,13525,18558,13956,9567,4219,18529,535,3971,11004,
+    14830,18584,6477,13492,19462,2920,4043,10707,2886,11605,14948,5665,14982,19820,19240,10170,
+    602,11811,9365,17197,9301,1462,10613,19139,3708,4070,4516,14834,7026,7027,12710,15597,
+    4071,14835,10614,3357,11232,6728,15301,2447,10714,9304,510,19801,1972,10616,10617,1216,
+    14838,4250,613,2450,20069,3491,11833,9737,11201,18208,3644,5670,13451,18731,10619,7706,
+    18077,9307,13452,3013,1868,5672,2621,20492,6156,15382,6732,1681,1470,15217,8568,6167,
+    1262,9330,3042,15162,9200,6745,6747,1887,11503,3034,3036,11475,6960,2580,13862,13863,
+    20103,17944,10786,10689,3048,575,6921,9034,4355,4437,7323,20243,16227,13338,16921,11103,
+    8768,17592,1594,18592,207,7028,7589,11816,16171,2349,608,18053,8774,20737,2043,3919,
+    20375,11287,11446,4295,7857,2156,17125,19928,2562,19802,3620,20016,14712,7362,6238,3814,
+    7363,13309,6433,17077,19492,927,10944,19897,18493,7223,12677,14713,14998,17925,6925,15548,
+    5922,14505,17630,1791,20070,5359,17306,10138,3175,7234,16531,15052,15088,9987,11480,16532,
+    14271,4021,8805,20085,2400,3373,15897,13251,8496,13831,5781,16302,18107,532,19629,4810,
+    14524,3820,9852,9144,1717,6357,14865,84,1797,642,643,10427,4730,3288,3428,15563,
+    18683,2364,17308,20328,2294,2540,13574,20188,1803,18888,5477,3935,8293,17612,1575,15112,
+    18804,5011,15678,5787,8018,6495,18247,18121,9488,13192,7627,1808,16008,4798,18134,15654,
+    6267,2049,300,5969,9323,1307,13834,11106,2895,2472,843,14510,19634,795,13580,2302,
+    9816,18152,20743,1854,19635,19514,14200,13215,12728,2987,9490,9491,10561,12342,18319,18464,
+    5833,4124,9055,9401,12231,9332,8502,16323,3824,2551,18341,5344,27,304,16324,4799,
+    4973,11065,18918,15523,18172,18512,11486,8607,8834,13900,2610,9186,2943,9187,8351,844,
+    6394,1724,17642,17095,6943,19882,10067,8865,6113,8358,6414,2901,17096,18469,18327,12622,
+    18521,14514,2905,9820,9730,9731,939,943,4933,226,3609,2739,3611,266,267,12264,
+    6224,19341,19342,10036,2733,11167,6922,5805,4884,2199,9224,4379,10536,6234,6843,11391,
+    4383,21,3441,5237,5151,631,15381,1871,12105,15989,26,16590,5245,5866,5246,19386,
+    2346,5248,16594,17822,11668,5250,6877,64,16802,5868,8859,11560,5325,6915,11436,4311,
+    11288,20261,7677,12523,2378,12742,19454,4703,7681,7682,20270,19457,4710,19654,3218,10435,
+    11898,18408,18697,441,19647,20160,11334,5279,18411,5287,18067,948,15367,5288,134,19551,
+    17387,6522,5293,18681,8131,3712,4266,2702,11206,4147,12524,13620,2704,9593,19557,10176,
+    8681,7086,17018,6547,11213,4834,91,9512,16977,20234,2663,94,4715,8860,10625,3049,
+    4331,16922,9974,15447,19953,11926,19039,14836,16430,3331,16749,16122,11231,3920,3339,10418,
+    10467,13612,13751,19140,10339,11199,3749,10373,2530,10076,10042,7795,16381,7968,13756,17574,
+    19858,17726,13512,6083,2470,19803,8106,7364,13566,17920,13613,10135,10537,20376,19756,19757,
+    10318,13757,18956,3006,10867,20677,20678,1504,19476,17102,909,10269,9390,14288,15017,10227,
+    3040,2853,10789,10471,17106,1710,8107,7553,10590,19829,14918,17601,17438,10543,20202,10538,
+    19742,19864,10090,14371,13444,5152,5782,2862,1698,2401,7555,3442,9938,16395,15979,8249,
+    8343,6603,13333,14866,4998,15383,8648,13776,12448,9111,17297,7253,19872,8671,8344,14318,
+    7559,14000,14291,3192,644,11495,10642,6028,10873,9594,18108,6984,1112,20246,18748,6029,
+    9876,16229,16824,5896,4999,19246,2125,6542,10142,3236,5478,17055,14875,8156,4388,13064,
+    10057,17019,3627,15772,10367,1900,8185,10228,15729,7987,2657,1546,7874,14192,16179,12451,
+    10562,10482,9925,14001,19387,19636,18153,2961,7972,10563,14011,2243,9451,1720,9926,11556,
+    1632,4945,10181,5796,13069,11572,16025,12232,11731,20353,2758,13556,14012,9076,1538,16325,
+    7799,17823,17028,15042,10597,9160,4969,6700,17834,65,5998,19537,6627,4716,19681,12612,
+    10107,1902,13194,11021,17186,17761,6101,10193,10330,11595,10331,8852,8119,7649,17069,10332,
+    6114,9527,10199,9417,4841,9945,16106,1995,14640,7802,20357,10002,7056,9137,18865,14024,
+    19376,7661,13707,17971,13541,19917,5471,13543,18453,7516,20223,6844,2402,3264,32,6876,
+    19428,19069,250,13675,3068,11921,6130,20652,4290,15884,19692,7992,4356,16117,3667,8103,
+    2643,9858,13241,2531,7590,8775,4010,10419,3459,6080,7805,20012,11929,7781,7029,849,
+    3474,17323,11409,19693,17384,14309,20415,1517,3340,11200,17494,7144,3921,3625,10539,19477,
+    7365,18839,7858,15253,15254,2826,19511,19758,3483,4080,10618,20377,8285,711,11084,11609,
+    11344,9225,11289,8553,11684,949,11685,13513,19225,42,8788,9391,15015,18562,8789,8124,
+    1948,7941,12678,20293,8081,4892,3492,10752,11975,9582,15549,43,4498,16393,16817,17389,
+    3137,11347,15968,8536,5432,14023,16196,12188,12426,15500,12219,18078,7943,16533,12737,1400,
+    8458,5400,18732,16534,16200,9993,9829,18545,1520,1532,15768,9308,18472,9984,12738,17511,
+    13252,8238,18866,1794,5689,9544,1584,6604,11105,14136,20558,7945,11366,17358,20493,7957,
+    1665,11848,20740,12418,9145,7680,957,3076,10428,2958,6543,5336,9595,49,14319,12743,
+    8640,447,18284,3303,15856,11849,9771,15384,2914,10757,484,11940,1585,13041,17402,3025,
+    3078,3203,15261,6993,18363,737,7913,658,15609,14029,19781,3274,16207,2655,14756,10776,
+    11395,6617,2873,14570,1277,14877,11944,3352,3936,17113,12748,12749,9863,4572,10900,14253,
+    3447,2180,9324,14066,14609,367,5653,11425,15569,13167,8601,2393,14849,16209,16009,8922,
+    11214,15517,19177,3289,19712,7875,8287,20422,12422,4992,20425,1341,11949,156,11353,9370,
+    9554,7800,2058,1588,18316,8603,796,11950,10506,11951,2340,20709,12423,2149,9777,6184,
+    13360,8503,12607,19429,2759,6701,16153,9161,3082,14539,5834,11216,19231,12207,2777,8835,
+    6721,6818,16168,19618,12233,3327,6628,18914,20502,5319,7917,19389,8572,7895,1956,17838,
+    12753,2664,17997,6746,11433,11434,18919,11579,3533,67,7881,6568,18920,13045,10194,11291,
+    2191,1019,17654,9882,1091,16327,8120,8577,8610,20137,8853,8861,3690,12756,11292,18398,
+    8866,9418,9419,10576,1029,13975,4842,8397,19281,17421,13726,13721,8723,12894,13466,19078,
+    14090,11799,14410,9870,16677,17661,16248,11812,11813,20006,525,3299,20196,12871,17858,13686,
+    18656,20049,14891,4072,4173,10286,20796,19921,14274,10133,20881,12560,5602,20374,13537,14310,
+    2170,1299,10232,9666,18791,16461,15822,14884,11562,20378,4937,16195,19929,6350,4420,19759,
+    4421,13996,7113,13568,4251,8237,2854,2685,6087,14682,11845,4728,4828,20828,9246,9589,
+    913,7118,2686,19967,9588,1325,446,19727,5893,18635,16138,18243,20616,6093,19773,4101,
+    19055,15826,16349,17611,19938,17869,10096,14051,2866,499,20565,19782,18554,6259,4425,14606,
+    14057,9879,14440,4226,17057,11862,18915,16096,6178,14115,1342,2606,4970,14329,8741,11056,
+    10246,2697,8843,12797,19109,14780,19299,8632,12955,18787,18704,8654,16693,12326,5265,15079,
+    16897,14039,12837,15080,20653,1265,4312,18040,16249,902,10884,12468,12469,20179,3894,5227,
+    19141,7854,10374,19922,7155,578,19923,18833,10288,8011,329,11411,10817,8790,18595,20774,
+    11412,985,9226,10540,1700,10885,12318,17575,20862,20057,19930,13880,7467,20656,6067,6140,
+    1617,15018,20071,6068,5294,18230,20602,20072,6926,12848,3247,17926,20294,5951,11047,4188,
+    15980,7840,8459,4022,17247,13997,9667,8239,4318,7168,14748,1673,15108,13418,13998,17335,
+    9772,9596,4731,20867,12850,20521,364,284,6157,19939,20093,8242,8641,11367,7867,914,
+    1872,20829,18875,14205,9739,16442,17872,16145,738,6367,4112,11498,11123,6940,20189,20700,
+    16973,1626,2706,15700,16316,20623,18897,6374,17024,19812,20112,2710,6505,6168,4407,4408,
+    4705,12929,14323,12953,6380,7813,10648,1147,10104,20128,6368,9616,14207,6179,18465,15701,
+    12479,13216,5341,18154,5835,12287,6308,14331,16557,11732,6819,20532,20191,20841,9680,14332,
+    11058,13220,5999,12791,11130,18921,11580,6395,15177,15702,1637,6102,8121,9682,809,13228,
+    12799,20533,8717,2321,17132,15296,7290,12433,15938,12434,7951,18675,13507,7195,17742,2013,
+    20512,15082,8490,12272,19508,17727,732,386,17728,910,15302,20324,6891,12248,2974,15796,
+    4893,17680,20073,2044,17747,14913,6896,2045,7277,16535,1666,7982,2322,15745,2594,8002,
+    7868,20559,16940,14206,4796,8132,3177,20587,17174,15746,15309,17336,18749,7493,12452,17704,
+    17705,14916,1497,18807,14850,2988,7505,9087,16018,15913,8134,2050,19652,8070,8069,9450,
+    1636,2371,11551,19353,2327,12258,12459,3182,19357,9442,12292,8753,1962,13804,4168,12119,
+    1969,5423,11817,5257,13631,3906,13917,10385,12630,19572,20379,9227,9392,928,7224,7232,
+    19592,289,14107,7707,5437,15020,14146,7235,2981,18109,13930,7230,12633,6994,11612,3261,
+    13433,20433,1245,2745,2381,15330,7251,7793,7252,20317,20319,8552,11357,18705,1737,4294,
+    9976,20321,15411,3231,6141,16577,258,14275,6235,12350,19667,14356,17289,20487,18995,5603,
+    5186,16603,1237,614,580,6591,17981,3105,13312,13600,2431,2790,20326,10673,1711,4656,
+    8795,12278,10446,378,14893,14104,4088,1219,519,11323,2451,20660,2855,9236,19372,11079,
+    4089,4617,3672,6435,4317,3713,13716,10033,11674,14820,6527,12437,9393,10462,712,9830,
+    4958,12567,1742,18239,17748,16345,584,12438,8259,2750,16583,7065,12682,14358,12988,3626,
+    8082,20386,15047,6151,2453,5191,1225,20205,7983,8333,632,13281,2620,19869,1227,4025,
+    19151,15113,11176,8672,8461,7436,4811,6611,5117,15022,16205,20094,1674,14276,13777,20392,
+    20868,16588,13420,14970,1228,17395,4424,8047,4303,1873,8126,4375,19152,11135,12016,16589,
+    6612,11701,8335,20758,586,659,660,4501,14475,4783,18684,6548,2707,4665,1748,19876,
+    12419,13276,20247,9603,1005,6163,9146,14278,7709,4113,19469,4666,7958,12062,12023,7710,
+    2082,4812,18971,1231,20785,1032,19380,12282,15291,9791,2542,16545,13087,6686,17058,719,
+    14361,16444,16352,11646,19784,16795,5557,17947,20395,19068,2096,9696,15801,3118,14030,6268,
+    6985,5829,16796,10145,3720,2027,20444,11513,3938,20329,5830,12285,5479,12476,10378,12113,
+    4743,8190,13811,9483,19160,5315,14613,19101,1855,4392,3800,13088,19879,4606,10964,12115,
+    16592,2325,9436,11375,3239,8829,673,20570,1934,13283,1753,20400,12147,9402,8377,6558,
+    1085,8689,5994,674,2803,2244,17366,11397,1148,20446,11466,11557,3154,18922,10403,15156,
+    19388,13284,4971,17956,5620,1389,7988,2303,11651,19351,6185,4946,14260,9484,1233,9622,
+    10902,14378,2326,2992,14379,8557,3278,9030,16558,1020,10314,13285,2665,9059,2553,2944,
+    4158,6629,10457,8197,2517,6823,2746,5837,14362,8504,19263,16565,9629,13800,19264,11961,
+    11190,11962,11191,4324,7511,3254,9624,17414,1033,2626,13131,20408,9408,12033,8941,1087,
+    20275,8355,13813,8392,8199,18772,19104,5219,19792,14485,14816,10976,1888,6282,18212,11963,
+    14726,20452,20277,3658,14198,20276,12122,20583,14728,9638,9528,6640,15293,18451,18935,8360,
+    9422,12296,8946,8401,12040,19111,20177,12620,8947,729,3282,20808,8718,14079,9808,18452,
+    19113,20585,18945,10261,2782,3668,13500,19694,13508,11091,5280,8618,16252,20657,10814,2389,
+    19637,12000,19516,581,314,15891,13245,7806,12973,3888,615,2351,18347,19698,1764,14500,
+    5631,211,8796,4298,7474,11687,10544,2283,19521,20264,8663,14226,14919,8797,15981,14229,
+    5438,15021,20611,1220,19092,20227,9143,20462,273,8537,3897,3567,12568,5352,8996,16400,
+    4102,8997,1154,7171,8734,19095,9604,7412,11854,2365,286,19601,9147,20741,7174,5043,
+    5690,13143,13144,14610,740,12963,10359,5480,16975,20742,5633,6687,19262,2183,8683,16716,
+    4034,11126,494,4707,16896,4393,14614,12542,6506,1187,20466,14617,10242,13146,3902,19326,
+    7814,6781,10507,13147,13148,11129,16031,9003,6783,8057,1036,5751,13946,20747,16422,11131,
+    15159,10980,8862,20890,2810,10981,14923,8440,10279,14038,7291,16112,4558,19885,7293,18648,
+    6332,1290,20258,17203,19067,5424,18677,5281,15356,12872,15697,15671,12509,10670,20598,15070,
+    11036,3991,6338,13854,2108,11413,19828,13246,5429,20017,6236,3843,19144,12874,2563,7062,
+    14220,3752,14386,2352,7315,19218,259,7076,4018,20074,2200,20664,1864,5433,19219,8621,
+    16126,4090,16694,13517,953,20381,12564,9237,20382,13443,4336,17631,4091,15257,19805,2503,
+    1975,13647,20165,16297,20797,7261,331,12601,10545,13923,20824,8125,7165,12880,5192,16699,
+    6977,20297,1869,4772,274,7612,8108,5548,2212,5733,4522,14651,6978,8016,6849,12683,
+    4258,9831,17109,528,16396,4098,4505,3140,12917,14920,18240,8596,16700,7556,17009,4252,
+    3014,15048,14047,6773,16462,5955,7613,19968,6613,7560,1718,10350,19810,9670,1675,12527,
+    13867,351,15049,16540,5735,12305,4540,16895,14755,15076,16649,5443,16139,4103,14954,14292,
+    3304,8243,4026,7172,5609,19940,17396,7279,3963,6358,17033,12889,20701,1545,3393,8823,
+    9693,8999,1876,12713,13445,11855,11856,20519,11857,15385,12109,16406,13835,15512,11909,14684,
+    15386,4367,15437,534,20508,1114,5044,2366,9764,9357,11910,19579,661,2144,9255,10323,
+    11788,12283,14848,20702,4990,20759,15998,20624,16838,9012,7087,3775,13049,10430,18889,20731,
+    3676,9694,17020,18368,13408,11959,17025,16445,6551,7914,16409,13042,10324,6169,3276,1841,
+    2879,10431,10369,19019,16710,406,14067,12477,720,5759,4525,2239,10353,15615,4201,15572,
+    15066,4604,10379,16655,8977,20704,763,19198,18249,14760,4754,20121,19199,1630,1339,2512,
+    16210,19020,20732,16949,18482,15643,4526,17059,18433,7132,18155,20497,10876,347,4706,11215,
+    20273,6559,2161,12695,13986,19125,16212,2341,16019,12930,14662,4208,19161,1549,4410,13023,
+    5561,19260,14720,16413,14257,19814,20744,14663,5870,1120,675,3981,2304,8690,14380,17463,
+    16099,20746,8571,7566,12117,9961,19984,9681,10649,11558,8928,10243,17118,20733,6186,13322,
+    14333,3684,9699,542,17879,13181,10598,17707,12177,6040,16426,6386,13280,16912,12781,17119,
+    14337,12210,19431,20873,19947,13363,13149,9163,18923,3653,9060,2150,20848,6706,12826,1391,
+    13054,16913,6000,5683,20804,16032,12179,19211,2475,13610,6003,16157,13221,6630,6748,5752,
+    19338,2248,16729,6879,690,2612,18178,11062,14338,18179,13287,16954,6400,873,12090,8393,
+    11735,17189,20806,11881,11383,17763,10577,8630,16666,20807,8122,18580,17030,8578,16278,1356,
+    6919,9529,1357,18402,1104,12807,16282,20817,20809,9844,8719,2718,8429,8590,8987,14035,
+    7287,18672,5410,20249,16243,4433,19066,6221,15350,8098,6317,12861,15532,19136,5415,2104,
+    11402,13237,4351,10665,12865,20735,9750,3836,20002,15666,3745,20362,19819,11033,13844,16376,
+    4332,16678,4059,8962,20792,13501,16118,19918,20158,20254,327,4060,1965,13439,18041,7152,
+    2489,350,12908,6964,8009,12824,3003,5184,5941,4504,17101,6770,9824,7591,6838,15044,
+    4536,16522,7550,16901,16125,14297,14649,6339,14742,6144,17001,9238,18358,17002,11906,3769,
+    2140,13407,4983,13608,15501,10320,13830,538,1865,14680,9353,12712,20687,19574,15373,9688,
+    20507,20603,7909,16439,6534,10348,8410,14749,10377,6152,19116,5956,14048,3387,3268,759,
+    16397,4600,20491,5758,2863,9671,715,10424,19003,7119,4195,13020,19811,3976,2332,4403,
+    1328,8673,18110,6544,857,11540,9954,8566,18369,14376,10593,13180,16656,9049,13354,19424,
+    6739,12089,12206,5744,6873,20805,3993,16679,4357,3996,12725,3997,11955,954,11638,16492,
+    19684,4368,18370,18375,12424,16232,4835,20849,14541,1183,11952,15734,18393,8579,14548,9530,
+    4844,15426,15425,4347,15429,5125,9782,9778,4073,10231,3621,4654,20344,7366,10008,4682,
+    10420,4360,260,4771,14750,7557,4099,13575,17453,19673,20830,4773,20560,18876,20095,109,
+    3628,8413,13893,14058,11461,9880,9359,262,3630,8691,1498,15619,667,6387,19430,1833,
+    9363,6187,7567,10315,19682,9795,11470,6204,6210,9724,17582,10265,12125,2445,10115,17598,
+    18628,18625,3863,212,4380,17646,4683,12131,19305,4381,9239,18079,20383,2770,16875,12173,
+    17930,16398,12918,12766,12767,12175,5736,14373,16401,18111,17653,12145,12066,18753,4527,6998,
+    14581,19025,16020,3686,13325,3881,13326,8960,8576,4529,11067,12184,1405,18783,4589,18054,
+    1825,15716,3844,5430,1787,1788,2353,4092,16197,511,18080,8279,18081,11416,9240,9366,
+    20075,12602,16054,16644,16463,15982,16131,7885,12250,5957,5887,16536,13275,5444,6734,2798,
+    2367,3797,2708,13277,1804,20396,6619,17060,1809,11514,20705,15362,5901,5481,5316,5342,
+    5167,157,11543,18167,8929,5483,196,9164,11338,12259,162,3654,18168,6004,17070,2715,
+    17762,8511,8510,7835,10044,19724,11821,4615,4618,4616,3039,3015,3554,13952,13036,10698,
+    10699,3257,8593,14949,20658,4518,1511,5233,19145,244,11417,17927,14105,12642,6436,7475,
+    6057,1925,8526,9773,6260,14579,11160,9467,11070,6761,11262,19470,9469,6191,8533,6106,
+    18581,10578,5704,3580,18025,3051,17774,2429,14145,12319,19146,1765,2532,2533,5431,4537,
+    19957,11233,10945,2535,19806,1530,9241,19865,18631,15318,9035,9394,19962,11001,14885,3568,
+    17333,14929,4751,17032,8903,5240,13626,9112,11603,7175,7494,587,2833,5030,15679,17021,
+    11610,2229,3085,10828,14977,7441,2240,8133,8988,8191,2241,8923,15730,8192,8930,8935,
+    2245,158,13605,14152,14956,8198,10970,19985,2554,11016,12265,10858,14957,14959,9423,18823,
+    18819,19668,14102,14216,18112,14238,14110,19674,19675,12976,18010,8541,6128,12496,7920,1204,
+    4435,971,5763,5799,17972,12866,16596,13010,20242,19044,3243,4352,12905,4287,1251,15756,
+    1428,4678,19919,5100,4007,3784,3862,11297,11265,6517,3737,20511,18589,10666,127,7921,
+    12770,4559,18829,15696,17672,11814,11443,12079,15939,15940,3807,7922,7193,14491,13561,20178,
+    19624,16630,13564,15598,20259,3004,2560,3809,227,979,12596,14837,463,4746,14461,20654,
+    7995,19924,10864,11627,20679,4138,11266,19751,16293,20882,11299,6482,13617,19925,377,10615,
+    12561,5536,7855,1762,18332,16924,17573,9389,3131,7729,9504,7218,11085,17344,11244,8031,
+    17921,4860,5068,4441,3135,1706,6800,16855,16856,3563,117,5376,11518,10808,20680,4889,
+    1662,14912,19931,2354,10078,16638,2355,16639,9907,9906,6239,16737,10994,8045,13107,19318,
+    11822,10769,10270,11046,9711,15397,989,15699,15374,16877,6845,7231,18632,5370,2409,9107,
+    13310,14990,10082,2111,13569,12081,2735,7525,2292,16876,16774,15238,11269,1667,10796,11719,
+    3173,15239,10935,10785,11479,4687,9784,8798,8950,19628,2363,6937,9010,13990,11458,783,
+    9763,11519,8597,8182,2079,2591,14863,10797,7169,10681,8290,17809,17356,12881,13570,2141,
+    4151,4148,7377,3786,12136,15400,3141,11459,5026,20695,3075,15770,10122,10827,20440,1798,
+    2280,9788,11158,2867,85,16792,10775,13931,13966,10726,19193,20187,12978,3512,13122,15114,
+    17666,6672,15564,6854,18733,6443,3273,645,1438,4196,16402,10874,10351,15320,14715,15181,
+    354,12086,9673,15321,14199,14607,14244,20494,4477,18122,1042,9041,6261,11462,16651,4389,
+    9677,878,11153,1443,9609,5032,11247,2005,794,6762,4031,14611,10502,16010,20423,9697,
+    6814,18474,9653,20113,17163,2100,9198,15041,11376,10878,2008,9054,2369,4910,16553,14710,
+    3682,19982,6817,13359,5529,2368,13076,16446,14304,3901,18383,13323,20407,2571,8055,11057,
+    15214,8936,682,18511,7637,1992,18169,7541,8299,8957,13182,15215,4711,11872,2374,883,
+    17185,10784,15776,19322,16420,806,16841,8063,8302,17368,9526,6112,19222,9818,12621,19323,
+    9725,10839,19223,1552,11996,15759,4874,19308,9162,4870,20669,6831,10946,1904,6353,4385,
+    1905,10325,10965,20026,20058,4466,6673,3016,19936,16879,14476,19787,7321,16377,18698,1252,
+    17729,18706,1826,16132,16133,7336,18750,18805,16839,7442,7341,16781,13457,13462,13491,7313,
+    13758,14506,13864,13784,14867,14571,11754,11755,4814,5684,14876,2029,14007,16206,15860,20210,
+    2676,2019,13308,17976,3721,11169,14494,3671,315,2020,5187,3753,294,582,9642,20163,
+    6660,1170,9242,20327,19373,3410,990,16298,4493,2021,16198,9508,12444,11254,15983,8034,
+    4104,19349,3964,8674,13421,18744,8462,14991,18877,15565,1006,10210,10913,7383,5831,13822,
+    7915,764,10646,3028,3187,369,1261,18156,14180,1176,1196,9470,2515,17165,17759,1834,
+    2763,2627,12170,9561,17998,6281,6710,6107,10197,11882,9563,9531,1360,13978,4509,8989,
+    6518,6560,13198,17499,4093,11611,17538,17553,1199,1207,18009,8549,14946,6789,39,10687,
+    14886,6790,6950,11354,15351,18016,1292,10317,10262,4282,11987,18824,18825,13429,12428,3240,
+    5591,11893,9969,20670,5942,14281,20027,16429,11438,4049,15205,15533,15812,19910,11922,13297,
+    15667,12094,12838,4050,7967,7022,9499,16982,6129,12314,11805,17374,3837,204,13058,16743,
+    6322,5636,5637,3726,15880,7583,4609,20003,19137,12315,169,1918,10037,17285,3802,12896,
+    5180,2220,18262,18623,750,18026,12293,15534,8762,11478,3471,16374,1429,1167,20363,14202,
+    14739,19046,12785,9217,14468,13430,2783,10364,12405,8769,18559,7850,10630,462,375,4612,
+    10416,17973,17974,7458,11574,13079,8006,10999,10845,976,903,13300,16892,17723,16250,508,
+    5419,18350,19475,3095,7359,2996,10938,4291,5512,11620,10074,4061,13593,4650,603,15595,
+    4062,20542,10039,3706,6424,10005,10006,224,2171,10530,20590,2823,1735,6333,7153,9385,
+    2277,10924,19004,17138,18410,12435,4459,10468,8776,12909,18330,4512,12096,1303,1559,18834,
+    5197,20671,9097,15818,6334,4885,2209,6587,2172,4627,4857,9977,1268,6797,6798,4074,
+    18707,20288,20595,6726,5917,18221,1269,3622,12903,12983,1822,9994,15010,20197,11994,20322,
+    17204,5728,4011,12669,4247,2430,7156,16832,2030,1200,7157,3561,115,12216,1738,12844,
+    6652,14741,5800,11628,8777,7057,8517,13918,20456,2446,6456,12813,609,19368,12217,5943,
+    6335,2645,18948,12910,6020,16813,9825,18412,17205,7105,14345,18222,9895,5425,20260,17743,
+    3246,15542,8655,3167,4016,12847,18271,5289,565,1076,19169,2788,15102,14286,14287,1656,
+    1561,15819,838,15955,4538,8791,11718,20380,10541,8792,20459,20863,15234,12510,13247,14367,
+    1562,11359,7433,10079,10173,16834,7159,1519,13514,7674,17385,14965,18596,2415,4807,5144,
+    18629,2416,6460,15423,14221,11037,13415,16389,8480,4081,3438,10542,15706,6968,10715,10632,
+    7782,8320,8900,13691,15739,15142,16254,6084,18597,18413,18353,4592,2109,9991,9992,2211,
+    15375,7166,2856,12597,3106,6528,20754,4742,8280,9583,7404,15602,7678,10949,8211,5295,
+    11721,19244,4401,5039,4094,9761,1415,1866,14134,2075,19575,10155,1117,228,8664,15106,
+    955,5148,418,12364,7539,15969,12320,2829,6927,11720,2647,7078,12220,14472,4519,5645,
+    4657,9243,3770,12323,79,15432,539,20244,17352,7374,6529,9174,14553,13859,14841,2703,
+    5579,11834,5296,2360,14681,2090,622,1436,5730,3817,8329,11777,10174,11633,15456,2586,
+    13270,5731,17439,17928,14894,11835,15376,1221,10700,19843,15288,7296,14928,9785,705,18209,
+    10175,1041,11293,3084,18415,18416,18417,16530,13108,12472,7861,16493,15399,18799,18734,4189,
+    8971,17049,17050,10725,1226,15744,2123,16537,18717,736,10049,82,3502,9832,18421,8260,
+    8261,6731,10349,20887,20888,20775,400,12960,16085,17810,83,12603,6535,4100,9691,7170,
+    11336,3930,5439,5440,5476,17512,15089,19743,20612,16440,12882,4467,11965,12398,10272,5817,
+    13520,11722,4269,3114,20265,6674,15555,994,15466,11171,6354,5549,19320,6440,3269,17749,
+    14289,2227,12684,15467,19765,8149,14971,6027,16086,13651,11939,8368,20696,17664,18965,10091,
+    19117,13924,2864,20438,4795,12790,17126,1377,7749,8183,5640,6755,9457,15556,11197,18669,
+    14173,18338,13656,2115,13697,19121,19774,8481,12989,10177,8815,12726,14277,19015,8816,7439,
+    15990,365,1921,16961,15115,9313,6094,2915,12106,20776,11688,2403,18967,1926,18878,8035,
+    11210,11723,11724,10678,14026,16059,3869,19153,19871,6545,6256,13086,1175,3548,10236,5198,
+    14350,19775,10477,14174,17013,9314,16060,4692,8455,12924,15727,4275,2422,13657,14600,9813,
+    13021,14374,17054,485,17734,4960,646,20729,4988,20892,14895,1229,11329,8370,2607,6359,
+    8675,13523,8473,18879,9293,18426,10554,2982,14896,10034,15000,1982,11368,87,8911,2230,
+    16092,11639,12474,7088,2117,6995,15513,15167,1193,18898,18123,20646,9074,647,9549,17034,
+    1081,19602,8567,12163,9955,17403,9256,6355,789,4991,5128,2799,14245,9605,13481,13388,
+    2800,10398,17175,9956,1007,2874,2404,19744,13526,17114,15610,5554,150,10273,9463,2295,
+    20168,1119,11666,6758,10304,2231,10929,5970,7563,18287,6682,10882,13873,18244,5031,1572,
+    5616,13254,7985,12110,9853,19309,19406,12160,3152,8954,9195,7986,33,662,8684,15573,
+    6269,12067,13629,3650,10182,11161,1384,2916,17253,6815,13051,13052,8602,18754,12227,1932,
+    5654,6552,9898,19157,381,18614,12605,9617,12817,5979,3519,14761,3798,7628,20834,3639,
+    12991,3875,8193,14009,13050,17309,16950,4202,7629,2658,15829,3119,14068,16554,16148,9400,
+    15655,13447,11863,6553,19200,14353,9260,18907,16211,15732,6270,5452,14117,11053,8604,17064,
+    19201,18899,16066,5249,389,5200,58,15477,5988,5989,6381,2189,16443,15403,10399,18157,
+    8643,6740,1157,13528,12167,8931,7871,19026,2458,14811,14583,17128,676,19532,14354,16269,
+    3683,3063,16717,4708,16718,13897,6695,5201,5402,13113,16760,17178,17756,290,14194,13898,
+    17182,3309,11593,15578,11014,1884,9892,12999,11552,14483,6388,19337,1579,19788,3591,10856,
+    18438,4411,2270,16559,11869,3632,6622,17027,8160,6277,742,2990,10311,8381,7137,1179,
+    10380,12457,12288,16357,9067,11162,16326,14261,9654,18173,17029,16672,8697,18174,8289,8608,
+    6910,2805,20023,450,14724,17760,10571,5792,803,3655,14196,14542,15168,12460,12234,15628,
+    9338,5995,11165,4413,19205,437,8854,13901,1939,36,9201,19339,17071,12369,8356,6108,
+    15292,15918,13055,13056,11876,5382,9521,14208,15178,10198,19208,11652,18817,17187,6396,7264,
+    17072,10514,12544,14209,7265,3986,10977,1038,12796,18186,16364,18774,7425,8984,8961,18325,
+    12171,18394,9409,15074,15588,19106,9273,12614,17713,3691,10109,5175,8139,8394,6401,2666,
+    9963,8631,8580,5907,3948,19948,15633,8165,19588,5705,8710,6403,10255,8612,5711,9803,
+    6205,8167,9639,6579,13115,14731,8588,12714,16575,18200,9728,10159,833,5505,5576,9541,
+    11104,9686,14043,16523,12050,1976,5520,16929,2397,4095,16930,16936,9546,5581,18745,5241,
+    6807,7488,5033,428,17406,19583,19584,8135,867,16154,13944,1836,12498,2950,6296,12500,
+    3052,13638,16170,7592,19695,13459,18678,5102,20659,5426,5878,10171,4496,14282,16172,1304,
+    13687,17977,9859,16487,3731,3484,213,1766,12003,15672,15673,13060,357,11447,19084,19085,
+    7675,11823,15016,18305,11824,1134,18996,7597,5920,12321,11825,20200,17290,5203,10633,15424,
+    3864,3865,5188,4593,19333,4177,12773,7034,4082,1707,3161,419,16342,10824,14703,12470,
+    18601,19493,11634,1740,18660,5297,5086,7476,8799,4184,12775,19464,4619,11453,11454,16299,
+    20384,2955,839,911,4658,19522,12565,13460,14932,9244,4688,2587,4689,18418,8800,1619,
+    12569,10592,4468,2213,5923,5924,9988,4190,17606,15305,9108,20298,17868,16303,8262,6803,
+    8806,18096,11640,11782,5056,13461,17931,15435,10547,12445,12280,4941,12446,20086,9919,8538,
+    19706,6465,10755,14049,11846,16793,7039,12528,13422,18551,6468,15189,1521,285,3446,5154,
+    13894,17081,3934,13576,13577,4150,16403,19685,15827,4105,8676,8463,648,1927,18968,18636,
+    6986,2592,17397,14972,2935,15190,5925,15747,19942,14137,3776,7384,10305,11858,11859,18890,
+    7711,8294,10211,12138,14059,15999,9765,8824,3026,14900,14685,8221,5118,5159,18891,366,
+    3787,11463,15474,3318,18124,18973,14403,12691,12087,13063,10829,12385,15611,9013,5045,15341,
+    3109,3515,317,2875,15438,1138,17637,18481,5015,1331,3079,8295,7876,6987,16623,14978,
+    10060,16951,10326,18755,6942,13701,17061,5832,17459,721,12964,15475,4203,19021,10146,15644,
+    4117,12992,16657,18615,12534,10019,16180,18371,13663,1842,14582,20303,20706,14762,4204,19022,
+    8157,10183,8298,3206,5558,12478,3029,8825,15749,19124,12634,10727,9468,2097,12931,18430,
+    6737,337,8464,11257,14071,16021,2215,16022,19027,15720,8932,14181,302,12934,12935,6275,
+    15802,16911,5168,12343,17952,560,5655,14615,17995,3251,10704,5317,5562,4908,9864,10483,
+    18158,15684,18434,14707,20171,1177,13196,11960,9941,14924,13391,13798,1197,1722,2883,159,
+    9623,15624,20129,14618,1577,11544,12608,11467,18765,6702,9794,9471,12358,20172,18324,6743,
+    13959,15687,16560,15405,19716,19740,9890,9855,5018,9333,10022,16026,2246,8693,9943,16561,
+    1475,19608,9997,16503,10572,20816,14072,12482,14708,19986,11380,11381,6878,12611,829,9061,
+    11219,4947,16101,6309,20427,5838,3788,8505,7639,7640,6001,18295,1347,6824,13364,10761,
+    16566,15831,1843,17226,14073,2000,1638,2628,8743,16730,13365,17999,7208,2460,1350,11953,
+    2164,16477,13483,9817,12345,18484,1308,8844,19412,17073,8942,20331,19393,16624,9998,16731,
+    11883,12945,6636,10216,5220,13004,6109,20581,7008,11596,5264,10405,3694,8581,7007,8307,
+    10459,8711,2127,8863,12488,10982,9532,3255,16572,20316,9424,8867,9425,3950,17773,552,
+    10736,4717,7533,18403,13947,16047,1141,12623,12705,3256,1142,9935,12626,7009,20339,20534,
+    17154,5801,11040,11300,11096,16775,20206,9909,3602,7725,10406,16162,16805,17434,7796,19050,
+    12652,9245,17107,13925,16300,15053,16494,6938,16308,17298,5559,15616,2711,1832,15620,2713,
+    20515,5380,12624,17853,18206,1053,4313,18699,817,1279,17901,13301,1593,4012,4981,3841,
+    13954,6961,10668,20161,2561,18055,20198,20164,7030,20013,16640,12771,19926,12873,12300,7058,
+    7671,18997,10134,1305,171,10925,5879,12772,6437,15255,9284,2504,420,11277,17746,20885,
+    616,13442,14551,7477,5331,17140,16902,19804,17922,11181,950,2769,15317,4178,4984,20059,
+    20076,12774,11234,18068,10045,15235,10671,4599,17103,19699,12562,470,4985,16055,10880,986,
+    956,4221,1770,1767,8014,12878,6772,6462,6664,991,6974,3565,4442,12985,20295,4894,
+    18231,1102,9109,7732,16843,20463,2619,16937,8212,7933,10928,13928,6466,8240,1676,8735,
+    7526,13521,11700,4469,18113,18867,19807,9309,12529,12765,6360,18114,1057,20464,13999,13255,
+    12768,8890,8904,8951,8017,6605,3992,1315,649,8216,14683,19057,9250,1771,1419,1874,
+    3363,819,9011,13411,11308,11309,3774,18969,9814,5046,17454,3204,14806,20104,7381,17990,
+    6361,19969,4774,7934,11958,14807,14757,4198,1840,16706,739,3027,8222,3262,16908,16909,
+    5338,19058,382,403,4199,18751,15165,17456,5897,487,1952,9674,11294,2543,19175,14416,
+    4605,2434,5697,12932,19059,13022,10703,7284,14394,303,15191,1773,13168,10932,18376,7043,
+    12026,5700,8021,8924,8374,8685,19730,13665,9678,18159,2995,16722,16271,15625,821,1195,
+    6180,12178,13232,383,16447,707,4125,6623,20447,6624,2372,6278,2552,19232,3685,1015,
+    16501,16765,841,12819,9942,8382,175,19390,4974,1206,14334,11059,1319,8959,691,7070,
+    2625,13902,14561,692,8386,11734,13003,20024,3283,13903,15322,13801,277,16664,1028,1606,
+    8359,9420,16076,16280,8398,19731,2521,7518,19300,13672,6642,11239,18197,8442,17314,16163,
+    15932,17744,3966,14522,4225,3987,4215,249,5323,6207,6212,6646,4792,757,17500,4895,
+    7603,11529,10046,10292,10293,10395,13762,14108,1314,9789,7614,10298,14921,8916,17752,20105,
+    7683,16063,13335,15476,16149,14869,18761,8417,3524,3237,12308,11263,6389,10484,18439,4642,
+    12584,19585,7140,4800,2747,6708,9796,12649,6569,15524,7650,12588,9799,8422,13559,2811,
+    4805,6644,4789,17488,4882,10284,13739,1311,8407,7593,6340,16056,2791,14864,18746,4640,
+    7129,12644,6832,12502,7059,2284,7604,20077,1512,6240,4659,2593,20617,2830,13382,5673,
+    12687,4474,13778,7012,4942,4569,1983,7013,6053,12531,16794,14246,10830,6170,9610,20114,
+    19456,677,16799,5565,13392,4574,20134,17148,1994,16035,17962,8873,7654,16045,17547,16049,
+    17375,17562,3070,4174,12503,12504,6889,5394,6336,3643,17242,2975,5461,1306,14697,16927,
+    6969,17923,12875,17259,18272,13341,11932,15236,6341,17243,18273,3440,3847,17328,17662,14159,
+    13549,18279,16752,7605,16581,10790,1565,18602,20018,16857,3754,16776,1481,13472,16256,13099,
+    20520,16970,18082,18083,14268,1713,5262,13522,5300,17010,19808,20387,19899,4631,20618,20666,
+    19525,4693,4191,6606,3017,9247,2831,17647,8807,10756,11235,20266,4337,18097,7482,17750,
+    19495,17932,17933,12632,19671,11641,633,16865,12570,229,2454,20798,14652,20349,2175,19707,
+    18546,16972,17216,18115,5858,5305,13779,1275,16607,13658,5364,1291,4635,4943,12688,5964,
+    6988,5674,4253,16464,15473,13524,20268,15023,10237,19527,10492,3513,5894,17401,16858,4775,
+    3604,933,14914,17939,8599,20299,8083,8025,15828,18880,14716,6369,20106,12887,2296,8475,
+    3448,8090,3545,13785,14993,2595,488,1332,18665,7947,12251,12306,13953,88,18806,16609,
+    1680,7042,16407,15800,15909,4426,14161,1048,5971,7241,14016,19836,14017,3205,5692,1471,
+    13991,6999,7916,12576,2266,16584,14324,15439,16317,3799,1721,14443,18135,10877,18292,2986,
+    11482,20566,1385,1547,20514,6375,11791,14531,20498,15574,7415,12412,3120,19901,19382,20760,
+    12024,20567,9026,6688,1988,5214,9776,13551,820,5708,11524,18756,3030,16952,11532,13795,
+    17065,13796,6054,5681,3525,20207,2881,16660,4120,11745,14979,6696,11911,18908,20631,20426,
+    16097,5990,18251,92,16320,10720,1578,3968,20306,17613,17529,5836,17066,4485,11124,11792,
+    10596,17829,15621,16844,14722,20235,13361,6625,11669,8195,5860,6100,4452,18440,10238,16593,
+    10312,16100,12149,1550,17161,14768,14262,370,1754,12027,13799,6763,19028,16723,5345,14665,
+    17708,17709,20148,18768,804,2276,12425,8694,10508,10569,13393,19718,10495,6631,19391,6944,
+    8937,9472,1160,11150,5001,16069,20576,160,161,7094,19719,17960,5530,6785,9928,1501,
+    5172,5657,1392,16953,19432,13224,16036,19458,3313,19904,10763,8387,3456,18395,7643,6194,
+    20857,6880,1037,6005,20449,15834,19417,19472,13814,12260,14544,19418,11750,13611,17074,19354,
+    14547,2633,14339,16365,6197,6914,7209,19587,10734,17884,68,19540,11504,5933,5685,18187,
+    18188,13366,12810,11075,12091,20504,14455,5624,20238,5221,69,18399,6711,18928,6641,6012,
+    3221,19722,17121,19297,8613,13560,15635,1398,8877,17963,771,19723,17548,3537,1891,15637,
+    1892,17765,1361,12811,18328,8403,1607,16667,10985,5720,19301,18202,2638,19547,17558,3230,
+    17370,6314,3065,4162,12853,6118,6951,5460,14696,12808,13336,11914,15221,17258,18011,17231,
+    6315,12856,6751,5937,11136,7452,17315,10787,16962,3429,9774,16849,14154,3965,13465,3743,
+    7579,19893,4676,5258,11615,20790,13805,16863,19486,14267,19794,2815,20211,2166,12551,19661,
+    596,18027,17896,8074,8594,13740,4767,13639,6227,5872,1648,20285,13502,5666,2578,4623,
+    12665,4927,17198,18042,19851,4241,16458,1287,6044,16965,20215,7031,15792,18788,12244,15887,
+    4418,18657,5944,8088,14014,14156,3544,12407,20291,20751,11114,3198,20548,3791,7905,15543,
+    18713,13989,13545,2976,1371,9019,20513,14311,14518,13546,18069,10591,1566,3008,5856,6665,
+    16643,17159,17806,15603,3493,18850,17042,1322,20604,80,17504,2857,10235,11530,16931,10497,
+    2631,14230,16701,17684,361,13770,12011,10295,7081,9921,19708,6614,10494,14526,19416,12223,
+    8371,11744,7620,17524,12088,19529,1604,4677,12004,5434,16173,6245,5445,5090,5401,16027,
+    16028,6062,9062,5130,3222,9426,3164,6729,11900,13763,8736,2740,15343,559,13938,16417,
+    3943,20138,20144,17559,17560,13709,1966,5883,15207,18084,15208,18085,6530,216,5497,3503,
+    1922,16490,5785,6546,7926,4254,7489,4029,16000,860,5211,18900,20307,6448,3879,16029,
+    1016,15656,5747,868,2806,20711,3883,18180,20031,415,1298,118,11455,10674,11418,4620,
+    10676,18662,2957,10548,14111,16880,5737,8217,5306,5208,10555,5160,10058,8682,10831,588,
+    18814,6449,15146,10000,11468,16030,3528,7510,10570,1914,14545,5721,7663,457,19752,18991,
+    4175,1101,4591,14702,17924,5190,15398,11586,6088,3714,14507,4826,19374,19963,3601,20388,
+    13771,634,20619,3603,4959,11531,734,9896,2506,13623,8109,3819,14930,17934,1743,10050,
+    5333,635,9597,9193,5965,4255,11522,20620,6491,17014,19409,6855,4276,19307,6676,18372,
+    17250,19837,13454,861,862,12532,13455,2040,19310,20231,8346,19285,2216,1548,13399,14870,
+    11310,4528,16318,9911,6689,14325,4205,14573,2267,2268,20115,6171,19633,3238,7133,16859,
+    2126,19178,408,19247,8348,3982,1181,6188,13630,18170,20448,4211,4643,13130,19392,9063,
+    18175,287,1591,15406,20131,20503,807,19129,19437,2613,19292,17539,11762,13367,15408,18450,
+    7141,4342,16330,19311,699,3223,13887,17546,13400,17122,9448,4344,19313,454,19745,4165,
+    18983,4588,1100,19365,16288,280,19625,6078,20039,3707,14503,11584,730,4624,20367,4820,
+    3600,6653,502,13752,14927,4954,8105,2498,10043,3810,5330,17912,19407,20060,6484,5948,
+    20599,9191,9575,19306,20600,4249,7110,12518,19830,8342,13450,4192,3235,6153,13883,13398,
+    2214,636,20228,4523,11306,2565,8345,3977,20496,4200,20442,13128,19383,17530,19286,19126,
+    19436,13362,18441,4343,1780,15970,13473,10722,15024,16140,1622,5339,1633,19729,16213,14619,
+    20769,20768,8778,7294,4176,19666,4314,11901,13342,12439,18306,16344,2157,7606,12352,1741,
+    2158,1596,1597,3018,7378,1483,2773,16134,19526,7615,19093,12571,6257,1745,1928,4752,
+    17160,20621,14897,3389,9113,4321,14377,2297,16064,19676,14247,18317,7416,6690,12750,14644,
+    2145,2345,9611,12645,2659,12480,20632,14765,12582,1812,5842,12235,12211,6911,19355,14817,
+    3593,19280,19282,20778,11168,416,8012,7859,3332,7607,4019,1583,6597,3758,20019,14411,
+    19090,245,11836,19091,12133,15289,14473,18098,10895,9248,10139,230,2994,8001,15259,6441,
+    2160,11283,11967,20389,7379,2913,19970,4023,11207,7485,13313,1031,10826,7483,8808,4507,
+    17940,6158,3412,16350,6804,3413,20300,12689,8032,20411,4961,12449,8171,16465,1799,9598,
+    11523,20096,6469,14922,1113,6675,14435,12191,650,16258,3414,6159,7413,6370,13870,15121,
+    1984,7242,10956,16546,1082,17142,2379,10621,13871,9000,18553,6859,1877,12197,10594,14444,
+    6691,11864,15750,15575,2131,7000,6271,10960,7385,7386,9766,9612,8649,5698,7499,1751,
+    15388,12694,14735,1010,20786,12286,17992,2300,20707,1115,20708,11396,20116,19873,2917,19980,
+    18762,3377,3351,2034,18556,20190,2882,19481,1589,2009,6692,4755,14616,7443,4121,20787,
+    3031,11526,12965,11125,14766,1280,15183,6626,2696,2395,11794,14448,12150,10903,2897,14769,
+    6279,10968,11217,9298,19290,683,1835,9625,9064,2305,14585,2518,14263,16102,8173,6192,
+    19987,12152,2807,11220,20712,8938,550,19327,10905,842,15179,7422,2748,1247,16274,3687,
+    1943,20175,3328,965,2307,2308,7644,7645,9202,14419,12212,7572,11751,9032,3329,2314,
+    8118,19356,2462,696,697,20332,7512,1940,12261,3333,1889,6200,15869,19110,10906,9203,
+    9122,19989,8874,20141,1358,1945,3281,15636,9427,9204,16281,15638,20802,8404,16736,12800,
+    13103,10986,14456,12625,7046,2316,2408,16107,8169,7664,9205,13496,4563,2536,3907,12566,
+    14784,3390,3391,4570,8465,12890,9815,34,6172,7417,14633,7965,8531,17462,10147,7815,
+    12585,9473,8534,3396,19988,17565,14787,2716,18487,18941,1515,17320,4934,7672,15600,19086,
+    16773,2500,17040,3709,12876,13311,8089,13860,15209,1567,2505,3494,10675,11837,10011,13038,
+    12879,12055,20432,5396,5521,12604,8110,2832,9249,2507,139,19809,3715,8084,17634,11348,
+    481,4660,4661,11279,20390,12950,3504,231,20241,20020,17685,7862,18099,20087,13780,11642,
+    3569,4584,7410,6898,4862,5307,7754,12690,20229,19257,20097,13453,9025,18892,13423,18612,
+    15401,18315,19711,15387,4152,12386,20232,10832,8642,19713,19581,9027,20628,5902,15440,2146,
+    5047,7790,17993,11374,12114,4993,10901,11647,4813,491,9767,11189,9002,13043,12966,6412,
+    17614,16321,2028,2282,2099,4486,18617,5403,13874,4209,20633,4122,15657,523,19565,18766,
+    15658,14666,4712,19790,16215,19029,9626,6825,1499,20434,15629,6041,17166,19721,6912,19586,
+    1050,8523,3884,3656,9166,4489,13222,7794,5753,18001,6283,20505,3575,18929,6712,5406,
+    8583,11328,8875,8878,9533,9206,1513,17312,4923,17036,2484,12867,20430,3475,9752,13035,
+    5392,4652,7856,9505,20240,20014,18056,5515,19799,8779,17676,12374,13759,19255,20061,6892,
+    20218,12672,9576,6893,19704,4145,9020,10896,482,5888,4986,15436,8995,2142,20613,2281,
+    4106,6410,15653,13868,11324,19018,16208,10897,9613,19715,9158,16744,4662,2176,2179,11496,
+    20831,762,8296,8297,2184,17129,334,765,766,767,17130,768,305,2192,769,770,
+    1556,13012,11048,11050,1393,2134,2133,18204,12893,709,710,13676,13025,9033,2438,1310,
+    4283,11988,18673,18674,11918,17234,17892,5051,9901,11764,19215,15445,15136,20510,18409,14790,
+    19182,7100,5181,17318,3698,15881,2439,3432,5062,19732,20208,7101,19038,15489,8896,1732,
+    1528,10862,14890,20040,17902,7270,6425,1558,2490,3581,2784,11678,20368,2997,19366,14671,
+    13911,15252,12651,7214,5918,3132,18658,10233,545,6135,10692,17913,6965,20478,9098,17239,
+    15186,14157,13753,14674,11252,5495,10865,3341,7273,17090,17240,1045,18570,16524,12511,15075,
+    20325,12512,2845,2846,15103,7225,14797,3168,17982,19735,14997,4873,15892,13760,1695,14222,
+    19345,12762,3958,8901,14401,5921,8731,4740,8330,520,2418,7608,546,5774,2481,9584,
+    18603,20224,7114,18851,2130,8142,15457,14801,18086,2452,19040,9786,557,11117,18735,2651,
+    14300,3344,14314,17450,2023,1744,14751,18868,13694,19766,18606,19191,3505,760,5052,3506,
+    16201,5818,12525,2705,2455,15510,10730,17935,4636,17693,1906,9315,17248,14436,2868,1746,
+    19041,14239,14437,12084,9887,17694,4832,19603,151,13786,1092,1805,14248,19325,19688,3348,
+    2876,9464,1752,2392,9153,20846,12825,12025,17093,18901,17948,15911,9050,7506,13797,678,
+    17668,9912,16719,14335,5066,19533,14719,3592,10381,722,725,8282,8698,19033,17714,9804,
+    8746,18028,14961,2752,11889,18494,13293,5095,18687,9965,12979,12431,15409,8096,4002,7823,
+    847,3724,16806,10663,16740,13538,338,18984,2376,6071,16628,344,15786,7459,18587,5097,
+    14465,12465,597,11403,898,13438,458,15315,2816,20749,17795,9133,8075,4883,20286,13640,
+    7993,18830,4242,5274,12270,20041,6228,5724,5490,16810,6792,16052,4900,11108,8445,6455,
+    8042,19894,8484,19184,17380,1649,3165,15945,9647,4139,15813,4075,4419,5223,8446,6457,
+    4531,7694,18454,980,16123,464,8780,19142,1077,16578,11772,11448,12377,5005,20219,14519,
+    20752,11621,8321,10818,1541,18598,1083,16432,2534,7405,18509,12189,17863,3149,17440,10083,
+    13082,475,3495,13861,7554,18797,19186,5472,8143,16435,16436,14166,14596,10473,15984,13013,
+    1979,20614,20757,17811,15797,16441,19147,5238,18498,585,10051,1491,4027,9073,18285,20417,
+    5610,12192,17359,19594,9947,12193,16974,2754,687,17218,663,19421,15514,19902,10059,13350,
+    9148,11667,2544,10184,17824,1205,8051,3939,10185,20761,8112,8958,19288,1344,18576,6189,
+    17534,1351,2406,9270,5716,16044,3945,19295,8868,18624,3053,12505,20549,11322,20262,17983,
+    4296,18714,7316,17441,20825,10012,19831,17003,3174,19763,3848,19062,4222,19187,14495,14826,
+    11968,15260,2293,5087,4663,14204,3612,1875,19258,10489,8527,2143,1908,18664,15025,20022,
+    16259,6774,1682,18339,15122,6903,10099,8019,14272,8622,11726,20833,5070,17522,13282,10919,
+    15518,9614,8414,17362,14687,11301,19563,2118,14532,20835,20499,2301,8225,14767,16322,3193,
+    5563,16976,16825,14559,12536,2119,19202,11690,7878,14182,10239,12696,1901,2396,19203,18560,
+    135,19499,5071,14620,6782,11559,1592,18924,8695,19328,8506,17882,6784,1051,6913,16037,
+    14546,3614,11060,18189,8744,7513,17542,18190,10920,13006,17190,1890,17549,9276,10257,10258,
+    10921,16782,6916,13286,10260,17555,751,1106,13764,18663,13772,13802,8724,20199,17786,9024,
+    8699,7054,7143,12506,17978,9072,2677,19648,3054,11686,12513,214,4142,19760,19958,215,
+    9735,4143,10694,2978,13344,12240,7981,2039,20662,3699,5646,5647,5149,4363,11838,9985,
+    12900,2858,14106,16127,18087,1295,13648,15134,15971,11092,12009,12543,6666,11492,17778,7066,
+    238,3732,1570,16819,3162,19094,12012,4024,11419,10677,16753,3443,7616,3345,4601,18309,
+    12057,316,13109,12839,1484,11038,3849,19172,6302,12327,11420,5008,5441,18281,7679,13652,
+    18100,20166,16087,4270,12901,6073,14496,7829,19063,9643,3507,15714,3374,20625,10850,15116,
+    13781,10429,4664,7869,9251,915,14112,4698,999,11421,18881,14113,20869,1047,18610,14846,
+    6492,19776,13717,13782,19973,7486,1316,13659,13660,17112,19650,422,5308,651,13604,1929,
+    13698,1000,20393,1800,19220,11661,15026,12059,4107,19509,9355,12017,4108,8817,19096,11422,
+    17577,332,958,6989,4603,13932,19874,10620,16088,16089,2869,6444,10643,14555,5738,17988,
+    14052,8111,7730,453,6677,15029,16821,5447,6860,1772,3605,9837,916,13787,10595,6446,
+    18288,7684,20230,1850,16473,15030,10557,8623,6164,18893,17022,12841,20859,20107,12450,13347,
+    1806,16351,16822,12692,11423,14934,20304,16499,10480,8029,17699,16263,16310,16883,7685,1259,
+    8520,6262,11481,12990,10274,17873,18248,4863,110,3089,18637,13210,7845,12063,9713,14122,
+    15,2983,5163,13065,13789,7948,12535,16550,19714,16910,19321,14763,2425,4756,5466,20170,
+    15060,9675,10102,8466,15389,16758,19158,492,15912,14254,18902,1333,3080,1011,5164,6472,
+    5450,2312,3940,1317,15390,20117,14069,17062,5656,18808,14901,4585,20568,9741,16823,12357,
+    13579,5120,9742,17779,1935,19434,7387,16410,14935,9989,11756,8686,11238,13066,1683,4427,
+    8737,14706,938,20398,19844,15091,9360,20837,7507,1459,19042,6697,4369,2989,14689,1444,
+    9768,5048,9261,449,9618,8692,12148,11702,7542,10432,20838,11377,123,11429,16414,17276,
+    20481,8626,7877,7959,14446,8226,3208,10804,2083,20634,19877,506,10966,20745,2120,14536,
+    3081,11865,12069,20500,6181,18909,7093,4815,10021,1421,14871,16023,8979,14690,4734,2426,
+    13941,19789,9619,10214,9620,5641,822,4235,8336,7929,3761,15925,10705,15404,19287,5634,
+    2731,16270,11515,6061,9028,3641,10157,7757,18377,2778,8981,5016,16358,3253,15124,15520,
+    20710,4212,12967,6280,3529,7688,1590,14770,19471,5621,17615,3279,16216,18767,7949,16800,
+    5839,15581,4213,19653,1263,12289,13668,5405,8161,14872,10599,12208,12209,5484,15061,2247,
+    5748,17835,10434,6703,3263,6698,14141,8162,5566,17067,3395,7003,19791,723,20173,20637,
+    16886,17780,10126,11198,18,7045,12120,10106,14396,2461,371,16218,8939,14397,7769,9339,
+    17710,17839,11073,15721,12941,14622,14398,12153,8845,14031,2084,1021,11221,2437,563,13170,
+    4370,20638,15804,18443,5867,14906,9340,7758,14363,13260,14183,15407,5251,19841,19842,8467,
+    18176,19031,14635,10971,16070,6450,4454,9865,7530,14164,20800,14399,16233,3985,15715,10659,
+    9562,14400,11151,20789,15158,16888,4837,17120,8982,13837,194,9944,10573,9797,688,15630,
+    9342,2809,13150,20734,17961,9630,164,7950,12154,2342,11796,1448,14586,9962,18514,1394,
+    3944,7250,808,13942,9492,16914,2249,9410,19293,6709,1198,8703,16235,16038,7816,13988,
+    551,19639,12121,1639,9635,5658,6284,11736,6007,12180,11663,9169,13223,16915,13151,1640,
+    8200,14076,9375,10764,5844,11575,14340,3692,12236,12661,17618,14587,16505,7651,6826,20850,
+    9065,12291,8507,3314,16766,19265,6198,6637,20176,2762,17280,18477,3291,7652,11074,19266,
+    11752,14937,3693,19640,3064,13368,7738,6572,3829,14341,9564,7532,6010,18930,8944,20578,
+    12213,6713,20582,8582,700,14938,5754,17842,3379,5050,2669,7515,3885,2463,496,18193,
+    70,20720,17257,2991,20403,5383,20506,6206,10983,5326,6115,12388,874,18401,8202,11017,
+    16957,6714,6715,12123,1282,20143,10407,8716,8586,6208,20811,8123,13401,11388,8308,3226,
+    14033,2154,9703,815,434,9565,16427,8071,9428,3539,9534,16762,6716,8439,1030,6580,
+    17766,1362,16454,6717,16050,4845,1180,10987,8614,2317,12627,11240,9809,20803,9729,19330,
+    10989,7665,14641,13905,8405,7052,4232,17968,19746,3050,19642,11655,9071,15133,11997,2038,
+    13302,6229,3669,2973,10151,11090,17593,1294,16814,4265,1070,14492,7468,3342,1480,20162,
+    10669,465,4358,313,12048,17745,12299,7673,15793,4598,7828,3729,6072,15069,11035,237,
+    18840,12051,19859,12052,4684,951,3427,11673,1078,987,19087,20801,10634,14552,6485,2928,
+    18599,14931,988,9228,14021,12005,10032,417,13761,17104,14412,617,10819,11414,3366,16818,
+    7843,8519,3587,9986,17329,18633,1668,6463,17777,10753,20078,2668,15019,9668,2979,18232,
+    7744,19465,20296,16083,3073,3088,16257,5648,12679,13250,5055,2980,4499,10472,19866,13203,
+    6846,17864,1375,1848,14576,106,18280,12986,20391,8497,11753,15824,8334,14704,8972,7944,
+    16538,14389,8733,19433,1923,5009,4422,3444,16904,2421,9738,3931,16754,9354,7736,6607,
+    13061,14734,8460,12354,7380,3,12139,19728,11120,2423,10014,505,11850,2728,7912,8218,
+    1420,15991,4732,9790,2081,20480,7082,20098,16260,7540,6058,11307,14525,3077,6678,7490,
+    10209,20622,12284,18364,7756,12146,14060,3516,1260,12198,20169,3275,14179,5826,5739,16,
+    3250,10123,9489,20626,3821,10100,10564,19838,1012,4481,10961,14634,7529,10962,10658,9325,
+    4409,368,18136,6447,863,12933,797,14584,9960,9793,549,18510,7246,2776,20788,17115,
+    9331,1345,7638,9088,11733,9555,3310,8383,11749,2313,12151,2760,6103,8573,5749,20577,
+    8940,18177,1281,810,8305,1359,16453,19614,1430,7317,172,3019,12577,9078,10251,19613,
+    10152,9871,13963,13330,6085,10153,17390,623,5150,624,13377,7737,7830,529,5442,13072,
+    13158,16304,16305,6536,10449,16175,14004,3176,19468,10782,19528,11349,16222,9252,761,652,
+    13073,53,4797,4478,4479,3629,1985,5462,4903,10452,13197,8244,8482,9650,14975,13278,
+    7414,19097,19098,1386,12646,9199,1422,13289,8245,17363,15685,17407,3526,6030,18910,15686,
+    16504,384,5467,12648,17738,15688,319,124,15521,18255,8269,12752,8384,3194,12724,3942,
+    14852,10972,14451,7759,5320,12754,2059,4801,3181,11912,8137,14624,4803,11553,7801,16159,
+    6008,1395,11505,2667,5755,14454,15690,14418,10148,13961,13327,17486,5135,592,15703,2055,
+    13070,15490,16285,5416,6513,10438,7804,10160,19463,10779,4886,15670,14431,10443,9648,7743,
+    3623,4460,5282,8234,7295,19088,8449,3190,18852,17353,1416,16128,15675,6024,17391,3496,
+    1376,8369,12643,5958,8263,12739,5309,14847,2456,12727,5129,5745,4169,4160,8543,3293,
+    16768,11981,15873,4263,20025,18215,17583,3155,3468,13586,306,11302,7936,19164,13033,19995,
+    11437,7187,3734,17584,18216,19818,6920,1610,3472,12552,2817,20791,20876,2922,9282,1,
+    15245,15246,438,899,4166,6323,9568,9432,1557,16808,3401,9485,10531,6768,13848,3402,
+    16378,3558,4928,18676,4243,13328,7695,12245,16815,2105,4179,610,16190,13329,13598,20050,
+    11711,3159,19048,19823,1917,16382,2720,10942,19168,16337,11303,3815,20753,18070,3301,9754,
+    18228,7367,2073,1563,11449,9229,14676,16390,9577,13599,16343,18233,20345,17602,12895,16199,
+    1839,17505,18234,13926,2771,18718,9395,15458,15459,10950,3302,14298,107,5808,6928,14299,
+    18307,4271,17451,5889,4470,19173,15898,8144,44,16135,14601,6362,19630,2688,143,16141,
+    18311,13116,12822,9149,15171,2755,6867,14320,14301,188,16353,3871,10854,3571,6182,2692,
+    16067,18320,3452,5905,9438,16039,8770,8830,8836,20477,5538,19932,14357,7551,10716,18088,
+    12736,17513,12328,12013,16860,17307,6251,4729,5734,20099,4637,7558,2181,18499,7382,1930,
+    5525,19229,9838,18757,1879,2962,14296,5173,15777,13969,4836,1941,19233,18513,6193,16033,
+    1886,9374,8700,10721,17149,19236,6288,6289,18784,18719,17151,10662,3999,13204,10636,15677,
+    3850,11245,19148,8809,1801,17578,9253,8564,100,388,15905,2936,2653,5611,15906,2984,
+    16944,6371,10647,1576,16551,19498,14976,19839,11327,10103,9257,11793,20233,6098,13279,3777,
+    5453,19534,18252,10833,20401,15213,9159,9294,3144,18378,15914,9267,13968,9268,16217,5455,
+    18256,9913,9914,19179,9372,10223,872,15916,15631,8272,18296,16071,18181,37,2614,14730,
+    13152,18931,9636,9411,2520,6285,11248,17620,251,11435,15526,3949,16160,6404,9893,10200,
+    10201,8587,8881,6116,38,3830,2523,9429,9277,71,3951,8884,411,5353,5349,5351,
+    935,12371,12372,7236,14827,19777,7238,1627,12420,7243,7244,2942,7247,14829,3764,3773,
+    7846,10247,10358,10357,424,17825,14873,6011,17843,4461,3055,1273,12058,12883,2792,3249,
+    15899,12884,12333,7120,17127,11039,239,18312,13100,10679,10558,20799,2457,333,18125,17753,
+    14686,489,6470,5448,11280,17579,937,18250,4482,14688,7001,16658,89,90,5360,4586,
+    11978,2459,12228,14955,9927,18476,14295,14902,12256,17116,7964,543,14449,13409,919,8270,
+    7391,8311,16726,12968,349,3552,12483,12484,5321,16613,10650,7392,6561,726,2779,6566,
+    15660,14667,4607,14452,495,16663,11222,4490,693,8273,14588,9475,4976,12237,17131,6201,
+    6576,6749,1406,2464,5626,16367,12041,3227,15323,6581,8406,15494,12885,4114,10143,12719,
+    4483,15576,12257,5122,1472,8275,12975,19206,13484,15585,4488,288,14668,4608,19207,4428,
+    694,15587,14342,3224,15324,3228,15484,12868,4076,5115,15566,19194,14660,7314,7318,16266,
+    16720,16272,6195,18223,19228,19195,13434,8555,11378,5843,18384,19209,11384,96,18257,16480,
+    5627,17800,3058,12409,8145,16495,14008,5088,16938,17941,16941,3460,14160,8172,11851,5193,
+    18882,15361,299,3347,2801,2545,11237,11662,9286,1533,7199,8624,5314,12200,3520,3449,
+    15577,16659,8265,13552,17953,13555,5064,3292,18809,11613,8625,4156,6473,15067,5991,8158,
+    6474,9780,14994,1634,18466,19127,5564,5169,7207,15173,15174,11590,8349,15175,20641,20640,
+    2085,3083,8350,14540,5170,12028,7879,2373,17094,12309,17957,13125,14773,3453,3532,17409,
+    15711,7792,18526,20428,17410,16360,16780,18000,19061,13171,2899,2900,6764,8136,8629,8508,
+    11561,15334,9931,2309,17715,5254,12238,4737,17256,17476,6013,1407,13007,10203,875,16368,
+    11598,9535,8428,10988,12707,17793,3057,12406,5085,16488,14006,16925,16928,15358,4721,3343,
+    11826,295,14158,5189,18841,9509,9285,11659,7196,6979,6467,14992,5301,18457,7278,7863,
+    17942,11589,5966,15170,5155,18458,18459,7872,14764,18525,3521,20424,17404,3450,10967,9916,
+    2896,13169,5252,8628,1403,13005,11597,12706,3922,784,4776,4109,16178,19561,790,13112,
+    232,14477,9115,4757,17117,13425,7509,801,14074,15586,17617,17712,14185,7760,14186,3657,
+    9343,16073,9376,11546,11547,9345,811,812,813,9068,827,13225,3952,16891,3909,17588,
+    19549,777,13106,7487,14053,14177,17700,9320,11541,798,799,3765,3659,3783,3762,13688,
+    13682,1124,6142,3071,14103,15240,19523,14347,16471,15210,12886,18869,7561,1795,18313,3716,
+    3717,14351,18310,15072,17943,20889,653,7014,14661,9356,2185,14941,14114,402,13783,3415,
+    5078,12888,14868,6861,6471,917,17701,15031,2186,16474,17638,7564,3589,17525,8562,16001,
+    1131,963,10798,3522,1084,7714,3179,14255,18758,13790,17706,6039,5049,13791,6699,20501,
+    918,16415,1086,17830,14537,3779,19607,15622,4816,3527,11102,19204,5567,5840,14942,5996,
+    6562,5485,63,14621,3853,15626,4713,1264,14162,14623,1022,4394,16155,8196,9373,14184,
+    14693,17840,19162,10511,14625,9929,689,18927,16889,7095,13153,8201,20450,13369,1813,2615,
+    18191,6199,12820,1641,18518,14669,15634,16481,19541,3854,5080,10202,17550,10518,1363,16482,
+    9810,19302,10740,13674,3067,6122,15225,14590,15206,16113,12869,18828,1781,3705,18304,6648,
+    13741,392,14095,3403,17903,3583,12814,16469,5283,8561,6839,15946,908,952,3169,3485,
+    18715,10795,7700,5040,6034,16394,4808,1258,8184,4694,14175,1326,17815,10499,1001,9316,
+    16881,7089,9923,13145,20445,10738,13821,8146,5034,16431,3870,1008,10851,664,1013,15123,
+    5092,3780,6563,93,66,4216,16275,19128,16761,3886,11581,16763,9860,18870,3960,5156,
+    2794,15262,19709,1747,17217,20394,19943,11325,16779,12902,13111,19176,15680,19976,2598,9651,
+    18613,1009,404,7621,15264,18126,12574,11761,12578,7262,11675,19651,18974,11311,20271,7495,
+    20399,11080,7388,11426,19315,6504,9258,19813,14478,4206,17639,13718,668,15295,15265,14116,
+    9326,9881,11527,14691,20122,12936,14721,3143,17179,12660,13529,7263,3590,5079,1014,20308,
+    18253,9839,20281,2608,16724,9334,7420,14153,12310,9990,8468,5171,15125,17068,15192,7717,
+    3462,1699,16801,28,9627,20482,20237,13485,11528,8228,14694,8337,20713,7918,11873,11874,
+    17535,3781,13184,17465,4491,17739,15919,11535,2250,11536,12074,3782,5845,12072,6064,18773,
+    14776,12699,16220,20715,8163,12970,14075,4759,15270,4916,14187,12037,1691,20135,9344,11386,
+    14725,16074,1203,3219,17543,19034,20765,13185,13370,8712,20139,13973,9637,16075,9800,19609,
+    10575,195,1132,814,2251,12589,698,20140,18933,16956,5659,966,14264,16573,9171,19589,
+    3330,9348,15272,1246,2945,6828,14939,17551,9806,19543,7183,18198,17844,15242,11582,20278,
+    17556,9430,9656,14729,16455,6408,13979,7428,16078,5722,8720,816,9856,18821,15243,17195,
+    1731,12553,12898,972,9646,19314,13712,14096,4170,7360,20750,20369,15294,11078,6498,18043,
+    2491,16516,9872,18224,6799,5644,9826,5074,11517,778,8656,1696,17501,16787,12301,7701,
+    11839,11840,7908,20479,20688,14227,1125,11534,20088,8150,13179,15900,187,9317,12018,13348,
+    791,9792,2232,1387,20274,6397,13971,16449,4680,15550,15557,15558,18736,4338,18101,128,
+    15065,7040,425,490,2162,14785,2834,8003,5065,12201,5482,8033,4484,15184,4542,11525,
+    684,7880,11977,18769,14305,9474,1025,16567,355,1026,2163,8064,884,10515,9066,9476,
+    16571,3225,19312,14306,14788,886,8065,9536,4382,4384,12252,7832,12242,8509,13195,779,
+    8215,8219,2795,3755,16884,12777,10016,2599,8223,879,3638,14903,11427,20635,3640,12779,
+    14810,427,669,10020,4118,3572,12937,12580,4573,16885,8266,6382,11379,20409,13426,14381,
+    14813,8837,881,20714,2808,11382,14142,19880,12698,20716,14013,6632,15283,5570,8303,7304,
+    11884,8943,19815,885,11387,9883,13139,9932,9933,13234,16958,9123,12039,12038,10737,5756,
+    8274,11018,887,9124,12801,3170,3178,10783,5468,16156,3183,5131,3185,3184,7305,1464,
+    18942,18943,4464,17531,4157,12346,4915,20717,9377,4918,13394,18934,4935,10140,6363,11852,
+    4239,8155,6038,233,11689,10144,16945,17460,16555,9014,18916,15176,11795,15442,9015,15627,
+    4308,1725,11548,695,10516,6310,16955,1903,17481,19544,18720,2679,12840,6990,261,5449,
+    15241,2985,6305,17026,3451,3517,13258,5194,15212,10565,7044,13553,318,19023,11464,9551,
+    15681,5560,9511,19221,3740,3876,10680,18616,11537,10582,5318,16214,12581,5121,11430,9262,
+    15267,964,12537,11649,4123,679,2201,15623,7389,2963,248,18618,4995,11431,10887,16797,
+    14480,429,4210,19482,7500,4669,13812,3145,2524,14450,7004,13876,5500,16478,3573,125,
+    15522,19679,20309,18344,9117,9840,15043,14786,18171,934,15582,6820,8004,4911,16273,4487,
+    5926,8540,4227,7847,16917,3378,7689,14774,10356,13427,19483,14382,12311,18770,10799,19720,
+    4996,4543,14269,15832,12539,13324,11716,5793,14905,8742,13261,13262,7848,10195,1701,8892,
+    20773,16169,18557,10835,20642,11877,19881,16479,10800,2121,6398,2966,12290,4736,20248,3112,
+    8338,3828,10836,18182,8229,9631,7344,1424,7178,9769,9271,20763,8704,10217,20718,20136,
+    10890,5635,18950,2884,13669,13533,6043,14777,5486,16803,20314,8306,20719,19411,727,728,
+    5794,12702,19413,15481,15482,18775,2102,12971,3035,5847,8985,17469,12485,12486,6633,564,
+    3535,17619,4217,13126,4325,16181,15284,5571,13815,13090,17123,15661,12118,5255,15805,3741,
+    13186,9346,9866,13705,13670,4804,20645,14727,14426,17716,3457,18527,12076,11885,15662,13091,
+    13583,8945,165,8559,5908,10460,6405,14908,12590,6577,13534,9934,16077,12540,826,6406,
+    6402,20333,6750,16890,20429,18519,19610,7817,17153,831,18936,12591,16506,967,6884,17227,
+    14265,5848,20852,13373,13374,3660,4977,9172,17228,10371,16105,19438,16508,3905,4806,5501,
+    8058,19414,13187,19545,4327,4978,18478,8747,1449,8635,13948,72,13008,6407,17031,5628,
+    13949,8882,9125,8883,10408,19793,16483,3541,9537,4846,8721,16283,18700,2678,6299,18607,
+    15211,9545,3739,217,5310,246,11643,10886,9510,18611,19479,4197,247,423,5498,11460,
+    14474,4904,6996,7841,15570,3570,15032,19410,5499,8048,6372,6808,16264,19480,16475,17219,
+    4541,8687,8925,6554,8738,13702,14904,4994,13259,5789,7686,6376,18555,12387,9263,11866,
+    20762,3778,8227,1423,4735,10834,10888,2964,7176,13530,13666,20636,3903,3032,562,1447,
+    14771,15659,15479,13124,3530,12481,4214,5841,12697,6744,724,13183,163,11875,14424,4802,
+    17711,11258,6567,8558,825,17152,830,9930,10458,18515,15632,16072,4975,13371,9170,20851,
+    5625,4326,8745,19542,4817,10926,17989,4110,8818,7301,1049,17518,4140,2959,6160,3978,
+    13027,4305,13662,3979,10481,405,18972,19944,5619,12338,4032,301,15682,6555,13664,18903,
+    4000,17667,7630,7631,11483,5714,19840,407,17526,17275,19903,3733,3980,15683,11148,2513,
+    4449,12994,9264,10400,4119,15268,10433,8831,741,20123,4450,18975,2190,12609,16556,1723,
+    2609,7390,17736,4670,3110,18911,17580,12952,17277,14936,18912,14878,18379,3290,15803,3574,
+    4758,59,19945,17533,5381,16562,6475,9118,20310,17616,14772,5456,9841,13000,10600,4453,
+    12842,6821,16887,20236,19946,9842,5386,10916,3543,9714,6476,6391,15126,5715,15282,1058,
+    15833,7531,18925,1023,7718,17254,561,16034,7719,7421,15092,7177,14775,3454,3455,8091,
+    5568,15868,13532,8352,6917,11241,9632,11469,13879,4127,95,20579,11385,12347,12034,451,
+    2967,9633,12758,6570,7423,15139,17279,18977,11878,8705,17841,20483,7960,3419,8230,13607,
+    11879,7179,18183,18184,7180,20643,8339,3113,11797,2129,4530,7393,7646,18211,20860,6196,
+    13943,18387,1814,10370,12972,97,12487,14778,5572,14779,3536,6945,10023,4128,2103,15127,
+    17470,5324,19035,11516,8231,10110,5573,18388,2041,15920,7426,3146,1178,3756,5347,18400,
+    19036,16279,15722,13671,5348,1944,14626,16221,13092,9347,6286,4671,6575,14364,5176,2193,
+    2194,18194,17764,17544,6202,8869,14853,7989,14737,14738,18195,15128,9867,6827,4396,14854,
+    1582,6287,15160,19741,166,17741,17885,11152,1815,20142,9378,18520,9655,701,13976,20584,
+    18776,15836,7659,18298,14781,14077,6829,18199,5660,702,18404,14266,5849,3695,6830,9069,
+    17552,4398,7347,16331,16332,15129,9899,20853,18937,18405,9640,15161,16333,17150,18201,11506,
+    1958,9807,16048,17964,6211,19396,18777,19546,17845,17621,11507,11019,5629,10259,18406,10205,
+    2812,19112,18938,8615,435,9538,5350,9431,13980,19114,18407,4847,12628,8722,9732,10923,
+    7292,6131,18952,10465,13641,11141,17269,1168,394,19824,4655,3099,9506,17271,16525,17576,
+    9230,1708,12598,18957,17141,15256,14044,20079,3566,4748,16878,5377,20225,4443,9710,5435,
+    15825,995,8668,7527,4695,3445,18871,16306,14752,15857,12757,10368,86,8220,448,11369,
+    12019,2128,4524,18970,14240,5555,5312,3518,4704,12475,2182,10101,15910,18137,17755,15719,
+    9327,6272,18138,6556,5340,17878,18380,19739,9371,9056,6822,7342,18917,9628,5750,19538,
+    18386,5623,10196,4843,13977,9543,7068,9265,6634,16328,2407,6639,6643,17422,2405,9585,
+    18572,2285,6304,11281,2286,11282,20402,7687,20352,6564,10244,10245,18816,9341,1580,7690,
+    9165,10837,11880,9634,7345,7691,7181,8855,16450,16329,6451,10250,8870,13489,19611,9173,
+    7184,11887,9280,17423,2287,9908,9904,5313,1507,4033,10360,10354,4035,11290,12647,12583,
+    10601,4036,16418,8340,12586,10362,1817,3953,4020,12579,10361,9851,10063,10503,5903,10583,
+    20764,11107,3887,5819,5809,7069,4864,14828,15073,5454,5682,8114,5457,13892,8688,10889,
+    1728,5355,5354,18139,12070,2570,16151,15201,10567,10560,12071,2516,1993,18640,2918,17883,
+    16219,17466,12587,10127,17471,12404,19107,8706,2634,3220,1149,17369,17416,17475,2572,126,
+    19816,2522,1150,17886,10111,19566,17484,3229,9539,20021,3889,4126,4159,10352,10337,19030,
+    2306,12650,1500,15310,20315,19949,10204,167,832,15273,703,19005,1492,15271,3059,10306,
+    10702,3061,20629,4699,4700,3111,3882,14695,18979,11472,1425,4397,11954,18980,14589,14711,
+    13895,13888,3880,3825,15689,235,2965,15269,20174,12613,13606,13703,18666,13704,14980,15835,
+    10914,7182,6042,7427,17477,15093,14078,16046,16423,17482,8591,566,17737,12538,5094,15915,
+    15917,5469,16735,3538,19459,16916,15735,19460,11066,10746,11860,19505,6392,20644,6203,6209,
+    11800,6173,1774,1599,1601,5322,17300,18297,16732,385,19394,16733,1302,1726,17472,7446,
+    14907,9274,9269,1915,12704,16734,7931,10979,7346,17740,2153,8246,18818,1957,18002,10838,
+    19395,20766,12636,19180,17483,11154,3540,15779,18203,2165,20767,2906,1959,7142,17337,1760,
+    1595,5298,18282,7440,9254,380,14898,20627,7927,18810,2147,12635,15778,9403,11259,4575,
+    11260,17473,9421,9443,4576,7777,2465,9281,2466,9381,4564,7773,4912,12489,834,4881,
+    19103,2086,5327,7662,16668,18940,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+#endif
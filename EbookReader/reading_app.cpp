@@ -1,43 +1,79 @@
 #include "reading_app.h"
 #include "bottom_bar.h"
 #include "user_config.h"
+#include "src/display/epd_trace.h"
+#include "src/font/glyph_cache.h"
+#include "telemetry.h"
 #include <Arduino.h>
 
-// External font declaration
-LV_FONT_DECLARE(my_font_chinese_16);
-
 // Menu items
 static const char* MENU_ITEMS[] = {
     "返回阅读",
+    "阅读设置",
     "强制刷新",
     "返回书架",
-    "返回主菜单"
+    "返回主菜单",
+    "性能统计"
 };
-static const int MENU_ITEM_COUNT = 4;
+static_assert(sizeof(MENU_ITEMS) / sizeof(MENU_ITEMS[0]) == ReadingApp::MENU_ITEM_COUNT,
+              "MENU_ITEMS and MENU_ITEM_COUNT disagree");
+
+// Settings rows: font size, line spacing, margins, done
+enum { SETTING_FONT = 0, SETTING_LINE_SPACE, SETTING_MARGIN, SETTING_DONE };
+static const uint8_t LINE_SPACES[] = {0, 2, 4, 6, 8};
+static const uint8_t MARGINS[] = {2, 6, 10, 14};
+static const int LINE_SPACE_COUNT = sizeof(LINE_SPACES) / sizeof(LINE_SPACES[0]);
+static const int MARGIN_COUNT = sizeof(MARGINS) / sizeof(MARGINS[0]);
+static const uint32_t SETTINGS_MAGIC = 0x53524245;   // "EBRS"
+static const uint16_t SETTINGS_VERSION = 1;
+
+// Screen area above the bottom bar
+static const int32_t TEXT_AREA_WIDTH = 200;
+static const int32_t TEXT_AREA_HEIGHT = 184;
+
+// Blocks cached for a text font picked in the settings
+static const uint16_t BODY_FONT_CACHE_BLOCKS = 16;
 
 const char* ReadingApp::BOOKS_FOLDER = "/books";
+const char* ReadingApp::CATALOG_PATH = "/.reader/catalog.bin";
+const char* ReadingApp::SETTINGS_PATH = "/.reader/reading.cfg";
 
-ReadingApp::ReadingApp() : label_content(nullptr), menu_container(nullptr),
-                           menu_items_labels(nullptr), menu_items_names(nullptr),
-                           style_initialized(false),
+// Index of `value` in `values`, 0 if it is not there
+static int find_value(const uint8_t* values, int count, uint8_t value) {
+    for (int i = 0; i < count; i++) {
+        if (values[i] == value) return i;
+    }
+    return 0;
+}
+
+ReadingApp::ReadingApp() : BaseApp(ARENA_SIZE), label_content(nullptr), menu_container(nullptr),
+                           menu_title(nullptr), style_initialized(false),
                            book_path("/book.txt"), 
-                           current_offset(0), page_num(1), total_file_size(0),
-                           estimated_total_pages(1), last_key_time(0),
-                           boot_press_start(0), pwr_press_start(0),
-                           boot_pressed(false), pwr_pressed(false),
+                           current_offset(0), next_offset(0), page_num(1), total_file_size(0),
+                           book_mtime(0), first_offset(0), source(nullptr), index_timer(nullptr),
+                           back_head(0), back_count(0), setting_selection(0), font_count(0),
+                           text_front(0),
                            current_state(STATE_BOOKSHELF), menu_selection(0), total_menu_items(0),
-                           bookshelf_container(nullptr), book_labels(nullptr),
-                           book_paths(nullptr), book_count(0), bookshelf_selection(0) {
-    memset(history_offsets, 0, sizeof(history_offsets));
-    memset(history_valid, 0, sizeof(history_valid));
-    memset(text_buffer, 0, sizeof(text_buffer));
+                           bookshelf_container(nullptr), bookshelf_title(nullptr),
+                           bookshelf_empty_label(nullptr),
+                           catalog(BOOKS_FOLDER, CATALOG_PATH), book_count(0),
+                           bookshelf_selection(0), open_book(-1) {
+    memset(book_path_buffer, 0, sizeof(book_path_buffer));
+    memset(index_path, 0, sizeof(index_path));
+    memset(back_pages, 0, sizeof(back_pages));
+    memset(fonts, 0, sizeof(fonts));
+    memset(&settings, 0, sizeof(settings));
+    settings.line_space = 4;
+    settings.margin = 2;
+    pending_settings = settings;
+    memset(text_buffers, 0, sizeof(text_buffers));
     memset(status_buffer, 0, sizeof(status_buffer));
     memset(last_status_buffer, 0, sizeof(last_status_buffer));
+    memset(shelf_info, 0, sizeof(shelf_info));
 }
 
 ReadingApp::~ReadingApp() {
-    cleanup_menu_ui();
-    cleanup_bookshelf_ui();
+    clear_book_list();
 }
 
 void ReadingApp::set_book_path(const char* path) {
@@ -52,65 +88,124 @@ void ReadingApp::init() {
     menu_selection = 0;
     total_menu_items = 0;
     bookshelf_selection = 0;
+    catalog.open_folder(BOOKS_FOLDER);
+    
+    // Widgets are built on the first visit and kept (hidden) afterwards
+    create_ui();
+    
+    // Show bookshelf
+    show_bookshelf();
+}
+
+void ReadingApp::create_ui() {
+    if (label_content) return;
     
     // Initialize text style
     if (!style_initialized) {
         lv_style_init(&style_text);
-        lv_style_set_text_font(&style_text, &my_font_chinese_16);
         lv_style_set_text_color(&style_text, lv_color_black());
-        lv_style_set_text_line_space(&style_text, 4);
         style_initialized = true;
     }
     
-    // Create label_content but hide it initially (will be shown when entering reading state)
+    // Page text, hidden until a book is opened. Lines end where the page
+    // layout put a '\n', so the label never wraps them itself.
     label_content = lv_label_create(lv_scr_act());
     lv_obj_add_style(label_content, &style_text, 0);
-    lv_obj_set_width(label_content, 196);
-    lv_obj_set_height(label_content, 180);
-    lv_obj_align(label_content, LV_ALIGN_TOP_MID, 0, 2);
-    lv_label_set_long_mode(label_content, LV_LABEL_LONG_WRAP);
+    lv_label_set_long_mode(label_content, LV_LABEL_LONG_CLIP);
     lv_obj_add_flag(label_content, LV_OBJ_FLAG_HIDDEN);
     
-    // Show bookshelf
-    show_bookshelf();
+    // Font, spacing and margins of the text
+    load_settings();
+    apply_settings();
+    
+    // System menu; the reading settings reuse its rows
+    menu_container = create_panel("系统菜单");
+    menu_title = lv_obj_get_child(menu_container, 0);
+    menu_list.create(menu_container, MENU_ROWS, 35, 25, glyph_cache.font());
+    menu_list.set_source(menu_item_text, this, MENU_ITEM_COUNT);
+    
+    // Builds the page index a few pages at a time while a book is open
+    index_timer = lv_timer_create(index_timer_cb, INDEX_PERIOD_MS, this);
+    lv_timer_pause(index_timer);
+    
+    // Bookshelf rows, recycled for whichever books are on screen
+    bookshelf_container = create_panel("书架");
+    bookshelf_title = lv_obj_get_child(bookshelf_container, 0);
+    shelf_list.create(bookshelf_container, BOOKSHELF_ROWS, 35, 25, glyph_cache.font());
+    
+    // No books found message
+    bookshelf_empty_label = lv_label_create(bookshelf_container);
+    lv_obj_set_style_text_font(bookshelf_empty_label, glyph_cache.font(), 0);
+    lv_label_set_text_static(bookshelf_empty_label, "未找到书籍\n请将txt文件\n放入SD卡\n/books文件夹");
+    lv_obj_align(bookshelf_empty_label, LV_ALIGN_CENTER, 0, 0);
+}
+
+lv_obj_t* ReadingApp::create_panel(const char* title_text) {
+    lv_obj_t* panel = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(panel, 196, 180);
+    lv_obj_align(panel, LV_ALIGN_TOP_MID, 0, 2);
+    lv_obj_set_style_bg_color(panel, lv_color_white(), 0);
+    lv_obj_set_style_border_width(panel, 1, 0);
+    lv_obj_set_style_pad_all(panel, 5, 0);
+    lv_obj_add_flag(panel, LV_OBJ_FLAG_HIDDEN);
+    
+    lv_obj_t* title = lv_label_create(panel);
+    lv_obj_set_style_text_font(title, glyph_cache.font(), 0);
+    lv_label_set_text_static(title, title_text);
+    lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 5);
+    
+    return panel;
 }
 
 void ReadingApp::deinit() {
     Serial.println("Reading app deinit");
     
-    if (book_file) {
-        book_file.close();
-    }
-    
-    if (menu_container) {
-        lv_obj_del(menu_container);
-        menu_container = nullptr;
-    }
-    
-    if (bookshelf_container) {
-        lv_obj_del(bookshelf_container);
-        bookshelf_container = nullptr;
-    }
+    save_position();
+    close_book();
+    open_book = -1;
     
-    if (label_content) {
-        lv_obj_del(label_content);
-        label_content = nullptr;
-    }
+    // Keep the widgets for the next visit
+    lv_obj_add_flag(menu_container, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(bookshelf_container, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(label_content, LV_OBJ_FLAG_HIDDEN);
     
-    cleanup_menu_ui();
-    cleanup_bookshelf_ui();
+    clear_book_list();
 }
 
-void ReadingApp::cleanup_menu_ui() {
-    if (menu_items_labels) {
-        delete[] menu_items_labels;
-        menu_items_labels = nullptr;
-    }
-    
-    if (menu_items_names) {
-        delete[] menu_items_names;
-        menu_items_names = nullptr;
-    }
+// Book, position, history and book list stay as they are; only the
+// widgets go out of sight
+void ReadingApp::suspend() {
+    Serial.println("Reading app suspend");
+    save_position();
+    lv_timer_pause(index_timer);
+    
+    lv_obj_add_flag(menu_container, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(bookshelf_container, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(label_content, LV_OBJ_FLAG_HIDDEN);
+}
+
+// Show whatever was on screen when suspended: the labels still point at
+// their buffers, so this is a single refresh with no SD access
+void ReadingApp::resume() {
+    Serial.println("Reading app resume");
+    
+    switch (current_state) {
+        case STATE_BOOKSHELF:
+            lv_obj_clear_flag(bookshelf_container, LV_OBJ_FLAG_HIDDEN);
+            break;
+        case STATE_MENU:
+        case STATE_SETTINGS:
+            lv_obj_clear_flag(menu_container, LV_OBJ_FLAG_HIDDEN);
+            break;
+        case STATE_READING:
+        case STATE_STATS:
+            lv_obj_clear_flag(label_content, LV_OBJ_FLAG_HIDDEN);
+            break;
+    }
+    if (book_file && !page_index.complete()) {
+        lv_timer_resume(index_timer);
+    }
+    bottom_bar.update_app_info(get_app_info());
 }
 
 void ReadingApp::show_menu() {
@@ -121,45 +216,10 @@ void ReadingApp::show_menu() {
     total_menu_items = MENU_ITEM_COUNT;
     
     // Hide reading content
-    if (label_content) {
-        lv_obj_add_flag(label_content, LV_OBJ_FLAG_HIDDEN);
-    }
-    
-    // Create menu container
-    menu_container = lv_obj_create(lv_scr_act());
-    lv_obj_set_size(menu_container, 196, 180);
-    lv_obj_align(menu_container, LV_ALIGN_TOP_MID, 0, 2);
-    lv_obj_set_style_bg_color(menu_container, lv_color_white(), 0);
-    lv_obj_set_style_border_width(menu_container, 1, 0);
-    lv_obj_set_style_pad_all(menu_container, 5, 0);
-    
-    // Create title
-    lv_obj_t* title = lv_label_create(menu_container);
-    lv_obj_set_style_text_font(title, &my_font_chinese_16, 0);
-    lv_label_set_text(title, "系统菜单");
-    lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 5);
-    
-    // Create menu items
-    menu_items_labels = new lv_obj_t*[total_menu_items];
-    menu_items_names = new const char*[total_menu_items];
-    
-    // Check for allocation failure
-    if (!menu_items_labels || !menu_items_names) {
-        Serial.println("Failed to allocate menu arrays");
-        cleanup_menu_ui();
-        current_state = STATE_READING;
-        return;
-    }
-    
-    for (int i = 0; i < total_menu_items; i++) {
-        menu_items_labels[i] = lv_label_create(menu_container);
-        lv_obj_set_style_text_font(menu_items_labels[i], &my_font_chinese_16, 0);
-        menu_items_names[i] = MENU_ITEMS[i];
-        lv_label_set_text(menu_items_labels[i], menu_items_names[i]);
-        lv_obj_align(menu_items_labels[i], LV_ALIGN_TOP_LEFT, 10, 35 + i * 25);
-    }
+    lv_obj_add_flag(label_content, LV_OBJ_FLAG_HIDDEN);
     
     update_menu_display();
+    lv_obj_clear_flag(menu_container, LV_OBJ_FLAG_HIDDEN);
     Serial.println("Menu shown");
 }
 
@@ -168,50 +228,22 @@ void ReadingApp::hide_menu() {
     
     current_state = STATE_READING;
     
-    // Delete menu
-    if (menu_container) {
-        lv_obj_del(menu_container);
-        menu_container = nullptr;
-    }
-    
-    cleanup_menu_ui();
+    lv_obj_add_flag(menu_container, LV_OBJ_FLAG_HIDDEN);
     
     // Show reading content
-    if (label_content) {
-        lv_obj_clear_flag(label_content, LV_OBJ_FLAG_HIDDEN);
-    }
+    lv_obj_clear_flag(label_content, LV_OBJ_FLAG_HIDDEN);
     
     Serial.println("Menu hidden");
 }
 
 void ReadingApp::update_menu_display() {
-    // Null pointer safety check
-    if (!menu_items_labels || !menu_items_names) {
-        Serial.println("ERROR: menu arrays are null!");
-        return;
-    }
-    
     Serial.printf("Updating menu display: selection=%d, total=%d\n", menu_selection, total_menu_items);
-    
-    // Update menu items with cursor indicator
-    // No background highlighting for e-ink display
-    for (int i = 0; i < total_menu_items; i++) {
-        if (menu_items_labels[i] && menu_items_names[i]) {
-            if (i == menu_selection) {
-                // Selected item: add cursor prefix "▶ "
-                char text_with_cursor[128];
-                snprintf(text_with_cursor, sizeof(text_with_cursor), "▶ %s", menu_items_names[i]);
-                lv_label_set_text(menu_items_labels[i], text_with_cursor);
-                Serial.printf("  Item %d: SELECTED '%s'\n", i, menu_items_names[i]);
-            } else {
-                // Unselected item: show name without cursor
-                lv_label_set_text(menu_items_labels[i], menu_items_names[i]);
-                Serial.printf("  Item %d: '%s'\n", i, menu_items_names[i]);
-            }
-        } else {
-            Serial.printf("  Item %d: NULL LABEL OR NAME!\n", i);
-        }
-    }
+    menu_list.set_selected(menu_selection);
+}
+
+void ReadingApp::menu_item_text(void* ctx, int index, char* buf, size_t len) {
+    LV_UNUSED(ctx);
+    snprintf(buf, len, "%s", MENU_ITEMS[index]);
 }
 
 void ReadingApp::execute_menu_action() {
@@ -225,6 +257,8 @@ void ReadingApp::execute_menu_action() {
     
     if (strcmp(selected, "返回阅读") == 0) {
         hide_menu();
+    } else if (strcmp(selected, "阅读设置") == 0) {
+        show_settings();
     } else if (strcmp(selected, "强制刷新") == 0) {
         // Reload current page
         load_page(current_offset);
@@ -233,104 +267,105 @@ void ReadingApp::execute_menu_action() {
         // Return to bookshelf
         hide_menu();
         // Hide reading content
-        if (label_content) {
-            lv_obj_add_flag(label_content, LV_OBJ_FLAG_HIDDEN);
-        }
+        lv_obj_add_flag(label_content, LV_OBJ_FLAG_HIDDEN);
         show_bookshelf();
     } else if (strcmp(selected, "返回主菜单") == 0) {
         // Switch back to main menu (app 0)
         hide_menu();
         extern AppManager app_manager;
         app_manager.switch_to_app(0);
+    } else if (strcmp(selected, "性能统计") == 0) {
+        hide_menu();
+        show_stats();
     }
 }
 
-void ReadingApp::calculate_total_pages() {
-    if (!SD.exists(book_path)) {
-        estimated_total_pages = 1;
-        return;
-    }
-    
-    File f = SD.open(book_path, FILE_READ);
-    if (f) {
-        total_file_size = f.size();
-        f.close();
-        
-        // Estimate: each page shows approximately 350 bytes
-        estimated_total_pages = (total_file_size / 350) + 1;
-        if (estimated_total_pages < 1) estimated_total_pages = 1;
-        
-        Serial.printf("Total file size: %lu, Estimated pages: %d\n", 
-                      total_file_size, estimated_total_pages);
-    } else {
-        estimated_total_pages = 1;
+void ReadingApp::show_stats() {
+    // Page-turn latency percentiles, shown in place of the page text
+    char* text = next_text_buffer();
+    telemetry.format_summary(text, BUFFER_SIZE + 1);
+    if (label_content) {
+        lv_label_set_text_static(label_content, text);
     }
+    current_state = STATE_STATS;
+    telemetry.print_report();
 }
 
-int ReadingApp::read_utf8_safe(File &f, char* buf, int maxLen) {
-    int readLen = f.readBytes(buf, maxLen);
-    if (readLen <= 0) return 0;
-    
-    int safeLen = readLen;
-    
-    // Check if we cut off a multi-byte UTF-8 character
-    // Continuation bytes have pattern 10xxxxxx (0x80 to 0xBF)
-    while (safeLen > 0 && (buf[safeLen-1] & 0xC0) == 0x80) {
-        safeLen--;
-    }
-    
-    // Check if the last byte is a multi-byte character start that may be incomplete
-    if (safeLen > 0) {
-        unsigned char lastChar = (unsigned char)buf[safeLen-1];
-        
-        // Check if it's a multi-byte character start (bit pattern 11xxxxxx)
-        // and we don't have the full character
-        if ((lastChar & 0xE0) == 0xC0) {
-            // 2-byte character start (110xxxxx), need 1 more byte
-            if (safeLen >= readLen) safeLen--; // Incomplete, remove it
-        } else if ((lastChar & 0xF0) == 0xE0) {
-            // 3-byte character start (1110xxxx), need 2 more bytes
-            if (safeLen >= readLen - 1) safeLen--; // Incomplete, remove it
-        } else if ((lastChar & 0xF8) == 0xF0) {
-            // 4-byte character start (11110xxx), need 3 more bytes
-            if (safeLen >= readLen - 2) safeLen--; // Incomplete, remove it
-        }
-    }
-    
-    int backtrack = readLen - safeLen;
-    if (backtrack > 0) {
-        f.seek(f.position() - backtrack);
-    }
-    
-    buf[safeLen] = '\0';
-    return safeLen;
+void ReadingApp::begin_page_turn(const ButtonEvent& event) {
+    // Input cost is the time from the button edge to the handler
+    telemetry.record(TM_INPUT, micros() - event.time_us);
+    telemetry.begin_page_turn(event.time_us);
+}
+
+char* ReadingApp::next_text_buffer() {
+    // The label keeps pointing at the front buffer until the new text is set
+    text_front ^= 1;
+    return text_buffers[text_front];
 }
 
+// Hot path: no heap use, the label shows one of two static page buffers
 void ReadingApp::load_page(unsigned long offset) {
-    if (!SD.exists(book_path)) {
+    if (!book_file) {
         show_error("No book file");
         return;
     }
     
-    book_file = SD.open(book_path, FILE_READ);
-    if (book_file) {
-        book_file.seek(offset);
-        read_utf8_safe(book_file, text_buffer, BUFFER_SIZE - 1);
-        
-        lv_label_set_text(label_content, text_buffer);
-        
-        update_status_info();
-        
-        Serial.printf("Page %d/%d loaded. Offset: %lu\n", 
-                      page_num, estimated_total_pages, offset);
-        
-        book_file.close();
+    // Layout reads the book through the window; fetching the bytes the page
+    // starts with first keeps the card read out of the layout time
+    unsigned long sd_start = micros();
+    page_text.byte_at(offset);
+    telemetry.record(TM_SD_READ, micros() - sd_start);
+    
+    char* text = next_text_buffer();
+    {
+        TelemetryScope scope(TM_LAYOUT);
+        next_offset = layout.layout_page(page_text, offset, page_index.limit_for(offset), text,
+                                         BUFFER_SIZE + 1);
+        lv_label_set_text_static(label_content, text);
+    }
+    
+    // Reading ahead of the background indexer extends the index for free
+    if (offset == page_index.frontier()) {
+        page_index.add(next_offset);
     }
+    page_num = page_index.page_number(offset);
+    update_status_info();
+}
+
+// Start of the page before the one on screen: from the index, else from the
+// pages turned past, else laid out backwards from the page on screen
+unsigned long ReadingApp::previous_page_offset() {
+    uint32_t turned_from = 0;
+    bool turned = false;
+    if (back_count > 0) {
+        back_head = (back_head + BACK_PAGES - 1) % BACK_PAGES;
+        back_count--;
+        turned_from = back_pages[back_head];
+        turned = turned_from < current_offset;
+    }
+    
+    int page = page_index.find(current_offset);
+    if (page > 0) return page_index.page_start(page - 1);
+    if (turned) return turned_from;
+    
+    // Lines break the same from any known page start before it: the anchor
+    // when the page was reached forward from it, or an indexed page a full
+    // page or more back
+    uint32_t floor = first_offset;
+    uint32_t anchor = page_index.anchor();
+    if (anchor < current_offset && anchor > floor) floor = anchor;
+    page = page_index.page_of(current_offset);
+    if (page < 0) page = page_index.count() - 1;
+    uint32_t indexed = page_index.page_start(page > 0 ? page - 1 : 0);
+    if (indexed < current_offset && indexed > floor) floor = indexed;
+    
+    TelemetryScope scope(TM_LAYOUT);
+    return layout.page_before(page_text, current_offset, floor);
 }
 
 void ReadingApp::update_status_info() {
     // Format: "page/total"
-    snprintf(status_buffer, sizeof(status_buffer), "%d/%d", page_num, estimated_total_pages);
+    snprintf(status_buffer, sizeof(status_buffer), "%d/%d", page_num, page_index.total_pages());
     
     // Only update bottom bar if status changed
     if (strcmp(status_buffer, last_status_buffer) != 0) {
@@ -341,153 +376,130 @@ void ReadingApp::update_status_info() {
 }
 
 void ReadingApp::show_error(const char* msg) {
+    // Callers pass string literals
     if (label_content) {
-        lv_label_set_text(label_content, msg);
+        lv_label_set_text_static(label_content, msg);
     }
 }
 
-void ReadingApp::loop() {
-    unsigned long current_time = millis();
-    
-    // BOOT button handling - non-blocking
-    bool boot_btn = (digitalRead(BOOT_BUTTON_PIN) == LOW);
-    
-    if (boot_btn && !boot_pressed) {
-        // Button just pressed
-        boot_pressed = true;
-        boot_press_start = current_time;
-    } else if (!boot_btn && boot_pressed) {
-        // Button just released
-        boot_pressed = false;
-        unsigned long press_duration = current_time - boot_press_start;
-        
-        // Debounce check
-        if (press_duration < 50) return; // Too short, ignore
-        
-        if (press_duration >= 800) {
+void ReadingApp::on_button(const ButtonEvent& event) {
+    if (event.button == BUTTON_BOOT) {
+        if (event.action == BUTTON_LONG_PRESS) {
             // Long press: toggle menu
             if (current_state == STATE_READING) {
+                EPD_TRACE_MARK("menu_open");
                 show_menu();
             } else if (current_state == STATE_MENU) {
+                EPD_TRACE_MARK("menu_close");
                 hide_menu();
+            } else if (current_state == STATE_SETTINGS) {
+                EPD_TRACE_MARK("settings_close");
+                hide_settings();
             }
-        } else {
-            // Short press
-            if (current_time - last_key_time > 300) {
-                last_key_time = current_time;
+        } else if (current_state == STATE_STATS) {
+            // Leave the statistics view
+            current_state = STATE_READING;
+            load_page(current_offset);
+        } else if (current_state == STATE_READING) {
+            // Next page, where the layout of this one ended
+            if (next_offset < total_file_size) {
+                EPD_TRACE_MARK("next_page");
+                begin_page_turn(event);
+                back_pages[back_head] = current_offset;
+                back_head = (back_head + 1) % BACK_PAGES;
+                if (back_count < BACK_PAGES) back_count++;
                 
-                if (current_state == STATE_READING) {
-                    // Next page in reading mode
-                    // Save history with validity flag
-                    if (page_num < 500) {
-                        history_offsets[page_num] = current_offset;
-                        history_valid[page_num] = true;
-                    }
-                    
-                    // Move forward ~350 bytes
-                    current_offset += 350;
-                    page_num++;
-                    
-                    // Clamp to max pages
-                    if (page_num > estimated_total_pages) {
-                        page_num = estimated_total_pages;
-                        current_offset = total_file_size > 350 ? total_file_size - 350 : 0;
-                    }
-                    
-                    load_page(current_offset);
-                } else if (current_state == STATE_BOOKSHELF) {
-                    // Navigate down in bookshelf
-                    if (book_count > 0) {
-                        bookshelf_selection++;
-                        if (bookshelf_selection >= book_count) {
-                            bookshelf_selection = 0;
-                        }
-                        update_bookshelf_display();
-                        Serial.printf("Bookshelf selection: %d\n", bookshelf_selection);
-                    }
+                current_offset = next_offset;
+                load_page(current_offset);
+            }
+        } else if (current_state == STATE_BOOKSHELF) {
+            // Navigate down in bookshelf
+            if (book_count > 0) {
+                EPD_TRACE_MARK("shelf_nav");
+                bookshelf_selection++;
+                if (bookshelf_selection >= book_count) {
+                    bookshelf_selection = 0;
                 }
+                update_bookshelf_display();
+                Serial.printf("Bookshelf selection: %d\n", bookshelf_selection);
             }
         }
+        return;
     }
     
-    // PWR button handling - non-blocking
-    bool pwr_btn = (digitalRead(PWR_BUTTON_PIN) == LOW);
-    
-    if (pwr_btn && !pwr_pressed) {
-        // Button just pressed
-        pwr_pressed = true;
-        pwr_press_start = current_time;
-    } else if (!pwr_btn && pwr_pressed) {
-        // Button just released
-        pwr_pressed = false;
-        unsigned long press_duration = current_time - pwr_press_start;
-        
-        // Debounce check
-        if (press_duration < 50) return; // Too short, ignore
-        
-        if (press_duration >= 800) {
-            // Long press: confirm menu selection or select book
-            if (current_state == STATE_MENU) {
-                execute_menu_action();
-            } else if (current_state == STATE_BOOKSHELF) {
-                // Select book from bookshelf
-                if (book_count > 0) {
+    // PWR button
+    if (event.action == BUTTON_LONG_PRESS) {
+        // Long press: confirm menu selection or select book
+        if (current_state == STATE_MENU) {
+            EPD_TRACE_MARK("menu_action");
+            execute_menu_action();
+        } else if (current_state == STATE_SETTINGS) {
+            EPD_TRACE_MARK("settings_change");
+            change_setting();
+        } else if (current_state == STATE_BOOKSHELF) {
+            // Open the selected book or folder
+            if (book_count > 0) {
+                int index = shelf_entry(bookshelf_selection);
+                CatalogEntry entry;
+                if (index < 0 || (catalog.get(index, entry) && (entry.flags & CATALOG_FLAG_FOLDER))) {
+                    EPD_TRACE_MARK("open_folder");
+                    open_shelf_folder(index);
+                } else {
+                    EPD_TRACE_MARK("open_book");
                     select_book();
                 }
             }
-        } else {
-            // Short press
-            if (current_time - last_key_time > 300) {
-                last_key_time = current_time;
-                
-                if (current_state == STATE_READING) {
-                    // Previous page
-                    if (page_num > 1) {
-                        page_num--;
-                        
-                        // Use history if available and valid
-                        if (page_num < 500 && history_valid[page_num]) {
-                            current_offset = history_offsets[page_num];
-                        } else {
-                            if (current_offset > 350) {
-                                current_offset -= 350;
-                            } else {
-                                current_offset = 0;
-                            }
-                        }
-                        
-                        load_page(current_offset);
-                    }
-                } else if (current_state == STATE_MENU) {
-                    // Move selection down
-                    menu_selection = (menu_selection + 1) % total_menu_items;
-                    Serial.printf("Menu nav: selection=%d, total_items=%d\n", menu_selection, total_menu_items);
-                    update_menu_display();
-                }
-            }
         }
+    } else if (current_state == STATE_READING) {
+        // Previous page
+        if (current_offset > first_offset) {
+            EPD_TRACE_MARK("prev_page");
+            begin_page_turn(event);
+            current_offset = previous_page_offset();
+            load_page(current_offset);
+        }
+    } else if (current_state == STATE_BOOKSHELF) {
+        // Next sort order
+        if (book_count > 0) {
+            EPD_TRACE_MARK("shelf_sort");
+            cycle_sort();
+        }
+    } else if (current_state == STATE_MENU) {
+        // Move selection down
+        EPD_TRACE_MARK("menu_nav");
+        menu_selection = (menu_selection + 1) % total_menu_items;
+        Serial.printf("Menu nav: selection=%d, total_items=%d\n", menu_selection, total_menu_items);
+        update_menu_display();
+    } else if (current_state == STATE_SETTINGS) {
+        EPD_TRACE_MARK("settings_nav");
+        setting_selection = (setting_selection + 1) % SETTING_COUNT;
+        menu_list.set_selected(setting_selection);
     }
 }
 
 // ========== Bookshelf Methods ==========
 
-void ReadingApp::cleanup_bookshelf_ui() {
-    if (book_labels) {
-        delete[] book_labels;
-        book_labels = nullptr;
-    }
-    
-    if (book_paths) {
-        for (int i = 0; i < book_count; i++) {
-            if (book_paths[i]) {
-                free((void*)book_paths[i]);
-            }
-        }
-        delete[] book_paths;
-        book_paths = nullptr;
-    }
-    
+void ReadingApp::clear_book_list() {
+    catalog.close();
     book_count = 0;
+    shelf_list.set_source(shelf_item_text, this, 0);
+}
+
+// Remember where the open book is, in its catalog entry, and the pages
+// indexed so far
+void ReadingApp::save_position() {
+    if (!book_file) return;
+    page_index.save(index_path);
+    gzip_source.save();
+    if (open_book < 0) return;
+    
+    CatalogEntry entry;
+    if (!catalog.get(open_book, entry)) return;
+    if (entry.last_offset == current_offset && entry.last_page == page_num) return;
+    
+    entry.last_offset = current_offset;
+    entry.last_page = page_num;
+    catalog.update(open_book, entry);
 }
 
 void ReadingApp::create_books_folder_if_needed() {
@@ -501,77 +513,45 @@ void ReadingApp::create_books_folder_if_needed() {
     }
 }
 
-bool ReadingApp::is_book_file(const char* filename) {
-    if (!filename) return false;
-    
-    int len = strlen(filename);
-    if (len < 4) return false;
-    
-    // Check for supported file extensions
-    const char* ext = filename + len - 4;
-    return (strcasecmp(ext, ".txt") == 0 || 
-            strcasecmp(ext, ".TXT") == 0);
+void ReadingApp::scan_books_folder() {
+    // One name-only pass over the current folder; the catalog is only
+    // rewritten when the listing differs
+    unsigned long start = millis();
+    catalog.refresh(arena);
+    catalog.load_view(arena);
+    book_count = catalog.count() + parent_rows();
+    shelf_list.set_source(shelf_item_text, this, book_count);
+    
+    // Root shows the shelf title, subfolders their own name
+    const char* folder = catalog.get_folder();
+    const char* name = strrchr(folder, '/');
+    lv_label_set_text_static(bookshelf_title, catalog.is_root() ? "书架" : (name ? name + 1 : folder));
+    
+    Serial.printf("Found %d entries in %s, by %s (%lu ms)\n", catalog.count(), folder,
+                  BookCatalog::sort_name(catalog.get_sort()), millis() - start);
 }
 
-void ReadingApp::scan_books_folder() {
-    cleanup_bookshelf_ui();
-    
-    File dir = SD.open(BOOKS_FOLDER);
-    if (!dir) {
-        Serial.println("Failed to open books folder");
-        return;
-    }
-    
-    if (!dir.isDirectory()) {
-        Serial.println("Books path is not a directory");
-        dir.close();
-        return;
-    }
-    
-    // First pass: count books
-    book_count = 0;
-    File file = dir.openNextFile();
-    while (file && book_count < MAX_BOOKS) {
-        if (!file.isDirectory() && is_book_file(file.name())) {
-            book_count++;
-        }
-        file.close();
-        file = dir.openNextFile();
-    }
-    dir.close();
-    
-    Serial.printf("Found %d books\n", book_count);
-    
-    if (book_count == 0) {
-        return;
+// Enters the selected subfolder, or leaves through the ".." row
+void ReadingApp::open_shelf_folder(int index) {
+    bool ok;
+    if (index < 0) {
+        ok = catalog.open_parent();
+    } else {
+        CatalogEntry entry;
+        ok = catalog.get(index, entry) && catalog.open_subfolder(entry.name);
     }
+    if (!ok) return;
     
-    // Allocate arrays
-    book_labels = new lv_obj_t*[book_count];
-    book_paths = new const char*[book_count];
-    
-    // Second pass: store book information
-    dir = SD.open(BOOKS_FOLDER);
-    int index = 0;
-    file = dir.openNextFile();
-    while (file && index < book_count) {
-        if (!file.isDirectory() && is_book_file(file.name())) {
-            // Store full path
-            char* full_path = (char*)malloc(strlen(BOOKS_FOLDER) + strlen(file.name()) + 2);
-            sprintf(full_path, "%s/%s", BOOKS_FOLDER, file.name());
-            book_paths[index] = full_path;
-            
-            Serial.printf("Book %d: %s\n", index, full_path);
-            index++;
-        }
-        file.close();
-        file = dir.openNextFile();
-    }
-    dir.close();
+    bookshelf_selection = 0;
+    scan_books_folder();
+    update_bookshelf_display();
+    bottom_bar.update_app_info(get_app_info());
 }
 
 void ReadingApp::show_bookshelf() {
-    if (current_state == STATE_BOOKSHELF && bookshelf_container) return;
+    save_position();
+    close_book();
+    open_book = -1;
     
     current_state = STATE_BOOKSHELF;
     bookshelf_selection = 0;
@@ -582,92 +562,73 @@ void ReadingApp::show_bookshelf() {
     // Scan for books
     scan_books_folder();
     
-    // Create container
-    bookshelf_container = lv_obj_create(lv_scr_act());
-    lv_obj_set_size(bookshelf_container, 196, 180);
-    lv_obj_align(bookshelf_container, LV_ALIGN_TOP_MID, 0, 2);
-    lv_obj_set_style_bg_color(bookshelf_container, lv_color_white(), 0);
-    lv_obj_set_style_border_width(bookshelf_container, 1, 0);
-    lv_obj_set_style_pad_all(bookshelf_container, 5, 0);
-    
-    // Create title
-    lv_obj_t* title = lv_label_create(bookshelf_container);
-    lv_obj_set_style_text_font(title, &my_font_chinese_16, 0);
-    lv_label_set_text(title, "书架");
-    lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 5);
-    
-    if (book_count == 0) {
-        // No books found message
-        lv_obj_t* msg = lv_label_create(bookshelf_container);
-        lv_obj_set_style_text_font(msg, &my_font_chinese_16, 0);
-        lv_label_set_text(msg, "未找到书籍\n请将txt文件\n放入SD卡\n/books文件夹");
-        lv_obj_align(msg, LV_ALIGN_CENTER, 0, 0);
+    if (book_count == 0 && catalog.is_root()) {
+        lv_obj_clear_flag(bookshelf_empty_label, LV_OBJ_FLAG_HIDDEN);
     } else {
-        // Create book list (show max 5 books on screen)
-        for (int i = 0; i < book_count && i < 5; i++) {
-            book_labels[i] = lv_label_create(bookshelf_container);
-            lv_obj_set_style_text_font(book_labels[i], &my_font_chinese_16, 0);
-            
-            // Extract filename from path
-            const char* filename = strrchr(book_paths[i], '/');
-            if (filename) {
-                filename++; // Skip the '/'
-            } else {
-                filename = book_paths[i];
-            }
-            
-            lv_label_set_text(book_labels[i], filename);
-            lv_obj_align(book_labels[i], LV_ALIGN_TOP_LEFT, 10, 35 + i * 25);
-        }
-        
-        update_bookshelf_display();
+        lv_obj_add_flag(bookshelf_empty_label, LV_OBJ_FLAG_HIDDEN);
     }
+    update_bookshelf_display();
+    lv_obj_clear_flag(bookshelf_container, LV_OBJ_FLAG_HIDDEN);
     
-    bottom_bar.update_app_info("Bookshelf");
+    bottom_bar.update_app_info(get_app_info());
 }
 
 void ReadingApp::hide_bookshelf() {
-    if (bookshelf_container) {
-        lv_obj_del(bookshelf_container);
-        bookshelf_container = nullptr;
-    }
+    lv_obj_add_flag(bookshelf_container, LV_OBJ_FLAG_HIDDEN);
 }
 
 void ReadingApp::update_bookshelf_display() {
-    if (book_count == 0) return;
-    
-    // Update cursor for selected book
-    for (int i = 0; i < book_count && i < 5; i++) {
-        if (book_labels[i]) {
-            // Extract filename from path
-            const char* filename = strrchr(book_paths[i], '/');
-            if (filename) {
-                filename++; // Skip the '/'
-            } else {
-                filename = book_paths[i];
-            }
-            
-            if (i == bookshelf_selection) {
-                // Selected item: add cursor
-                char text_with_cursor[128];
-                snprintf(text_with_cursor, sizeof(text_with_cursor), "▶ %s", filename);
-                lv_label_set_text(book_labels[i], text_with_cursor);
-            } else {
-                // Unselected item
-                lv_label_set_text(book_labels[i], filename);
-            }
-        }
+    shelf_list.set_selected(bookshelf_selection);
+}
+
+// Name, recent, size; only the in-memory view is sorted again
+void ReadingApp::cycle_sort() {
+    unsigned long start = millis();
+    catalog.set_sort((CatalogSort)((catalog.get_sort() + 1) % CATALOG_SORT_COUNT));
+    Serial.printf("Bookshelf sorted by %s (%lu ms)\n",
+                  BookCatalog::sort_name(catalog.get_sort()), millis() - start);
+    
+    bookshelf_selection = 0;
+    shelf_list.invalidate();
+    update_bookshelf_display();
+    bottom_bar.update_app_info(get_app_info());
+}
+
+// Called for the rows of a page the first time it is shown
+void ReadingApp::shelf_item_text(void* ctx, int index, char* buf, size_t len) {
+    ReadingApp* self = (ReadingApp*)ctx;
+    int entry_index = self->shelf_entry(index);
+    CatalogEntry entry;
+    if (entry_index < 0) {
+        snprintf(buf, len, "..");
+    } else if (self->catalog.get(entry_index, entry)) {
+        snprintf(buf, len, (entry.flags & CATALOG_FLAG_FOLDER) ? "%s/" : "%s", entry.name);
     }
 }
 
+// Catalog index of a shelf row; -1 for the ".." row of a subfolder
+int ReadingApp::shelf_entry(int row) {
+    return catalog.view_index(row - parent_rows());
+}
+
+int ReadingApp::parent_rows() const {
+    return catalog.is_root() ? 0 : 1;
+}
+
 void ReadingApp::select_book() {
     if (bookshelf_selection < 0 || bookshelf_selection >= book_count) {
         Serial.println("Invalid book selection");
         return;
     }
     
-    // Set the book path
-    book_path = book_paths[bookshelf_selection];
+    int index = shelf_entry(bookshelf_selection);
+    CatalogEntry entry;
+    if (!catalog.get(index, entry)) {
+        Serial.println("Catalog read failed");
+        return;
+    }
+    catalog.format_path(entry, book_path_buffer, sizeof(book_path_buffer));
+    book_path = book_path_buffer;
     
     Serial.printf("Selected book: %s\n", book_path);
     
@@ -682,16 +643,360 @@ void ReadingApp::select_book() {
     // Switch to reading state
     current_state = STATE_READING;
     
-    // Calculate total pages
-    calculate_total_pages();
+    // The file stays open while reading, page turns only seek and read
+    close_book();
+    book_file = SD.open(book_path, FILE_READ);
+    uint32_t file_size = book_file ? book_file.size() : 0;
+    uint32_t mtime = book_file ? (uint32_t)book_file.getLastWrite() : 0;
+    source = open_source(mtime);
+    open_book = source ? index : -1;
+    total_file_size = source ? source->size() : 0;
+    
+    // Size, date and encoding are learnt on first open; a changed file
+    // loses its saved position
+    if (source && (entry.encoding == BOOK_ENCODING_UNKNOWN || entry.size != file_size ||
+                   entry.mtime != mtime)) {
+        uint8_t* sample = (uint8_t*)next_text_buffer();
+        int len = source->read(0, sample, BUFFER_SIZE);
+        entry.encoding = BookCatalog::detect_encoding(sample, len > 0 ? len : 0);
+        entry.size = file_size;
+        entry.mtime = mtime;
+        entry.last_offset = 0;
+        entry.last_page = 1;
+        Serial.printf("Encoding: %s\n", BookCatalog::encoding_name(entry.encoding));
+    }
+    entry.last_read = catalog.next_read_seq();
+    if (open_book >= 0) {
+        catalog.update(open_book, entry);
+    }
+    
+    if (!source) {
+        show_error("No book file");
+        return;
+    }
     
-    // Load first page
-    current_offset = 0;
-    page_num = 1;
+    // Continue where the book was left, on a page of the index
+    book_mtime = mtime;
+    first_offset = entry.encoding == BOOK_ENCODING_UTF8_BOM ? 3 : 0;
+    current_offset = entry.last_offset < first_offset ? first_offset : entry.last_offset;
+    open_index();
     load_page(current_offset);
 }
 
+// The text of the book: the file itself, inflated from it as it is read,
+// or for an EPUB extracted once into a file; checkpoints and extracted text
+// are kept next to the page index
+BookSource* ReadingApp::open_source(uint32_t mtime) {
+    if (!book_file) return nullptr;
+    char path[32];
+    if (EpubBook::is_epub_name(book_path)) {
+        snprintf(path, sizeof(path), "/.reader/%08lx.txt", (unsigned long)BookCatalog::hash_name(book_path));
+        if (EpubBook::open_text(book_file, mtime, path, text_file, arena) > 0) {
+            file_source.attach(&text_file, EpubBook::HEADER_SIZE);
+            return &file_source;
+        }
+        book_file.close();
+        return nullptr;
+    }
+    if (!GzipSource::is_compressed_name(book_path)) {
+        file_source.attach(&book_file);
+        return &file_source;
+    }
+    
+    snprintf(path, sizeof(path), "/.reader/%08lx.gzi", (unsigned long)BookCatalog::hash_name(book_path));
+    if (gzip_source.open(&book_file, mtime, path)) return &gzip_source;
+    book_file.close();
+    return nullptr;
+}
+
+// Callers save the position first
+void ReadingApp::close_book() {
+    lv_timer_pause(index_timer);
+    page_index.end();
+    page_text.detach();
+    index_text.detach();
+    gzip_source.close();
+    file_source.detach();
+    source = nullptr;
+    if (text_file) {
+        text_file.close();
+    }
+    if (book_file) {
+        book_file.close();
+    }
+}
+
+// ========== Page Index ==========
+
+// The saved index of this book and layout, or a new one that starts a page
+// at the reading position
+void ReadingApp::open_index() {
+    page_text.attach(source);
+    index_text.attach(source);
+    layout.forget_lines();
+    back_head = 0;
+    back_count = 0;
+    
+    snprintf(index_path, sizeof(index_path), "/.reader/%08lx.pgi",
+             (unsigned long)BookCatalog::hash_name(book_path));
+    page_index.begin(total_file_size);
+    if (!page_index.load(index_path, layout.signature(), total_file_size, book_mtime)) {
+        page_index.reset(layout.signature(), total_file_size, book_mtime, first_offset, current_offset);
+    }
+    
+    // A position inside the indexed pages moves to the start of its page;
+    // past them it becomes the anchor, where a page will start
+    int page = page_index.page_of(current_offset);
+    if (page >= 0) {
+        current_offset = page_index.page_start(page);
+    } else {
+        page_index.set_anchor(current_offset);
+    }
+    
+    if (!page_index.complete()) {
+        lv_timer_resume(index_timer);
+    }
+}
+
+// The layout changed: the page on screen keeps its first character, and
+// the index starts over around it
+void ReadingApp::reanchor() {
+    if (!book_file) return;
+    
+    page_index.reset(layout.signature(), total_file_size, book_mtime, first_offset, current_offset);
+    back_head = 0;
+    back_count = 0;
+    load_page(current_offset);
+    lv_timer_resume(index_timer);
+}
+
+void ReadingApp::index_timer_cb(lv_timer_t* timer) {
+    ((ReadingApp*)lv_timer_get_user_data(timer))->index_step();
+}
+
+// A few pages past the frontier per tick, so button presses are never
+// held up for long
+void ReadingApp::index_step() {
+    if (!book_file || page_index.complete()) {
+        lv_timer_pause(index_timer);
+        return;
+    }
+    
+    unsigned long start = millis();
+    for (int i = 0; i < INDEX_PAGES_PER_TICK && millis() - start < (unsigned long)INDEX_TICK_MS; i++) {
+        uint32_t from = page_index.frontier();
+        uint32_t next = layout.layout_page(index_text, from, page_index.limit_for(from), nullptr, 0);
+        if (!page_index.add(next)) {
+            // Read error, or more pages than the index holds
+            lv_timer_pause(index_timer);
+            break;
+        }
+        if (page_index.complete()) {
+            Serial.printf("Page index complete: %d pages\n", page_index.count());
+            lv_timer_pause(index_timer);
+            break;
+        }
+    }
+    
+    if (current_state == STATE_READING) {
+        page_num = page_index.page_number(current_offset);
+        update_status_info();
+    }
+}
+
+// ========== Reading Settings ==========
+
+void ReadingApp::load_settings() {
+    File f = SD.open(SETTINGS_PATH, FILE_READ);
+    if (!f) return;
+    ReadingSettings s;
+    if (f.read((uint8_t*)&s, sizeof(s)) == sizeof(s) && s.magic == SETTINGS_MAGIC &&
+        s.version == SETTINGS_VERSION) {
+        s.font[sizeof(s.font) - 1] = '\0';
+        settings = s;
+    }
+    f.close();
+}
+
+void ReadingApp::save_settings() {
+    settings.magic = SETTINGS_MAGIC;
+    settings.version = SETTINGS_VERSION;
+    File f = SD.open(SETTINGS_PATH, FILE_WRITE);
+    if (!f) {
+        Serial.printf("Cannot write %s\n", SETTINGS_PATH);
+        return;
+    }
+    f.write((const uint8_t*)&settings, sizeof(settings));
+    f.close();
+}
+
+// The text font of the settings; the system text font unless another
+// file is picked and opens
+const lv_font_t* ReadingApp::open_body_font() {
+    if (settings.font[0] == '\0') {
+        body_glyphs.end();
+        body_font.close();
+        return glyph_cache.font();
+    }
+    char path[64];
+    snprintf(path, sizeof(path), "%s/%s", READER_FONT_DIR, settings.font);
+    if (body_font.is_open() && strcmp(body_font.path(), path) == 0) return body_glyphs.font();
+    
+    body_glyphs.end();
+    body_font.close();
+    if (body_font.open(path, BODY_FONT_CACHE_BLOCKS, glyph_cache.font())) {
+        // Drawn through its own cache, sized for its glyphs; the base font if that fails
+        body_glyphs.begin(body_font.font(), GLYPH_CACHE_SRAM_SLOTS, GLYPH_CACHE_PSRAM_SLOTS);
+        return body_glyphs.font();
+    }
+    settings.font[0] = '\0';
+    return glyph_cache.font();
+}
+
+// Style, label area and page layout from the settings
+void ReadingApp::apply_settings() {
+    const lv_font_t* font = open_body_font();
+    int32_t margin = settings.margin;
+    int32_t width = TEXT_AREA_WIDTH - 2 * margin;
+    int32_t height = TEXT_AREA_HEIGHT - 2 * margin;
+    
+    lv_style_set_text_font(&style_text, font);
+    lv_style_set_text_line_space(&style_text, settings.line_space);
+    lv_obj_report_style_change(&style_text);
+    lv_obj_set_pos(label_content, margin, margin);
+    lv_obj_set_size(label_content, width, height);
+    
+    const char* font_name = settings.font[0] ? settings.font : (sd_font.is_open() ? sd_font.path() : "");
+    layout.configure(font, BookCatalog::hash_name(font_name), width, height, settings.line_space);
+    Serial.printf("Layout: %s, line space %d, margin %d, %d lines\n", font_name[0] ? font_name : "built-in",
+                  settings.line_space, settings.margin, layout.lines_per_page());
+}
+
+// The system text font, then up to MAX_FONTS - 1 other .ebf files
+void ReadingApp::list_fonts() {
+    font_count = 0;
+    fonts[font_count].name[0] = '\0';
+    fonts[font_count].px_size = sd_font.is_open() ? sd_font.px_size() : 0;
+    font_count++;
+    
+    const char* system_font = sd_font.is_open() ? strrchr(sd_font.path(), '/') : nullptr;
+    File dir = SD.open(READER_FONT_DIR);
+    if (!dir || !dir.isDirectory()) return;
+    bool is_dir = false;
+    while (font_count < MAX_FONTS) {
+        String path = dir.getNextFileName(&is_dir);
+        if (path.isEmpty()) break;
+        const char* slash = strrchr(path.c_str(), '/');
+        const char* name = slash ? slash + 1 : path.c_str();
+        const char* ext = strrchr(name, '.');
+        if (is_dir || !ext || strcasecmp(ext, ".ebf") != 0) continue;
+        if (system_font && strcmp(system_font + 1, name) == 0) continue;
+        if (strlen(name) >= sizeof(fonts[0].name)) continue;
+        
+        File f = SD.open(path.c_str(), FILE_READ);
+        sd_font_header_t header;
+        bool ok = f && f.read((uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+                  memcmp(header.magic, SD_FONT_MAGIC, 4) == 0;
+        if (f) f.close();
+        if (!ok) continue;
+        
+        strcpy(fonts[font_count].name, name);
+        fonts[font_count].px_size = header.px_size;
+        font_count++;
+    }
+    dir.close();
+}
+
+int ReadingApp::font_choice() const {
+    for (int i = 1; i < font_count; i++) {
+        if (strcmp(fonts[i].name, pending_settings.font) == 0) return i;
+    }
+    return 0;
+}
+
+void ReadingApp::show_settings() {
+    list_fonts();
+    pending_settings = settings;
+    setting_selection = 0;
+    current_state = STATE_SETTINGS;
+    
+    lv_label_set_text_static(menu_title, "阅读设置");
+    menu_list.set_source(setting_item_text, this, SETTING_COUNT);
+    menu_list.set_selected(setting_selection);
+}
+
+// Back to the page, laid out again if anything changed
+void ReadingApp::hide_settings() {
+    lv_label_set_text_static(menu_title, "系统菜单");
+    menu_list.set_source(menu_item_text, this, MENU_ITEM_COUNT);
+    lv_obj_add_flag(menu_container, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_clear_flag(label_content, LV_OBJ_FLAG_HIDDEN);
+    current_state = STATE_READING;
+    
+    if (memcmp(&pending_settings, &settings, sizeof(settings)) == 0) return;
+    settings = pending_settings;
+    save_settings();
+    pending_settings = settings;
+    apply_settings();
+    reanchor();
+}
+
+// Long PWR: next value of the selected setting, or done
+void ReadingApp::change_setting() {
+    switch (setting_selection) {
+        case SETTING_FONT: {
+            int next = (font_choice() + 1) % font_count;
+            strcpy(pending_settings.font, fonts[next].name);
+            break;
+        }
+        case SETTING_LINE_SPACE: {
+            int next = (find_value(LINE_SPACES, LINE_SPACE_COUNT, pending_settings.line_space) + 1) % LINE_SPACE_COUNT;
+            pending_settings.line_space = LINE_SPACES[next];
+            break;
+        }
+        case SETTING_MARGIN: {
+            int next = (find_value(MARGINS, MARGIN_COUNT, pending_settings.margin) + 1) % MARGIN_COUNT;
+            pending_settings.margin = MARGINS[next];
+            break;
+        }
+        default:
+            hide_settings();
+            return;
+    }
+    menu_list.invalidate();
+    menu_list.set_selected(setting_selection);
+}
+
+void ReadingApp::setting_item_text(void* ctx, int index, char* buf, size_t len) {
+    ReadingApp* self = (ReadingApp*)ctx;
+    switch (index) {
+        case SETTING_FONT: {
+            uint16_t px = self->fonts[self->font_choice()].px_size;
+            if (px > 0) {
+                snprintf(buf, len, "字号: %upx", (unsigned)px);
+            } else {
+                snprintf(buf, len, "字号: 默认");
+            }
+            break;
+        }
+        case SETTING_LINE_SPACE:
+            snprintf(buf, len, "行距: %u", (unsigned)self->pending_settings.line_space);
+            break;
+        case SETTING_MARGIN:
+            snprintf(buf, len, "边距: %u", (unsigned)self->pending_settings.margin);
+            break;
+        default:
+            snprintf(buf, len, "完成");
+            break;
+    }
+}
+
 const char* ReadingApp::get_app_info() {
+    if (current_state == STATE_BOOKSHELF) {
+        // Sort order of the shelf, e.g. "Shelf: Recent"
+        snprintf(shelf_info, sizeof(shelf_info), "Shelf: %s", BookCatalog::sort_name(catalog.get_sort()));
+        return shelf_info;
+    }
     return status_buffer;
 }
 
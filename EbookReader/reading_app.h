@@ -2,6 +2,15 @@
 #define READING_APP_H
 
 #include "app_manager.h"
+#include "book_catalog.h"
+#include "virtual_list.h"
+#include "book_source.h"
+#include "epub_book.h"
+#include "text_window.h"
+#include "page_layout.h"
+#include "page_index.h"
+#include "src/font/sd_font.h"
+#include "src/font/glyph_cache.h"
 #include "lvgl.h"
 #include <SD.h>
 
@@ -9,44 +18,93 @@
 enum ReadingState {
     STATE_BOOKSHELF = 0,
     STATE_READING = 1,
-    STATE_MENU = 2
+    STATE_MENU = 2,
+    STATE_STATS = 3,
+    STATE_SETTINGS = 4
 };
 
 class ReadingApp : public BaseApp {
+public:
+    static const int MENU_ITEM_COUNT = 6;
+    static const int MENU_ROWS = 5;
+    static const int SETTING_COUNT = 4;
+    static const int BOOKSHELF_ROWS = 5;
+    
 private:
+    // Widgets are created once in create_ui() and only hidden/shown after
     lv_obj_t* label_content;
     lv_obj_t* menu_container;
-    lv_obj_t** menu_items_labels;
-    const char** menu_items_names;
+    lv_obj_t* menu_title;
+    VirtualList menu_list;             // The system menu, or the reading settings
     
     lv_style_t style_text;
     bool style_initialized;
     
     File book_file;
+    File text_file;                 // Text extracted from an EPUB book_file
     const char* book_path;
     unsigned long current_offset;
+    unsigned long next_offset;      // Start of the page after the one on screen
     int page_num;
     unsigned long total_file_size;
-    int estimated_total_pages;
+    uint32_t book_mtime;
+    uint32_t first_offset;          // Past the byte order mark, if any
+    BookSource* source;             // Text of book_file, null when no book is open
+    FileSource file_source;
+    GzipSource gzip_source;
+    
+    // Pages are laid out from the book text; the page on screen and the
+    // background indexer read it through windows of their own
+    PageLayout layout;
+    PageIndex page_index;
+    TextWindow page_text;
+    TextWindow index_text;
+    lv_timer_t* index_timer;
+    char index_path[32];
+    static const int INDEX_PERIOD_MS = 50;
+    static const int INDEX_PAGES_PER_TICK = 32;
+    static const int INDEX_TICK_MS = 10;
+    
+    // Starts of the pages turned past, for going back before the index has
+    // reached them
+    static const int BACK_PAGES = 32;
+    uint32_t back_pages[BACK_PAGES];
+    int back_head;
+    int back_count;
+    
+    // Reading settings, kept in /.reader/reading.cfg
+    struct ReadingSettings {
+        uint32_t magic;
+        uint16_t version;
+        uint8_t line_space;
+        uint8_t margin;
+        char font[32];              // File in READER_FONT_DIR, "" = the system text font
+    };
+    ReadingSettings settings;
+    ReadingSettings pending_settings;   // Edited in the settings list
+    int setting_selection;
+    sd_font_t body_font;            // The text font when another size is picked
+    glyph_cache_t body_glyphs;      // Glyph cache in front of body_font
     
-    // History for previous page tracking
-    unsigned long history_offsets[500];
-    bool history_valid[500];
+    // Font files to choose from; the first is the system text font
+    struct FontChoice {
+        char name[32];
+        uint16_t px_size;
+    };
+    static const int MAX_FONTS = 8;
+    FontChoice fonts[MAX_FONTS];
+    int font_count;
     
-    // Text buffer
-    static const int BUFFER_SIZE = 512;
-    char text_buffer[BUFFER_SIZE + 1];
+    // Page text, double buffered: the label shows one buffer
+    // (lv_label_set_text_static) while the next page is read into the other
+    static const int BUFFER_SIZE = 1024;
+    char text_buffers[2][BUFFER_SIZE + 1];
+    int text_front;
     
     // Status buffer for bottom bar
     char status_buffer[64];
     char last_status_buffer[64];
-    
-    // Timing for debounce
-    unsigned long last_key_time;
-    unsigned long boot_press_start;
-    unsigned long pwr_press_start;
-    bool boot_pressed;
-    bool pwr_pressed;
+    char shelf_info[24];
     
     // State management
     ReadingState current_state;
@@ -55,26 +113,62 @@ private:
     
     // Bookshelf state
     lv_obj_t* bookshelf_container;
-    lv_obj_t** book_labels;
-    const char** book_paths;
+    lv_obj_t* bookshelf_title;
+    lv_obj_t* bookshelf_empty_label;
+    VirtualList shelf_list;         // Rows bound to catalog entries a page at a time, in view order,
+                                    // after a ".." row in subfolders
+    BookCatalog catalog;
     int book_count;
     int bookshelf_selection;
-    static const int MAX_BOOKS = 50;
+    int open_book;                  // Catalog index of book_file, -1 = none
+    char book_path_buffer[CATALOG_PATH_SIZE];
+    // Scratch for the folder listing while the catalog is rebuilt, and the
+    // sorted view of the catalog (36 bytes per book)
+    static const size_t ARENA_SIZE = 256 * 1024;
     static const char* BOOKS_FOLDER;
+    static const char* CATALOG_PATH;
+    static const char* SETTINGS_PATH;
+    
+    // Internal methods - Widgets
+    void create_ui();
+    static void menu_item_text(void* ctx, int index, char* buf, size_t len);
+    static void shelf_item_text(void* ctx, int index, char* buf, size_t len);
+    lv_obj_t* create_panel(const char* title_text);
     
     // Internal methods - Reading
     void load_page(unsigned long offset);
+    char* next_text_buffer();
     void show_error(const char* msg);
-    int read_utf8_safe(File &f, char* buf, int maxLen);
-    void calculate_total_pages();
+    unsigned long previous_page_offset();
     void update_status_info();
     
+    // Internal methods - Page index
+    BookSource* open_source(uint32_t mtime);
+    void close_book();
+    void open_index();
+    void reanchor();
+    void index_step();
+    static void index_timer_cb(lv_timer_t* timer);
+    
+    // Internal methods - Settings
+    void load_settings();
+    void save_settings();
+    void apply_settings();
+    const lv_font_t* open_body_font();
+    void list_fonts();
+    int font_choice() const;
+    void show_settings();
+    void hide_settings();
+    void change_setting();
+    static void setting_item_text(void* ctx, int index, char* buf, size_t len);
+    
     // Internal methods - Menu
     void show_menu();
     void hide_menu();
     void update_menu_display();
     void execute_menu_action();
-    void cleanup_menu_ui();
+    void show_stats();
+    void begin_page_turn(const ButtonEvent& event);
     
     // Internal methods - Bookshelf
     void show_bookshelf();
@@ -82,9 +176,13 @@ private:
     void scan_books_folder();
     void create_books_folder_if_needed();
     void update_bookshelf_display();
+    void cycle_sort();
+    void open_shelf_folder(int index);
+    int shelf_entry(int row);
+    int parent_rows() const;
     void select_book();
-    void cleanup_bookshelf_ui();
-    bool is_book_file(const char* filename);
+    void clear_book_list();
+    void save_position();
     
 public:
     ReadingApp();
@@ -92,7 +190,10 @@ public:
     
     void init() override;
     void deinit() override;
-    void loop() override;
+    bool supports_suspend() override { return true; }
+    void suspend() override;
+    void resume() override;
+    void on_button(const ButtonEvent& event) override;
     const char* get_app_info() override;
     const char* get_app_name() override;
     
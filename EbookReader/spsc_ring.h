@@ -0,0 +1,46 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <stdint.h>
+#include <atomic>
+
+// Lock-free ring for exactly one producer and one consumer.
+// The producer may be an ISR and the consumer a task on the other core:
+// each side only writes its own index, and the release/acquire pair
+// publishes the item before the index that makes it visible.
+template <typename T, uint32_t N>
+class SpscRing {
+    static_assert(N > 0 && (N & (N - 1)) == 0, "SpscRing size must be a power of two");
+
+private:
+    T items[N];
+    std::atomic<uint32_t> head;  // Written by the producer only
+    std::atomic<uint32_t> tail;  // Written by the consumer only
+
+public:
+    SpscRing() : head(0), tail(0) {}
+
+    // Producer side. Returns false (and drops the item) when full.
+    bool push(const T& item) {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) >= N) return false;
+        items[h & (N - 1)] = item;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side. Returns false when empty.
+    bool pop(T& item) {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire)) return false;
+        item = items[t & (N - 1)];
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const {
+        return tail.load(std::memory_order_acquire) == head.load(std::memory_order_acquire);
+    }
+};
+
+#endif
@@ -0,0 +1,436 @@
+#include <string.h>
+#include "inflate.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+
+static const char *TAG = "inflate";
+
+#define WINDOW_MASK (INFLATE_WINDOW_SIZE - 1)
+
+/* Base lengths and extra bits of length symbols 257-285 */
+static const uint16_t LENGTH_BASE[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+static const uint8_t LENGTH_EXTRA[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+/* Base offsets and extra bits of distance symbols 0-29 */
+static const uint16_t DIST_BASE[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+static const uint8_t DIST_EXTRA[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+/* Order of the code length code lengths in a dynamic block header */
+static const uint8_t CLEN_ORDER[19] = {
+    16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+inflate_t::inflate_t() :
+    file(NULL),
+    in_buf(NULL),
+    in_base(0),
+    in_len(0),
+    in_pos(0),
+    overrun(0),
+    bit_buf(0),
+    bit_count(0),
+    win(NULL),
+    out(0),
+    state(ST_DONE),
+    last_block(false),
+    stored_left(0),
+    copy_len(0),
+    copy_dist(0),
+    lencode(NULL),
+    distcode(NULL),
+    fixed_len(NULL),
+    fixed_dist(NULL),
+    dyn_len(NULL),
+    dyn_dist(NULL),
+    boundary_cb(NULL),
+    boundary_ctx(NULL) {
+}
+
+bool inflate_t::begin() {
+    if (win) return true;
+    in_buf = (uint8_t *)heap_caps_malloc(INFLATE_INPUT_SIZE, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    win = (uint8_t *)heap_caps_malloc(INFLATE_WINDOW_SIZE, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    huffman_t *tables = (huffman_t *)heap_caps_malloc(4 * sizeof(huffman_t), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!in_buf || !win || !tables) {
+        ESP_LOGE(TAG, "No memory for the inflate window");
+        heap_caps_free(in_buf);
+        heap_caps_free(win);
+        heap_caps_free(tables);
+        in_buf = NULL;
+        win = NULL;
+        return false;
+    }
+    fixed_len = &tables[0];
+    fixed_dist = &tables[1];
+    dyn_len = &tables[2];
+    dyn_dist = &tables[3];
+
+    /* The fixed codes of RFC 1951 3.2.6 */
+    uint8_t lengths[288];
+    int i = 0;
+    for (; i < 144; i++) lengths[i] = 8;
+    for (; i < 256; i++) lengths[i] = 9;
+    for (; i < 280; i++) lengths[i] = 7;
+    for (; i < 288; i++) lengths[i] = 8;
+    build(fixed_len, lengths, 288);
+    for (i = 0; i < 30; i++) lengths[i] = 5;
+    build(fixed_dist, lengths, 30);
+
+    state = ST_DONE;
+    return true;
+}
+
+void inflate_t::end() {
+    heap_caps_free(in_buf);
+    heap_caps_free(win);
+    heap_caps_free(fixed_len);
+    in_buf = NULL;
+    win = NULL;
+    fixed_len = fixed_dist = dyn_len = dyn_dist = NULL;
+    lencode = distcode = NULL;
+    file = NULL;
+    state = ST_DONE;
+}
+
+void inflate_t::seek_input(uint32_t offset, int skip_bits) {
+    in_base = offset;
+    in_len = 0;
+    in_pos = 0;
+    overrun = 0;
+    bit_buf = 0;
+    bit_count = 0;
+    if (skip_bits > 0 && need(skip_bits)) bits(skip_bits);
+}
+
+void inflate_t::start(File *f, uint32_t offset) {
+    file = f;
+    out = 0;
+    last_block = false;
+    copy_len = 0;
+    stored_left = 0;
+    state = ST_HEADER;
+    seek_input(offset, 0);
+}
+
+void inflate_t::resume(File *f, const inflate_point_t &at) {
+    file = f;
+    out = at.out;
+    last_block = false;
+    copy_len = 0;
+    stored_left = 0;
+    state = ST_HEADER;
+    seek_input(at.in, at.bits & 7);
+}
+
+void inflate_t::point(inflate_point_t *at) const {
+    uint32_t used = (in_base + in_pos) * 8 - bit_count;
+    at->out = out;
+    at->in = used / 8;
+    at->bits = used % 8;
+    memset(at->reserved, 0, sizeof(at->reserved));
+}
+
+uint32_t inflate_t::end_offset() const {
+    /* The last block ends mid-byte; the rest of that byte is padding.
+     * Bytes made up past the end of the file were never in the file. */
+    int buffered = bit_count - (int)overrun * 8;
+    return in_base + in_pos - (buffered > 0 ? buffered / 8 : 0);
+}
+
+bool inflate_t::refill() {
+    in_base += in_len;
+    in_pos = 0;
+    in_len = 0;
+    if (!file->seek(in_base)) return false;
+    int got = file->read(in_buf, INFLATE_INPUT_SIZE);
+    if (got <= 0) return false;
+    in_len = got;
+    return true;
+}
+
+/* At least `n` bits in bit_buf; past the end of the file they are zeros,
+ * and using them is an error caught by the callers */
+inline bool inflate_t::need(int n) {
+    while (bit_count < n) {
+        uint32_t c = 0;
+        if (in_pos < in_len || refill()) {
+            c = in_buf[in_pos++];
+        } else if (++overrun > 4) {
+            return false;
+        }
+        bit_buf |= c << bit_count;
+        bit_count += 8;
+    }
+    return true;
+}
+
+inline uint32_t inflate_t::bits(int n) {
+    uint32_t v = bit_buf & ((1u << n) - 1);
+    bit_buf >>= n;
+    bit_count -= n;
+    return v;
+}
+
+static uint32_t reverse_bits(uint32_t code, int len) {
+    uint32_t r = 0;
+    for (int i = 0; i < len; i++) {
+        r = (r << 1) | (code & 1);
+        code >>= 1;
+    }
+    return r;
+}
+
+/* False if the lengths describe more codes than the lengths allow */
+bool inflate_t::build(huffman_t *h, const uint8_t *lengths, int n) {
+    memset(h->count, 0, sizeof(h->count));
+    for (int s = 0; s < n; s++) h->count[lengths[s]]++;
+    if (h->count[0] == n) {
+        /* No codes: any decode fails */
+        memset(h->fast, 0, sizeof(h->fast));
+        return true;
+    }
+
+    int left = 1;
+    for (int len = 1; len <= MAX_BITS; len++) {
+        left <<= 1;
+        left -= h->count[len];
+        if (left < 0) return false;
+    }
+
+    uint16_t offs[MAX_BITS + 1];
+    uint32_t next_code[MAX_BITS + 1];
+    offs[1] = 0;
+    next_code[1] = 0;
+    for (int len = 1; len < MAX_BITS; len++) {
+        offs[len + 1] = offs[len] + h->count[len];
+        next_code[len + 1] = (next_code[len] + h->count[len]) << 1;
+    }
+
+    memset(h->fast, 0, sizeof(h->fast));
+    for (int s = 0; s < n; s++) {
+        int len = lengths[s];
+        if (len == 0) continue;
+        h->symbol[offs[len]++] = s;
+        uint32_t code = next_code[len]++;
+        if (len <= FAST_BITS) {
+            uint16_t entry = (uint16_t)((len << 9) | s);
+            for (uint32_t i = reverse_bits(code, len); i < (1u << FAST_BITS); i += 1u << len) {
+                h->fast[i] = entry;
+            }
+        }
+    }
+    return true;
+}
+
+int inflate_t::decode(const huffman_t *h) {
+    if (!need(MAX_BITS) && bit_count == 0) return -1;
+    uint16_t entry = h->fast[bit_buf & ((1u << FAST_BITS) - 1)];
+    if (entry) {
+        int len = entry >> 9;
+        if (len > bit_count) return -1;
+        bits(len);
+        return overran() ? -1 : entry & 0x1FF;
+    }
+
+    /* Longer than FAST_BITS: canonical decode, a bit at a time */
+    int code = 0;
+    int first = 0;
+    int index = 0;
+    uint32_t buf = bit_buf;
+    for (int len = 1; len <= MAX_BITS && len <= bit_count; len++) {
+        code |= buf & 1;
+        buf >>= 1;
+        int count = h->count[len];
+        if (code - count < first) {
+            bits(len);
+            return overran() ? -1 : h->symbol[index + (code - first)];
+        }
+        index += count;
+        first += count;
+        first <<= 1;
+        code <<= 1;
+    }
+    return -1;
+}
+
+bool inflate_t::dynamic_tables() {
+    if (!need(14)) return false;
+    int nlen = bits(5) + 257;
+    int ndist = bits(5) + 1;
+    int ncode = bits(4) + 4;
+    if (nlen > 286 || ndist > 30) return false;
+
+    uint8_t lengths[320];
+    memset(lengths, 0, 19);
+    for (int i = 0; i < ncode; i++) {
+        if (!need(3)) return false;
+        lengths[CLEN_ORDER[i]] = bits(3);
+    }
+    /* The code length code goes in dyn_len until the real one is built */
+    if (!build(dyn_len, lengths, 19)) return false;
+
+    int index = 0;
+    while (index < nlen + ndist) {
+        int sym = decode(dyn_len);
+        if (sym < 0) return false;
+        if (sym < 16) {
+            lengths[index++] = sym;
+            continue;
+        }
+        int len = 0;
+        int repeat;
+        if (sym == 16) {
+            if (index == 0 || !need(2)) return false;
+            len = lengths[index - 1];
+            repeat = 3 + bits(2);
+        } else if (sym == 17) {
+            if (!need(3)) return false;
+            repeat = 3 + bits(3);
+        } else {
+            if (!need(7)) return false;
+            repeat = 11 + bits(7);
+        }
+        if (index + repeat > nlen + ndist) return false;
+        while (repeat--) lengths[index++] = len;
+    }
+    if (lengths[256] == 0) return false;
+
+    if (!build(dyn_len, lengths, nlen)) return false;
+    if (!build(dyn_dist, lengths + nlen, ndist)) return false;
+    lencode = dyn_len;
+    distcode = dyn_dist;
+    return true;
+}
+
+bool inflate_t::block_header() {
+    if (!need(3)) return false;
+    last_block = bits(1) != 0;
+    int type = bits(2);
+    if (type == 0) {
+        /* Stored: the rest of this byte is unused, then LEN and NLEN */
+        bits(bit_count & 7);
+        if (!need(16)) return false;
+        uint32_t len = bits(16);
+        if (!need(16)) return false;
+        uint32_t nlen = bits(16);
+        if (len != (~nlen & 0xFFFF)) return false;
+        stored_left = len;
+        state = ST_STORED;
+    } else if (type == 1) {
+        lencode = fixed_len;
+        distcode = fixed_dist;
+        state = ST_CODES;
+    } else if (type == 2) {
+        if (!dynamic_tables()) return false;
+        state = ST_CODES;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+int inflate_t::read(uint8_t *dst, int len) {
+    int n = 0;
+    while (n < len) {
+        switch (state) {
+            case ST_HEADER:
+                if (boundary_cb && overrun == 0) boundary_cb(boundary_ctx, this);
+                if (!block_header()) {
+                    ESP_LOGW(TAG, "Bad block header at %lu", (unsigned long)out);
+                    state = ST_ERROR;
+                }
+                break;
+
+            case ST_STORED:
+                while (stored_left > 0 && n < len) {
+                    if (!need(8)) {
+                        state = ST_ERROR;
+                        return -1;
+                    }
+                    uint8_t c = bits(8);
+                    if (overran()) {
+                        state = ST_ERROR;
+                        return -1;
+                    }
+                    win[out & WINDOW_MASK] = c;
+                    if (dst) dst[n] = c;
+                    n++;
+                    out++;
+                    stored_left--;
+                }
+                if (stored_left == 0) state = last_block ? ST_DONE : ST_HEADER;
+                break;
+
+            case ST_CODES:
+                while (n < len) {
+                    if (copy_len > 0) {
+                        /* A match, possibly left over from the last call */
+                        uint32_t from = out - copy_dist;
+                        while (copy_len > 0 && n < len) {
+                            uint8_t c = win[from++ & WINDOW_MASK];
+                            win[out & WINDOW_MASK] = c;
+                            if (dst) dst[n] = c;
+                            n++;
+                            out++;
+                            copy_len--;
+                        }
+                        continue;
+                    }
+                    int sym = decode(lencode);
+                    if (sym < 0) {
+                        state = ST_ERROR;
+                        break;
+                    }
+                    if (sym < 256) {
+                        win[out & WINDOW_MASK] = (uint8_t)sym;
+                        if (dst) dst[n] = (uint8_t)sym;
+                        n++;
+                        out++;
+                        continue;
+                    }
+                    if (sym == 256) {
+                        state = last_block ? ST_DONE : ST_HEADER;
+                        break;
+                    }
+                    sym -= 257;
+                    if (sym >= 29) {
+                        state = ST_ERROR;
+                        break;
+                    }
+                    if (!need(LENGTH_EXTRA[sym])) {
+                        state = ST_ERROR;
+                        break;
+                    }
+                    copy_len = LENGTH_BASE[sym] + bits(LENGTH_EXTRA[sym]);
+                    int dsym = decode(distcode);
+                    if (dsym < 0 || dsym >= 30 || !need(DIST_EXTRA[dsym])) {
+                        state = ST_ERROR;
+                        break;
+                    }
+                    copy_dist = DIST_BASE[dsym] + bits(DIST_EXTRA[dsym]);
+                    if (copy_dist > out || copy_dist > INFLATE_WINDOW_SIZE) {
+                        state = ST_ERROR;
+                        break;
+                    }
+                }
+                if (state == ST_ERROR) {
+                    ESP_LOGW(TAG, "Corrupt data at %lu", (unsigned long)out);
+                    copy_len = 0;
+                }
+                break;
+
+            case ST_DONE:
+                return n;
+
+            default:
+                return -1;
+        }
+        if (state == ST_ERROR) return -1;
+    }
+    return n;
+}
@@ -0,0 +1,132 @@
+#ifndef INFLATE_H
+#define INFLATE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <SD.h>
+
+/* Bytes of compressed input read from the card at a time */
+#ifndef INFLATE_INPUT_SIZE
+#define INFLATE_INPUT_SIZE 4096
+#endif
+
+/* Deflate looks back at most this far; the window holds that much output */
+#define INFLATE_WINDOW_SIZE 32768
+
+/*
+ * Where a deflate stream can be picked up again: the start of a block.
+ * With the INFLATE_WINDOW_SIZE bytes of output before it, decoding can
+ * resume there without the stream before it.
+ */
+typedef struct {
+    uint32_t out;                /* Output bytes before this point */
+    uint32_t in;                 /* File offset of the byte holding the next bit */
+    uint8_t bits;                /* Bits of that byte already used, 0-7 */
+    uint8_t reserved[3];
+} inflate_point_t;
+
+/*
+ * Streaming decoder for raw deflate data (RFC 1951) in a file.
+ *
+ * read() pulls decoded bytes on demand, so a caller only pays for the
+ * output it asks for. Output goes through a circular window of the last
+ * INFLATE_WINDOW_SIZE bytes, which doubles as a cache: window_byte() reads
+ * any of them back without decoding again.
+ *
+ * Every time the decoder is about to start a block it calls the boundary
+ * callback; point() and window() then describe a place that resume() can
+ * restart from later. The caller decides which of them to keep.
+ *
+ * Huffman codes up to INFLATE_FAST_BITS long are decoded with one table
+ * lookup, longer ones bit by bit. Window and tables are in PSRAM.
+ */
+class inflate_t {
+public:
+    typedef void (*boundary_cb_t)(void *ctx, inflate_t *stream);
+
+    inflate_t();
+
+    bool begin();
+    void end();
+
+    /* Start of the stream, at byte `offset` of `file` */
+    void start(File *file, uint32_t offset);
+    /* From a saved point; fill window() with its window before reading */
+    void resume(File *file, const inflate_point_t &at);
+
+    /* Up to `len` bytes of output into `dst`, or skipped when `dst` is NULL.
+     * Returns the count; 0 at the end of the stream, -1 on corrupt data. */
+    int read(uint8_t *dst, int len);
+
+    uint32_t out_pos() const { return out; }
+    bool finished() const { return state == ST_DONE; }
+    bool failed() const { return state == ST_ERROR; }
+    /* File offset just after the last block, once finished */
+    uint32_t end_offset() const;
+
+    void point(inflate_point_t *at) const;
+    /* Output byte `pos` is at window()[pos % INFLATE_WINDOW_SIZE] */
+    uint8_t *window() { return win; }
+    /* Output byte `pos`, if it is still in the window; -1 otherwise */
+    int window_byte(uint32_t pos) const {
+        return pos < out && out - pos <= INFLATE_WINDOW_SIZE ? win[pos % INFLATE_WINDOW_SIZE] : -1;
+    }
+
+    void set_boundary_cb(boundary_cb_t cb, void *ctx) { boundary_cb = cb; boundary_ctx = ctx; }
+
+private:
+    static const int FAST_BITS = 9;
+    static const int MAX_BITS = 15;
+
+    /* Canonical code: counts per length and symbols in code order, plus
+     * the one-lookup table, entry = length << 9 | symbol, 0 = longer code */
+    struct huffman_t {
+        uint16_t count[MAX_BITS + 1];
+        uint16_t symbol[288];
+        uint16_t fast[1 << FAST_BITS];
+    };
+
+    enum { ST_HEADER, ST_STORED, ST_CODES, ST_DONE, ST_ERROR };
+
+    File *file;
+    uint8_t *in_buf;
+    uint32_t in_base;            /* File offset of in_buf[0] */
+    uint32_t in_len;
+    uint32_t in_pos;
+    uint32_t overrun;            /* Zero bytes made up past the end of the file */
+    uint32_t bit_buf;
+    int bit_count;
+
+    uint8_t *win;
+    uint32_t out;
+
+    int state;
+    bool last_block;
+    uint32_t stored_left;
+    uint32_t copy_len;
+    uint32_t copy_dist;
+
+    huffman_t *lencode;
+    huffman_t *distcode;
+    huffman_t *fixed_len;
+    huffman_t *fixed_dist;
+    huffman_t *dyn_len;
+    huffman_t *dyn_dist;
+
+    boundary_cb_t boundary_cb;
+    void *boundary_ctx;
+
+    bool refill();
+    inline bool need(int n);
+    /* Bits made up past the end of the file were used */
+    bool overran() const { return (int)(overrun * 8) > bit_count; }
+    inline uint32_t bits(int n);
+
+    static bool build(huffman_t *h, const uint8_t *lengths, int n);
+    int decode(const huffman_t *h);
+    bool block_header();
+    bool dynamic_tables();
+    void seek_input(uint32_t offset, int skip_bits);
+};
+
+#endif
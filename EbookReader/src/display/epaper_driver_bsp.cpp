@@ -6,6 +6,8 @@
 #include "esp_log.h"
 
 #include "esp_heap_caps.h" 
+#include "esp_timer.h"
+#include "epd_trace.h"
 
 static const char *TAG = "driver";
 
@@ -120,10 +122,16 @@ void epaper_driver_display::spi_port_init() {
 
 void epaper_driver_display::read_busy() {
     int busy = lcd_spi_data.busy;
+#if EPD_TRACE_ENABLE
+    int64_t start = esp_timer_get_time();
+#endif
     while(gpio_get_level((gpio_num_t)busy) == 1) 
 	{
         vTaskDelay(pdMS_TO_TICKS(5));   //LOW: idle, HIGH: busy
     }
+#if EPD_TRACE_ENABLE
+    epd_trace.busy((uint32_t)(esp_timer_get_time() - start));
+#endif
 }
 
 void epaper_driver_display::SPI_SendByte(uint8_t data) {
@@ -137,6 +145,9 @@ void epaper_driver_display::SPI_SendByte(uint8_t data) {
 }
 
 void epaper_driver_display::EPD_SendData(uint8_t data) {
+#if EPD_TRACE_ENABLE
+    epd_trace.data(&data, 1);
+#endif
     set_dc_1();
   	set_cs_0();
   	SPI_SendByte(data);
@@ -144,6 +155,9 @@ void epaper_driver_display::EPD_SendData(uint8_t data) {
 }
 
 void epaper_driver_display::EPD_SendCommand(uint8_t command) {
+#if EPD_TRACE_ENABLE
+    epd_trace.command(command);
+#endif
     set_dc_0();
   	set_cs_0();
   	SPI_SendByte(command);
@@ -151,6 +165,9 @@ void epaper_driver_display::EPD_SendCommand(uint8_t command) {
 }
 
 void epaper_driver_display::writeBytes(uint8_t *buffer,int len) {
+#if EPD_TRACE_ENABLE
+    epd_trace.data(buffer, len);
+#endif
     set_dc_1();
   	set_cs_0();
   	esp_err_t ret;
@@ -164,6 +181,9 @@ void epaper_driver_display::writeBytes(uint8_t *buffer,int len) {
 }
 
 void epaper_driver_display::writeBytes(const uint8_t *buffer, int len) {
+#if EPD_TRACE_ENABLE
+    epd_trace.data(buffer, len);
+#endif
     set_dc_1();
   	set_cs_0();
   	esp_err_t ret;
@@ -328,10 +348,14 @@ void epaper_driver_display::EPD_Init_Partial() {
 }
 
 void epaper_driver_display::EPD_DisplayPart() {
+    int64_t start = esp_timer_get_time();
     EPD_SendCommand(0x24);
     assert(buffer);
     writeBytes(buffer,5000);
+    int64_t sent = esp_timer_get_time();
     EPD_TurnOnDisplayPart();
+    last_transfer_us = (uint32_t)(sent - start);
+    last_busy_us = (uint32_t)(esp_timer_get_time() - sent);
 }
 
 void epaper_driver_display::EPD_DrawColorPixel(uint16_t x, uint16_t y,uint8_t color) {
@@ -22,6 +22,10 @@ typedef struct {
     int buffer_len;
 }custom_lcd_spi_t;
 
+/* Waveform LUTs (153 LUT bytes + 6 voltage bytes) */
+extern const uint8_t WF_Full_1IN54[159];
+extern unsigned char WF_PARTIAL_1IN54_0[159];
+
 class epaper_driver_display {
 private:
     const custom_lcd_spi_t lcd_spi_data;
@@ -29,6 +33,8 @@ private:
     const int Height;
     spi_device_handle_t spi;
     uint8_t *buffer = NULL;
+    uint32_t last_transfer_us = 0;
+    uint32_t last_busy_us = 0;
 
     void spi_gpio_init();
     void spi_port_init();
@@ -65,5 +71,9 @@ public:
     void EPD_Init_Partial();
     void EPD_DisplayPart();
     void EPD_DrawColorPixel(uint16_t x, uint16_t y,uint8_t color);
+
+    /* Timing of the last EPD_DisplayPart(), in us */
+    uint32_t get_last_transfer_us() const { return last_transfer_us; }
+    uint32_t get_last_busy_us() const { return last_busy_us; }
 };
 #endif
@@ -0,0 +1,165 @@
+#include <stdio.h>
+#include <string.h>
+#include "epd_trace.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+
+epd_trace_t epd_trace;
+
+uint32_t epd_trace_crc32(uint32_t crc, const uint8_t *data, int len)
+{
+    crc = ~crc;
+    for (int i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (int b = 0; b < 8; b++) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+epd_trace_t::epd_trace_t() :
+    records(NULL),
+    capacity(0),
+    head(0),
+    used(0),
+    dropped_records(0),
+    enabled(false),
+    data_crc(0),
+    mark_count(0) {
+    memset(marks, 0, sizeof(marks));
+    portMUX_INITIALIZE(&lock);
+}
+
+bool epd_trace_t::begin(int cap) {
+    if (records) return true;
+    records = (epd_trace_record_t *)heap_caps_malloc(cap * sizeof(epd_trace_record_t), MALLOC_CAP_SPIRAM);
+    if (!records) return false;
+    capacity = cap;
+    clear();
+    enabled = true;
+    return true;
+}
+
+void epd_trace_t::clear() {
+    portENTER_CRITICAL(&lock);
+    head = 0;
+    used = 0;
+    dropped_records = 0;
+    portEXIT_CRITICAL(&lock);
+}
+
+epd_trace_record_t *epd_trace_t::push(uint8_t type, uint8_t value) {
+    int index = (head + used) % capacity;
+    if (used == capacity) {
+        head = (head + 1) % capacity;
+        dropped_records++;
+    } else {
+        used++;
+    }
+
+    epd_trace_record_t *r = &records[index];
+    r->timestamp_us = (uint32_t)esp_timer_get_time();
+    r->type = type;
+    r->value = value;
+    r->reserved = 0;
+    r->length = 0;
+    r->payload = 0;
+    return r;
+}
+
+epd_trace_record_t *epd_trace_t::last() {
+    if (used == 0) return NULL;
+    return &records[(head + used - 1) % capacity];
+}
+
+void epd_trace_t::command(uint8_t cmd) {
+    if (!enabled) return;
+    portENTER_CRITICAL(&lock);
+    push(EPD_TRACE_COMMAND, cmd);
+    portEXIT_CRITICAL(&lock);
+}
+
+void epd_trace_t::data(const uint8_t *buf, int len) {
+    if (!enabled || len <= 0) return;
+
+    /* Parameter bytes sent one at a time after a command fold into one
+     * record. The CRC of a framebuffer write is worked out before taking the
+     * lock, so interrupts are not held off while it runs. Once setup() is
+     * done, every record (driver traffic and marks alike) and dump() and
+     * clear() run on the LVGL task, so the last record cannot change
+     * between here and the lock. */
+    const epd_trace_record_t *prev = last();
+    bool fold = prev && prev->type == EPD_TRACE_DATA;
+    uint32_t crc = epd_trace_crc32(fold ? data_crc : 0, buf, len);
+
+    portENTER_CRITICAL(&lock);
+    epd_trace_record_t *r = last();
+    if (!fold || !r || r->type != EPD_TRACE_DATA) r = push(EPD_TRACE_DATA, 0);
+
+    for (int i = 0; i < len && r->length + i < INLINE_BYTES; i++) {
+        r->payload |= (uint32_t)buf[i] << (8 * (r->length + i));
+    }
+    data_crc = crc;
+    r->length += len;
+    if (r->length > INLINE_BYTES) r->payload = data_crc;
+
+    portEXIT_CRITICAL(&lock);
+}
+
+void epd_trace_t::busy(uint32_t duration_us) {
+    if (!enabled) return;
+    portENTER_CRITICAL(&lock);
+    epd_trace_record_t *r = push(EPD_TRACE_BUSY, 0);
+    r->length = duration_us;
+    portEXIT_CRITICAL(&lock);
+}
+
+void epd_trace_t::mark(const char *name) {
+    if (!enabled) return;
+    portENTER_CRITICAL(&lock);
+    int id = 0;
+    while (id < mark_count && marks[id] != name) id++;
+    if (id == mark_count && mark_count < MAX_MARKS) marks[mark_count++] = name;
+    if (id < MAX_MARKS) push(EPD_TRACE_MARK, (uint8_t)id);
+    portEXIT_CRITICAL(&lock);
+}
+
+const epd_trace_record_t *epd_trace_t::get(int i) const {
+    if (i < 0 || i >= used) return NULL;
+    return &records[(head + i) % capacity];
+}
+
+const char *epd_trace_t::mark_name(uint8_t id) const {
+    return (id < mark_count) ? marks[id] : "?";
+}
+
+void epd_trace_t::dump(void (*print_line)(const char *line)) {
+    char line[64];
+    bool was_enabled = enabled;
+    enabled = false;
+
+    snprintf(line, sizeof(line), "# epd-trace v1 records=%d dropped=%lu", used, (unsigned long)dropped_records);
+    print_line(line);
+    for (int i = 0; i < used; i++) {
+        const epd_trace_record_t *r = get(i);
+        switch (r->type) {
+        case EPD_TRACE_COMMAND:
+            snprintf(line, sizeof(line), "C %lu %02x", (unsigned long)r->timestamp_us, r->value);
+            break;
+        case EPD_TRACE_DATA:
+            snprintf(line, sizeof(line), "D %lu %lu %08lx", (unsigned long)r->timestamp_us,
+                     (unsigned long)r->length, (unsigned long)r->payload);
+            break;
+        case EPD_TRACE_BUSY:
+            snprintf(line, sizeof(line), "B %lu %lu", (unsigned long)r->timestamp_us, (unsigned long)r->length);
+            break;
+        default:
+            snprintf(line, sizeof(line), "M %lu %s", (unsigned long)r->timestamp_us, mark_name(r->value));
+            break;
+        }
+        print_line(line);
+    }
+
+    enabled = was_enabled;
+}
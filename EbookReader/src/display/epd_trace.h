@@ -0,0 +1,86 @@
+#ifndef EPD_TRACE_H
+#define EPD_TRACE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "freertos/FreeRTOS.h"
+
+/* Set to 0 to compile the trace hooks out of the driver */
+#ifndef EPD_TRACE_ENABLE
+#define EPD_TRACE_ENABLE 1
+#endif
+
+typedef enum {
+    EPD_TRACE_COMMAND = 'C',    /* value: command byte */
+    EPD_TRACE_DATA    = 'D',    /* length: bytes, payload: first bytes or CRC32 */
+    EPD_TRACE_BUSY    = 'B',    /* length: BUSY wait in us */
+    EPD_TRACE_MARK    = 'M',    /* value: mark id, start of a UI action */
+}EPD_TRACE_TYPE;
+
+typedef struct {
+    uint32_t timestamp_us;
+    uint8_t type;
+    uint8_t value;
+    uint16_t reserved;
+    uint32_t length;
+    uint32_t payload;   /* Up to 4 data bytes inline, CRC32 for longer writes */
+}epd_trace_record_t;
+
+class epd_trace_t {
+public:
+    static const int INLINE_BYTES = 4;
+    static const int MAX_MARKS = 32;
+
+    epd_trace_t();
+
+    /* Allocate the ring buffer (in PSRAM) and start recording */
+    bool begin(int capacity);
+    void set_enabled(bool en) { enabled = en && records; }
+    bool is_enabled() const { return enabled; }
+    void clear();
+
+    void command(uint8_t cmd);
+    void data(const uint8_t *buf, int len);
+    void busy(uint32_t duration_us);
+    /* Label the records that follow; name must be a string literal */
+    void mark(const char *name);
+
+    int count() const { return used; }
+    uint32_t dropped() const { return dropped_records; }
+    /* i = 0 is the oldest record still in the ring */
+    const epd_trace_record_t *get(int i) const;
+    const char *mark_name(uint8_t id) const;
+
+    /* Print the ring in the text format read by simulator/trace_replay.
+     * After setup() records are pushed from the LVGL task only, marks
+     * included: call this and clear() there too. */
+    void dump(void (*print_line)(const char *line));
+
+private:
+    epd_trace_record_t *records;
+    int capacity;
+    int head;
+    int used;
+    uint32_t dropped_records;
+    bool enabled;
+    uint32_t data_crc;
+    const char *marks[MAX_MARKS];
+    int mark_count;
+    portMUX_TYPE lock;
+
+    epd_trace_record_t *push(uint8_t type, uint8_t value);
+    epd_trace_record_t *last();
+};
+
+extern epd_trace_t epd_trace;
+
+/* Start of a UI action, used to group the records that follow */
+#if EPD_TRACE_ENABLE
+#define EPD_TRACE_MARK(name) epd_trace.mark(name)
+#else
+#define EPD_TRACE_MARK(name) do {} while (0)
+#endif
+
+uint32_t epd_trace_crc32(uint32_t crc, const uint8_t *data, int len);
+
+#endif
@@ -0,0 +1,386 @@
+#include <stdio.h>
+#include <string.h>
+#include "glyph_cache.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+
+static const char *TAG = "glyphs";
+
+glyph_cache_t glyph_cache;
+bool glyph_cache_t::enabled = true;
+
+/* Coverage from which a pixel is inked; the flush maps darker than mid grey to black */
+static const uint8_t INK_THRESHOLD = 0x80;
+
+/* Fibonacci hashing: the top bits of the product pick one of the 1024 buckets */
+static inline uint32_t bucket_of(uint32_t letter) {
+    return (letter * 2654435761u) >> 22;
+}
+
+glyph_cache_t::glyph_cache_t() :
+    base(NULL),
+    ready(false),
+    kerning(false),
+    bitmap_bytes(0),
+    buckets(NULL),
+    last_slot(NONE),
+    sram_hits(0),
+    psram_hits(0),
+    misses(0),
+    bitmap_hits(0),
+    bitmap_misses(0),
+    evictions(0),
+    uncached(0) {
+    memset(&wrapper, 0, sizeof(wrapper));
+    memset(&sram, 0, sizeof(sram));
+    memset(&psram, 0, sizeof(psram));
+}
+
+bool glyph_cache_t::begin(const lv_font_t *font, uint16_t sram_slots, uint16_t psram_slots) {
+    if (ready) end();
+    base = font;
+    if (!base || sram_slots == 0 || (uint32_t)sram_slots + psram_slots >= NONE) return false;
+    if (!enabled) {
+        ESP_LOGI(TAG, "Off, glyphs come from the font");
+        return false;
+    }
+
+    /* Room for a glyph as tall as the line, the usual largest box of a text font */
+    uint32_t line = base->line_height > 0 ? (uint32_t)base->line_height : 1;
+    uint32_t bytes = (line + 7) / 8 * line;
+    bitmap_bytes = (uint16_t)(bytes < GLYPH_CACHE_BITMAP_BYTES ? bytes : GLYPH_CACHE_BITMAP_BYTES);
+
+    sram.slots = (slot_t *)heap_caps_malloc(sram_slots * sizeof(slot_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    sram.bitmaps = (uint8_t *)heap_caps_malloc((uint32_t)sram_slots * bitmap_bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    buckets = (uint16_t *)heap_caps_malloc(BUCKET_COUNT * sizeof(uint16_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!sram.slots || !sram.bitmaps || !buckets) {
+        ESP_LOGE(TAG, "No internal RAM for %u glyphs", (unsigned)sram_slots);
+        end();
+        return false;
+    }
+    sram.first = 0;
+    sram.count = sram_slots;
+
+    if (psram_slots > 0) {
+        psram.slots = (slot_t *)heap_caps_malloc(psram_slots * sizeof(slot_t), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        psram.bitmaps = (uint8_t *)heap_caps_malloc((uint32_t)psram_slots * bitmap_bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (!psram.slots || !psram.bitmaps) {
+            heap_caps_free(psram.slots);
+            heap_caps_free(psram.bitmaps);
+            psram.slots = NULL;
+            psram.bitmaps = NULL;
+            ESP_LOGW(TAG, "No PSRAM, caching %u glyphs in SRAM only", (unsigned)sram_slots);
+            psram_slots = 0;
+        }
+    }
+    psram.first = sram_slots;
+    psram.count = psram_slots;
+
+    /* Without kerning pairs the advance does not depend on the next letter */
+    kerning = base->kerning == LV_FONT_KERNING_NORMAL;
+    if (base->get_glyph_dsc == lv_font_get_glyph_dsc_fmt_txt &&
+        ((const lv_font_fmt_txt_dsc_t *)base->dsc)->kern_dsc == NULL) {
+        kerning = false;
+    }
+
+    wrapper = *base;
+    wrapper.get_glyph_dsc = get_dsc_cb;
+    wrapper.get_glyph_bitmap = get_bitmap_cb;
+    wrapper.release_glyph = base->release_glyph ? release_glyph_cb : NULL;
+    wrapper.user_data = this;
+
+    clear();
+    ready = true;
+    ESP_LOGI(TAG, "%u glyphs in SRAM, %u in PSRAM (%u bytes each)", (unsigned)sram.count,
+             (unsigned)psram.count, (unsigned)(sizeof(slot_t) + bitmap_bytes));
+    return true;
+}
+
+void glyph_cache_t::end() {
+    heap_caps_free(sram.slots);
+    heap_caps_free(psram.slots);
+    heap_caps_free(sram.bitmaps);
+    heap_caps_free(psram.bitmaps);
+    heap_caps_free(buckets);
+    memset(&sram, 0, sizeof(sram));
+    memset(&psram, 0, sizeof(psram));
+    buckets = NULL;
+    ready = false;
+}
+
+void glyph_cache_t::clear() {
+    for (int i = 0; i < BUCKET_COUNT; i++) buckets[i] = NONE;
+    sram.used = 0;
+    sram.head = sram.tail = NONE;
+    psram.used = 0;
+    psram.head = psram.tail = NONE;
+    last_slot = NONE;
+}
+
+/* ---------- LVGL font interface ---------- */
+
+bool glyph_cache_t::get_dsc_cb(const lv_font_t *font, lv_font_glyph_dsc_t *dsc, uint32_t letter,
+                               uint32_t letter_next) {
+    return ((glyph_cache_t *)font->user_data)->get_dsc(dsc, letter, letter_next);
+}
+
+const void *glyph_cache_t::get_bitmap_cb(lv_font_glyph_dsc_t *dsc, lv_draw_buf_t *draw_buf) {
+    return ((glyph_cache_t *)dsc->resolved_font->user_data)->get_bitmap(dsc, draw_buf);
+}
+
+void glyph_cache_t::release_glyph_cb(const lv_font_t *font, lv_font_glyph_dsc_t *dsc) {
+    glyph_cache_t *self = (glyph_cache_t *)font->user_data;
+    dsc->resolved_font = self->base;
+    self->base->release_glyph(self->base, dsc);
+    dsc->resolved_font = font;
+}
+
+bool glyph_cache_t::get_dsc(lv_font_glyph_dsc_t *dsc, uint32_t letter, uint32_t letter_next) {
+    uint16_t index = lookup(letter);
+    last_slot = index;
+
+    if (index != NONE && !(kerning && letter_next)) {
+        const slot_t *s = slot(index);
+        dsc->adv_w = s->adv_w;
+        dsc->box_w = s->box_w;
+        dsc->box_h = s->box_h;
+        dsc->ofs_x = s->ofs_x;
+        dsc->ofs_y = s->ofs_y;
+        dsc->format = (lv_font_glyph_format_t)s->format;
+        dsc->is_placeholder = 0;
+        dsc->gid.index = s->gid;
+        return true;
+    }
+
+    if (index == NONE) misses++;
+    if (!base->get_glyph_dsc(base, dsc, letter, kerning ? letter_next : 0)) return false;
+    if (index != NONE || dsc->is_placeholder) return true;
+
+    /* Bitmap glyphs small enough for a slot; images and vector glyphs pass through */
+    uint32_t glyph_bytes = (uint32_t)(dsc->box_w + 7) / 8 * dsc->box_h;
+    if (dsc->format < LV_FONT_GLYPH_FORMAT_A1 || dsc->format > LV_FONT_GLYPH_FORMAT_A8 ||
+        glyph_bytes > bitmap_bytes || dsc->box_w > 255 || dsc->box_h > 255 ||
+        dsc->ofs_x < -128 || dsc->ofs_x > 127 || dsc->ofs_y < -128 || dsc->ofs_y > 127) {
+        uncached++;
+        return true;
+    }
+
+    index = insert(letter);
+    slot_t *s = slot(index);
+    s->gid = dsc->gid.index;
+    s->adv_w = dsc->adv_w;
+    s->box_w = (uint8_t)dsc->box_w;
+    s->box_h = (uint8_t)dsc->box_h;
+    s->ofs_x = (int8_t)dsc->ofs_x;
+    s->ofs_y = (int8_t)dsc->ofs_y;
+    s->format = (uint8_t)dsc->format;
+    s->has_bitmap = 0;
+    last_slot = index;
+    return true;
+}
+
+/*
+ * LVGL asks for the bitmap right after the descriptor of the same glyph,
+ * so the slot is the one get_dsc() last found; the glyph id confirms it.
+ * The output is A8 in draw_buf, rows lv_draw_buf_width_to_stride() apart,
+ * as the built-in fonts write it.
+ */
+const void *glyph_cache_t::get_bitmap(lv_font_glyph_dsc_t *dsc, lv_draw_buf_t *draw_buf) {
+    slot_t *s = NULL;
+    if (last_slot != NONE) {
+        s = slot(last_slot);
+        if (s->gid != dsc->gid.index || s->box_w != dsc->box_w || s->box_h != dsc->box_h) s = NULL;
+    }
+
+    uint32_t w = dsc->box_w;
+    uint32_t h = dsc->box_h;
+    if (w == 0 || h == 0) return NULL;
+    uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_A8);
+    uint32_t row_bytes = (w + 7) / 8;
+
+    if (s && s->has_bitmap && draw_buf) {
+        bitmap_hits++;
+        const uint8_t *in = bitmap(last_slot);
+        uint8_t *out = draw_buf->data;
+        for (uint32_t y = 0; y < h; y++) {
+            for (uint32_t x = 0; x < w; x++) {
+                out[x] = (in[x >> 3] & (0x80 >> (x & 7))) ? 0xFF : 0x00;
+            }
+            in += row_bytes;
+            out += stride;
+        }
+        return draw_buf;
+    }
+
+    bitmap_misses++;
+    dsc->resolved_font = base;
+    const void *result = base->get_glyph_bitmap(dsc, draw_buf);
+    dsc->resolved_font = &wrapper;
+    if (!result || !draw_buf || (result != draw_buf && result != draw_buf->data)) return result;
+
+    /* Threshold in place, so a cached and a decoded glyph look the same */
+    uint8_t *row = draw_buf->data;
+    uint8_t *bits = s ? bitmap(last_slot) : NULL;
+    if (bits) memset(bits, 0, row_bytes * h);
+    for (uint32_t y = 0; y < h; y++) {
+        for (uint32_t x = 0; x < w; x++) {
+            bool ink = row[x] >= INK_THRESHOLD;
+            row[x] = ink ? 0xFF : 0x00;
+            if (ink && bits) bits[y * row_bytes + (x >> 3)] |= 0x80 >> (x & 7);
+        }
+        row += stride;
+    }
+    if (s) s->has_bitmap = 1;
+    return result;
+}
+
+/* ---------- Slots ---------- */
+
+uint16_t glyph_cache_t::lookup(uint32_t letter) {
+    uint16_t index = buckets[bucket_of(letter)];
+    while (index != NONE && slot(index)->letter != letter) index = slot(index)->hash_next;
+    if (index == NONE) return NONE;
+
+    if (index < sram.count) {
+        sram_hits++;
+        lru_unlink(sram, index);
+        lru_push(sram, index);
+        return index;
+    }
+    psram_hits++;
+    return promote(index);
+}
+
+/* Swaps a PSRAM glyph with the least recently used SRAM one */
+uint16_t glyph_cache_t::promote(uint16_t index) {
+    uint16_t victim = sram.tail;
+    slot_t *hot = slot(index);
+    slot_t *cold = slot(victim);
+
+    hash_unlink(index);
+    hash_unlink(victim);
+    lru_unlink(psram, index);
+    lru_unlink(sram, victim);
+
+    slot_t tmp;
+    memcpy(&tmp, cold, sizeof(slot_t));
+    memcpy(cold, hot, sizeof(slot_t));
+    memcpy(hot, &tmp, sizeof(slot_t));
+    uint8_t *hot_bits = bitmap(index);
+    uint8_t *cold_bits = bitmap(victim);
+    for (uint16_t i = 0; i < bitmap_bytes; i++) {
+        uint8_t b = cold_bits[i];
+        cold_bits[i] = hot_bits[i];
+        hot_bits[i] = b;
+    }
+
+    hash_link(victim);
+    hash_link(index);
+    lru_push(sram, victim);
+    lru_push(psram, index);
+    return victim;
+}
+
+/* A slot for a new glyph; once SRAM is full its oldest glyph moves to PSRAM */
+uint16_t glyph_cache_t::insert(uint32_t letter) {
+    uint16_t index;
+    if (sram.used < sram.count) {
+        index = sram.first + sram.used++;
+    } else {
+        index = sram.tail;
+        hash_unlink(index);
+        lru_unlink(sram, index);
+        if (psram.count > 0) {
+            uint16_t spill = take_slot(psram);
+            memcpy(slot(spill), slot(index), sizeof(slot_t));
+            memcpy(bitmap(spill), bitmap(index), bitmap_bytes);
+            hash_link(spill);
+            lru_push(psram, spill);
+        } else {
+            evictions++;
+        }
+    }
+
+    slot(index)->letter = letter;
+    hash_link(index);
+    lru_push(sram, index);
+    return index;
+}
+
+uint16_t glyph_cache_t::take_slot(tier_t &tier) {
+    if (tier.used < tier.count) return tier.first + tier.used++;
+    uint16_t index = tier.tail;
+    hash_unlink(index);
+    lru_unlink(tier, index);
+    evictions++;
+    return index;
+}
+
+void glyph_cache_t::hash_link(uint16_t index) {
+    uint16_t &head = buckets[bucket_of(slot(index)->letter)];
+    slot(index)->hash_next = head;
+    head = index;
+}
+
+void glyph_cache_t::hash_unlink(uint16_t index) {
+    uint16_t *link = &buckets[bucket_of(slot(index)->letter)];
+    while (*link != NONE && *link != index) link = &slot(*link)->hash_next;
+    if (*link == index) *link = slot(index)->hash_next;
+}
+
+void glyph_cache_t::lru_unlink(tier_t &tier, uint16_t index) {
+    slot_t *s = slot(index);
+    if (s->prev != NONE) slot(s->prev)->next = s->next;
+    else tier.head = s->next;
+    if (s->next != NONE) slot(s->next)->prev = s->prev;
+    else tier.tail = s->prev;
+}
+
+void glyph_cache_t::lru_push(tier_t &tier, uint16_t index) {
+    slot_t *s = slot(index);
+    s->prev = NONE;
+    s->next = tier.head;
+    if (tier.head != NONE) slot(tier.head)->prev = index;
+    tier.head = index;
+    if (tier.tail == NONE) tier.tail = index;
+}
+
+/* ---------- Statistics ---------- */
+
+void glyph_cache_t::get_stats(glyph_cache_stats_t *out) const {
+    memset(out, 0, sizeof(*out));
+    out->sram_slots = sram.count;
+    out->psram_slots = psram.count;
+    out->sram_used = sram.used;
+    out->psram_used = psram.used;
+    out->sram_hits = sram_hits;
+    out->psram_hits = psram_hits;
+    out->misses = misses;
+    out->bitmap_hits = bitmap_hits;
+    out->bitmap_misses = bitmap_misses;
+    out->evictions = evictions;
+    out->uncached = uncached;
+}
+
+void glyph_cache_t::dump(void (*print_line)(const char *line)) const {
+    char line[96];
+    glyph_cache_stats_t s;
+    get_stats(&s);
+
+    if (!ready) {
+        print_line("Glyph cache: off");
+        return;
+    }
+    uint32_t lookups = s.sram_hits + s.psram_hits + s.misses;
+    snprintf(line, sizeof(line), "Glyphs: %u / %u in SRAM, %u / %u in PSRAM",
+             (unsigned)s.sram_used, (unsigned)s.sram_slots, (unsigned)s.psram_used, (unsigned)s.psram_slots);
+    print_line(line);
+    snprintf(line, sizeof(line), "Lookups: %lu, %lu SRAM hits, %lu PSRAM hits, %lu misses (%u%% hit)",
+             (unsigned long)lookups, (unsigned long)s.sram_hits, (unsigned long)s.psram_hits,
+             (unsigned long)s.misses, lookups ? (unsigned)((lookups - s.misses) * 100 / lookups) : 0);
+    print_line(line);
+    snprintf(line, sizeof(line), "Bitmaps: %lu from cache, %lu decoded, %lu evicted, %lu uncached",
+             (unsigned long)s.bitmap_hits, (unsigned long)s.bitmap_misses, (unsigned long)s.evictions,
+             (unsigned long)s.uncached);
+    print_line(line);
+}
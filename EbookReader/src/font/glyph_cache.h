@@ -0,0 +1,152 @@
+#ifndef GLYPH_CACHE_H
+#define GLYPH_CACHE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "lvgl.h"
+
+/* Glyphs kept in internal SRAM, the most recently used */
+#ifndef GLYPH_CACHE_SRAM_SLOTS
+#define GLYPH_CACHE_SRAM_SLOTS 256
+#endif
+
+/* Glyphs spilled to PSRAM when they drop out of the SRAM tier */
+#ifndef GLYPH_CACHE_PSRAM_SLOTS
+#define GLYPH_CACHE_PSRAM_SLOTS 4096
+#endif
+
+/*
+ * Upper bound on a slot's 1 bpp bitmap. begin() sizes the slots from the
+ * base font, (line_height + 7) / 8 * line_height bytes, and stops there:
+ * 128 bytes is a 32 px font.
+ */
+#ifndef GLYPH_CACHE_BITMAP_BYTES
+#define GLYPH_CACHE_BITMAP_BYTES 128
+#endif
+
+typedef struct {
+    uint16_t sram_slots;
+    uint16_t psram_slots;
+    uint16_t sram_used;
+    uint16_t psram_used;
+    uint32_t sram_hits;
+    uint32_t psram_hits;     /* Promoted back to SRAM */
+    uint32_t misses;         /* Looked up in the font */
+    uint32_t bitmap_hits;    /* Bitmaps served from the cache */
+    uint32_t bitmap_misses;  /* Bitmaps decoded by the font */
+    uint32_t evictions;      /* Dropped from the PSRAM tier */
+    uint32_t uncached;       /* Too large, or not a bitmap glyph */
+} glyph_cache_stats_t;
+
+/*
+ * Cache of rasterised glyphs in front of an LVGL font.
+ *
+ * font() is an lv_font_t that wraps the base font. Its glyph descriptors
+ * come from the cache by codepoint, so a hit skips the font's cmap search;
+ * its bitmaps are stored thresholded to 1 bpp, the way the e-paper shows
+ * them, and expanded straight into LVGL's A8 glyph buffer. A miss asks the
+ * base font, thresholds the result and keeps it. Each slot has room for a
+ * glyph as tall as the font's line and as wide rounded up to bytes; larger
+ * glyphs are drawn by the base font every time.
+ *
+ * Recently used glyphs sit in internal SRAM. A glyph pushed out of SRAM
+ * moves to the PSRAM tier and comes back to SRAM on its next use; only the
+ * least recently used PSRAM glyph is ever dropped.
+ *
+ * Only the LVGL task may use it, like the font itself.
+ */
+class glyph_cache_t {
+public:
+    glyph_cache_t();
+
+    bool begin(const lv_font_t *base, uint16_t sram_slots, uint16_t psram_slots);
+    void end();
+
+    /* Off: begin() keeps no glyphs and font() is the base font, in every instance */
+    static void set_enabled(bool on) { enabled = on; }
+
+    /* The wrapped font; the base font until begin() succeeds */
+    const lv_font_t *font() const { return ready ? &wrapper : base; }
+
+    void clear();
+    void get_stats(glyph_cache_stats_t *out) const;
+    void dump(void (*print_line)(const char *line)) const;
+
+private:
+    static const uint16_t NONE = 0xFFFF;
+    static const int BUCKET_COUNT = 1024;
+    static bool enabled;
+
+    struct slot_t {
+        uint32_t letter;
+        uint32_t gid;            /* Base font's glyph id */
+        uint16_t adv_w;
+        uint8_t box_w;
+        uint8_t box_h;
+        int8_t ofs_x;
+        int8_t ofs_y;
+        uint8_t format;          /* lv_font_glyph_format_t of the base font */
+        uint8_t has_bitmap;
+        uint16_t prev;           /* LRU list of the slot's tier */
+        uint16_t next;
+        uint16_t hash_next;
+    };
+
+    struct tier_t {
+        slot_t *slots;
+        uint8_t *bitmaps;        /* bitmap_bytes per slot, rows padded to bytes */
+        uint16_t first;          /* Index of slots[0] */
+        uint16_t count;
+        uint16_t used;
+        uint16_t head;           /* Most recently used */
+        uint16_t tail;
+    };
+
+    const lv_font_t *base;
+    lv_font_t wrapper;
+    bool ready;
+    bool kerning;                /* Base font has kerning pairs */
+    uint16_t bitmap_bytes;       /* Bitmap room of each slot */
+
+    tier_t sram;
+    tier_t psram;
+    uint16_t *buckets;
+    uint16_t last_slot;          /* Slot of the last descriptor, for the bitmap call */
+
+    uint32_t sram_hits;
+    uint32_t psram_hits;
+    uint32_t misses;
+    uint32_t bitmap_hits;
+    uint32_t bitmap_misses;
+    uint32_t evictions;
+    uint32_t uncached;
+
+    static bool get_dsc_cb(const lv_font_t *font, lv_font_glyph_dsc_t *dsc, uint32_t letter, uint32_t letter_next);
+    static const void *get_bitmap_cb(lv_font_glyph_dsc_t *dsc, lv_draw_buf_t *draw_buf);
+    static void release_glyph_cb(const lv_font_t *font, lv_font_glyph_dsc_t *dsc);
+
+    bool get_dsc(lv_font_glyph_dsc_t *dsc, uint32_t letter, uint32_t letter_next);
+    const void *get_bitmap(lv_font_glyph_dsc_t *dsc, lv_draw_buf_t *draw_buf);
+
+    slot_t *slot(uint16_t index) {
+        return index < sram.count ? &sram.slots[index] : &psram.slots[index - psram.first];
+    }
+    uint8_t *bitmap(uint16_t index) {
+        return index < sram.count ? &sram.bitmaps[(uint32_t)index * bitmap_bytes]
+                                  : &psram.bitmaps[(uint32_t)(index - psram.first) * bitmap_bytes];
+    }
+    tier_t &tier_of(uint16_t index) { return index < sram.count ? sram : psram; }
+
+    uint16_t lookup(uint32_t letter);
+    uint16_t insert(uint32_t letter);
+    uint16_t take_slot(tier_t &tier);
+    uint16_t promote(uint16_t index);
+    void hash_link(uint16_t index);
+    void hash_unlink(uint16_t index);
+    void lru_unlink(tier_t &tier, uint16_t index);
+    void lru_push(tier_t &tier, uint16_t index);
+};
+
+extern glyph_cache_t glyph_cache;
+
+#endif
@@ -0,0 +1,421 @@
+#include <stdio.h>
+#include <string.h>
+#include "sd_font.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+
+static const char *TAG = "sdfont";
+
+/* Fibonacci hashing: the top bits pick one of the 256 block buckets */
+static inline uint32_t block_bucket(uint32_t number) {
+    return (number * 2654435761u) >> 24;
+}
+
+sd_font_t sd_font;
+
+sd_font_t::sd_font_t() :
+    opened(false),
+    ranges(NULL),
+    bitmap_buf(NULL),
+    page_of(NULL),
+    pages(NULL),
+    page_count(0),
+    use_pages(false),
+    blocks(NULL),
+    block_tags(NULL),
+    block_used(NULL),
+    block_hash(NULL),
+    block_chain(NULL),
+    block_count(0),
+    last_block(0),
+    stamp(0),
+    last_gid(NO_GLYPH),
+    lookups(0),
+    missing(0),
+    block_hits(0),
+    block_reads(0) {
+    file_path[0] = '\0';
+    memset(&header, 0, sizeof(header));
+    memset(&lv_font, 0, sizeof(lv_font));
+    memset(&last_glyph, 0, sizeof(last_glyph));
+}
+
+bool sd_font_t::open(const char *path, uint16_t cache_blocks, const lv_font_t *fallback) {
+    if (opened) close();
+    if (cache_blocks == 0 || cache_blocks == NO_SLOT) return false;
+
+    file = SD.open(path, FILE_READ);
+    if (!file) {
+        ESP_LOGW(TAG, "Cannot open %s", path);
+        return false;
+    }
+    snprintf(file_path, sizeof(file_path), "%s", path);
+
+    uint32_t file_size = file.size();
+    if (file.read((uint8_t *)&header, sizeof(header)) != sizeof(header) ||
+        memcmp(header.magic, SD_FONT_MAGIC, 4) != 0 || header.version != SD_FONT_VERSION ||
+        header.header_size < sizeof(header) ||
+        (header.bpp != 1 && header.bpp != 2 && header.bpp != 4 && header.bpp != 8) ||
+        header.range_count == 0 || header.glyph_count == 0 ||
+        header.range_offset + header.range_count * sizeof(sd_font_range_t) > file_size ||
+        header.glyph_offset + header.glyph_count * sizeof(sd_font_glyph_t) > file_size ||
+        header.bitmap_offset > file_size) {
+        ESP_LOGE(TAG, "%s is not a font file", path);
+        close();
+        return false;
+    }
+    header.name[sizeof(header.name) - 1] = '\0';
+
+    /* The ranges are the only part of the file kept in memory */
+    uint32_t range_bytes = header.range_count * sizeof(sd_font_range_t);
+    ranges = (sd_font_range_t *)heap_caps_malloc(range_bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    blocks = (uint8_t *)heap_caps_malloc((uint32_t)cache_blocks * SD_FONT_BLOCK_SIZE, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    block_tags = (uint32_t *)heap_caps_malloc(cache_blocks * sizeof(uint32_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    block_used = (uint32_t *)heap_caps_malloc(cache_blocks * sizeof(uint32_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    block_hash = (uint16_t *)heap_caps_malloc(BLOCK_BUCKETS * sizeof(uint16_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    block_chain = (uint16_t *)heap_caps_malloc(cache_blocks * sizeof(uint16_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    bitmap_buf = (uint8_t *)heap_caps_malloc(header.max_bitmap_bytes + 1, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!ranges || !blocks || !block_tags || !block_used || !block_hash || !block_chain || !bitmap_buf) {
+        ESP_LOGE(TAG, "No memory for %lu ranges and %u blocks", (unsigned long)header.range_count,
+                 (unsigned)cache_blocks);
+        close();
+        return false;
+    }
+
+    file.seek(header.range_offset);
+    if (file.read((uint8_t *)ranges, range_bytes) != range_bytes) {
+        ESP_LOGE(TAG, "Short read in %s", path);
+        close();
+        return false;
+    }
+    for (uint32_t i = 0; i < header.range_count; i++) {
+        const sd_font_range_t &r = ranges[i];
+        if (r.count == 0 || r.first_glyph + r.count > header.glyph_count ||
+            (i > 0 && r.first < ranges[i - 1].first + ranges[i - 1].count)) {
+            ESP_LOGE(TAG, "Bad range %lu in %s", (unsigned long)i, path);
+            close();
+            return false;
+        }
+    }
+    use_pages = build_page_table();
+
+    block_count = cache_blocks;
+    for (uint16_t i = 0; i < block_count; i++) {
+        block_tags[i] = NO_BLOCK;
+        block_used[i] = 0;
+        block_chain[i] = NO_SLOT;
+    }
+    for (int i = 0; i < BLOCK_BUCKETS; i++) block_hash[i] = NO_SLOT;
+    last_block = 0;
+    stamp = 0;
+    last_gid = NO_GLYPH;
+
+    lv_font.get_glyph_dsc = get_dsc_cb;
+    lv_font.get_glyph_bitmap = get_bitmap_cb;
+    lv_font.release_glyph = NULL;
+    lv_font.line_height = header.line_height;
+    lv_font.base_line = header.base_line;
+    lv_font.subpx = 0;
+    lv_font.kerning = LV_FONT_KERNING_NONE;
+    lv_font.underline_position = header.underline_position;
+    lv_font.underline_thickness = (int8_t)header.underline_thickness;
+    lv_font.dsc = NULL;
+    lv_font.fallback = fallback;
+    lv_font.user_data = this;
+
+    opened = true;
+    ESP_LOGI(TAG, "%s: %s %upx, %lu glyphs in %lu ranges, %u pages", path, header.name,
+             (unsigned)header.px_size, (unsigned long)header.glyph_count, (unsigned long)header.range_count,
+             (unsigned)page_count);
+    return true;
+}
+
+void sd_font_t::close() {
+    if (file) file.close();
+    heap_caps_free(ranges);
+    heap_caps_free(blocks);
+    heap_caps_free(block_tags);
+    heap_caps_free(block_used);
+    heap_caps_free(block_hash);
+    heap_caps_free(block_chain);
+    heap_caps_free(bitmap_buf);
+    heap_caps_free(page_of);
+    heap_caps_free(pages);
+    ranges = NULL;
+    blocks = NULL;
+    block_tags = NULL;
+    block_used = NULL;
+    block_hash = NULL;
+    block_chain = NULL;
+    bitmap_buf = NULL;
+    page_of = NULL;
+    pages = NULL;
+    page_count = 0;
+    use_pages = false;
+    block_count = 0;
+    opened = false;
+}
+
+/* ---------- LVGL font interface ---------- */
+
+bool sd_font_t::get_dsc_cb(const lv_font_t *font, lv_font_glyph_dsc_t *dsc, uint32_t letter,
+                           uint32_t letter_next) {
+    (void)letter_next;
+    return ((sd_font_t *)font->user_data)->get_dsc(dsc, letter);
+}
+
+const void *sd_font_t::get_bitmap_cb(lv_font_glyph_dsc_t *dsc, lv_draw_buf_t *draw_buf) {
+    return ((sd_font_t *)dsc->resolved_font->user_data)->get_bitmap(dsc, draw_buf);
+}
+
+bool sd_font_t::get_dsc(lv_font_glyph_dsc_t *dsc, uint32_t letter) {
+    lookups++;
+    uint32_t gid = find_glyph(letter);
+    sd_font_glyph_t g;
+    if (gid == NO_GLYPH) {
+        missing++;
+        return false;
+    }
+    if (!read_glyph(gid, &g)) return false;
+
+    dsc->adv_w = g.adv_w;
+    dsc->box_w = g.box_w;
+    dsc->box_h = g.box_h;
+    dsc->ofs_x = g.ofs_x;
+    dsc->ofs_y = g.ofs_y;
+    dsc->format = (lv_font_glyph_format_t)header.bpp;   /* A1/A2/A4/A8 are the bit depths */
+    dsc->is_placeholder = 0;
+    dsc->gid.index = gid;
+
+    last_gid = gid;
+    last_glyph = g;
+    return true;
+}
+
+/* Expands the packed bitmap to A8 in draw_buf, as the built-in fonts do */
+const void *sd_font_t::get_bitmap(lv_font_glyph_dsc_t *dsc, lv_draw_buf_t *draw_buf) {
+    uint32_t w = dsc->box_w;
+    uint32_t h = dsc->box_h;
+    if (w == 0 || h == 0 || !draw_buf) return NULL;
+
+    sd_font_glyph_t g;
+    if (dsc->gid.index == last_gid) {
+        g = last_glyph;
+    } else if (!read_glyph(dsc->gid.index, &g)) {
+        return NULL;
+    }
+    if (g.box_w != w || g.box_h != h) return NULL;
+
+    uint32_t bpp = header.bpp;
+    uint32_t bytes = (w * h * bpp + 7) / 8;
+    if (bytes > header.max_bitmap_bytes || !read(header.bitmap_offset + g.bitmap, bitmap_buf, bytes)) {
+        return NULL;
+    }
+
+    uint32_t mask = (1u << bpp) - 1;
+    uint32_t scale = 255 / mask;             /* 1 bpp -> 255, 2 -> 85, 4 -> 17, 8 -> 1 */
+    uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_A8);
+    uint32_t bit = 0;
+    uint8_t *out = draw_buf->data;
+    for (uint32_t y = 0; y < h; y++) {
+        for (uint32_t x = 0; x < w; x++) {
+            uint32_t v = (bitmap_buf[bit >> 3] >> (8 - bpp - (bit & 7))) & mask;
+            out[x] = (uint8_t)(v * scale);
+            bit += bpp;
+        }
+        out += stride;
+    }
+    return draw_buf;
+}
+
+/* ---------- Codepoint lookup ---------- */
+
+/*
+ * Direct table for U+0000..U+FFFF. Only pages with at least one glyph are
+ * allocated: a full CJK font needs about 90 pages of 512 bytes, a font
+ * made from one book's characters fewer still.
+ */
+bool sd_font_t::build_page_table() {
+    if (header.glyph_count >= NO_ID) {
+        ESP_LOGW(TAG, "%lu glyphs, too many for the page table", (unsigned long)header.glyph_count);
+        return false;
+    }
+
+    page_of = (uint16_t *)heap_caps_malloc(256 * sizeof(uint16_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!page_of) return false;
+    for (int i = 0; i < 256; i++) page_of[i] = NO_PAGE;
+
+    page_count = 0;
+    for (uint32_t i = 0; i < header.range_count; i++) {
+        uint32_t first = ranges[i].first;
+        uint32_t last = first + ranges[i].count - 1;
+        if (first > 0xFFFF) break;
+        if (last > 0xFFFF) last = 0xFFFF;
+        for (uint32_t page = first >> 8; page <= last >> 8; page++) {
+            if (page_of[page] == NO_PAGE) page_of[page] = page_count++;
+        }
+    }
+
+    pages = (uint16_t *)heap_caps_malloc((uint32_t)page_count * 256 * sizeof(uint16_t),
+                                         MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!pages) {
+        ESP_LOGW(TAG, "No memory for %u pages, searching ranges", (unsigned)page_count);
+        heap_caps_free(page_of);
+        page_of = NULL;
+        page_count = 0;
+        return false;
+    }
+    memset(pages, 0xFF, (uint32_t)page_count * 256 * sizeof(uint16_t));
+
+    for (uint32_t i = 0; i < header.range_count; i++) {
+        const sd_font_range_t &r = ranges[i];
+        for (uint32_t k = 0; k < r.count && r.first + k <= 0xFFFF; k++) {
+            uint32_t cp = r.first + k;
+            pages[(uint32_t)page_of[cp >> 8] * 256 + (cp & 0xFF)] = (uint16_t)(r.first_glyph + k);
+        }
+    }
+    return true;
+}
+
+uint32_t sd_font_t::find_glyph(uint32_t letter) const {
+    if (use_pages && letter <= 0xFFFF) {
+        uint16_t page = page_of[letter >> 8];
+        if (page == NO_PAGE) return NO_GLYPH;
+        uint16_t id = pages[(uint32_t)page * 256 + (letter & 0xFF)];
+        return id == NO_ID ? NO_GLYPH : id;
+    }
+    return search_ranges(letter);
+}
+
+uint32_t sd_font_t::search_ranges(uint32_t letter) const {
+    uint32_t lo = 0;
+    uint32_t hi = header.range_count;
+    while (lo < hi) {
+        uint32_t mid = (lo + hi) / 2;
+        const sd_font_range_t &r = ranges[mid];
+        if (letter < r.first) {
+            hi = mid;
+        } else if (letter >= r.first + r.count) {
+            lo = mid + 1;
+        } else {
+            return r.first_glyph + (letter - r.first);
+        }
+    }
+    return NO_GLYPH;
+}
+
+/* ---------- File access ---------- */
+
+bool sd_font_t::read_glyph(uint32_t gid, sd_font_glyph_t *out) {
+    if (gid >= header.glyph_count) return false;
+    return read(header.glyph_offset + gid * sizeof(sd_font_glyph_t), out, sizeof(*out));
+}
+
+bool sd_font_t::read(uint32_t offset, void *buf, uint32_t len) {
+    uint8_t *dst = (uint8_t *)buf;
+    while (len > 0) {
+        const uint8_t *b = block(offset / SD_FONT_BLOCK_SIZE);
+        if (!b) return false;
+        uint32_t in_block = offset % SD_FONT_BLOCK_SIZE;
+        uint32_t n = SD_FONT_BLOCK_SIZE - in_block;
+        if (n > len) n = len;
+        memcpy(dst, b + in_block, n);
+        dst += n;
+        offset += n;
+        len -= n;
+    }
+    return true;
+}
+
+/* A glyph's record and bitmap are usually in the block used last */
+const uint8_t *sd_font_t::block(uint32_t number) {
+    stamp++;
+    if (block_tags[last_block] == number) {
+        block_hits++;
+        block_used[last_block] = stamp;
+        return blocks + (uint32_t)last_block * SD_FONT_BLOCK_SIZE;
+    }
+
+    uint32_t bucket = block_bucket(number);
+    for (uint16_t i = block_hash[bucket]; i != NO_SLOT; i = block_chain[i]) {
+        if (block_tags[i] == number) {
+            block_hits++;
+            block_used[i] = stamp;
+            last_block = i;
+            return blocks + (uint32_t)i * SD_FONT_BLOCK_SIZE;
+        }
+    }
+
+    /* A miss reads the card anyway, so the oldest slot is simply searched for */
+    uint16_t victim = 0;
+    for (uint16_t i = 1; i < block_count; i++) {
+        if (block_used[i] < block_used[victim]) victim = i;
+    }
+    if (block_tags[victim] != NO_BLOCK) unlink_block(victim);
+
+    uint8_t *data = blocks + (uint32_t)victim * SD_FONT_BLOCK_SIZE;
+    if (!file.seek(number * SD_FONT_BLOCK_SIZE)) return NULL;
+    size_t got = file.read(data, SD_FONT_BLOCK_SIZE);
+    if (got == 0) {
+        ESP_LOGE(TAG, "Read failed at block %lu", (unsigned long)number);
+        return NULL;
+    }
+    if (got < SD_FONT_BLOCK_SIZE) memset(data + got, 0, SD_FONT_BLOCK_SIZE - got);
+    block_reads++;
+    block_tags[victim] = number;
+    block_used[victim] = stamp;
+    block_chain[victim] = block_hash[bucket];
+    block_hash[bucket] = victim;
+    last_block = victim;
+    return data;
+}
+
+void sd_font_t::unlink_block(uint16_t slot) {
+    uint16_t *link = &block_hash[block_bucket(block_tags[slot])];
+    while (*link != slot) link = &block_chain[*link];
+    *link = block_chain[slot];
+    block_tags[slot] = NO_BLOCK;
+}
+
+/* ---------- Reports ---------- */
+
+void sd_font_t::get_stats(sd_font_stats_t *out) const {
+    memset(out, 0, sizeof(*out));
+    out->glyph_count = header.glyph_count;
+    out->range_count = header.range_count;
+    out->lookups = lookups;
+    out->missing = missing;
+    out->block_hits = block_hits;
+    out->block_reads = block_reads;
+    out->cache_blocks = block_count;
+    out->pages = use_pages ? page_count : 0;
+    out->table_bytes = page_of ? 256 * sizeof(uint16_t) + (uint32_t)page_count * 256 * sizeof(uint16_t) : 0;
+    for (uint16_t i = 0; i < block_count; i++) {
+        if (block_tags[i] != NO_BLOCK) out->cache_used++;
+    }
+}
+
+void sd_font_t::dump(void (*print_line)(const char *line)) const {
+    char line[96];
+    sd_font_stats_t s;
+
+    if (!opened) {
+        print_line("SD font: none");
+        return;
+    }
+    get_stats(&s);
+    snprintf(line, sizeof(line), "SD font: %s %upx, %lu glyphs in %lu ranges", header.name,
+             (unsigned)header.px_size, (unsigned long)s.glyph_count, (unsigned long)s.range_count);
+    print_line(line);
+    if (s.pages) {
+        snprintf(line, sizeof(line), "Font page table: %u pages, %lu bytes", (unsigned)s.pages,
+                 (unsigned long)s.table_bytes);
+    } else {
+        snprintf(line, sizeof(line), "Font page table: off, ranges searched");
+    }
+    print_line(line);
+    snprintf(line, sizeof(line), "Font lookups: %lu, %lu missing; blocks %u / %u, %lu hits, %lu read",
+             (unsigned long)s.lookups, (unsigned long)s.missing, (unsigned)s.cache_used,
+             (unsigned)s.cache_blocks, (unsigned long)s.block_hits, (unsigned long)s.block_reads);
+    print_line(line);
+}
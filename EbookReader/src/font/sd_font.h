@@ -0,0 +1,180 @@
+#ifndef SD_FONT_H
+#define SD_FONT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <SD.h>
+#include "lvgl.h"
+
+/* Bytes read from the card at a time, and the unit of the block cache */
+#ifndef SD_FONT_BLOCK_SIZE
+#define SD_FONT_BLOCK_SIZE 512
+#endif
+
+/* Blocks of glyph records and bitmaps kept in PSRAM */
+#ifndef SD_FONT_CACHE_BLOCKS
+#define SD_FONT_CACHE_BLOCKS 64
+#endif
+
+/*
+ * Font file (.ebf), little-endian, written by tools/ebf_convert.py:
+ *
+ *   header    sd_font_header_t, 64 bytes
+ *   ranges    range_count x sd_font_range_t, sorted by codepoint
+ *   glyphs    glyph_count x sd_font_glyph_t, in range order
+ *   bitmaps   box_w * box_h pixels per glyph at `bpp` bits, rows not
+ *             padded, most significant bit first
+ */
+#define SD_FONT_MAGIC   "EBF1"
+#define SD_FONT_VERSION 1
+
+typedef struct {
+    char magic[4];
+    uint16_t version;
+    uint16_t header_size;
+    uint16_t px_size;
+    uint16_t line_height;
+    int16_t base_line;
+    uint8_t bpp;                 /* 1, 2, 4 or 8 */
+    uint8_t flags;               /* Reserved, 0 */
+    int8_t underline_position;
+    uint8_t underline_thickness;
+    uint16_t max_bitmap_bytes;   /* Largest packed bitmap */
+    uint32_t glyph_count;
+    uint32_t range_count;
+    uint32_t range_offset;
+    uint32_t glyph_offset;
+    uint32_t bitmap_offset;
+    char name[24];               /* Family and style, NUL-terminated */
+} sd_font_header_t;
+
+/* Consecutive codepoints with consecutive glyph ids */
+typedef struct {
+    uint32_t first;
+    uint16_t count;
+    uint16_t reserved;
+    uint32_t first_glyph;
+} sd_font_range_t;
+
+typedef struct {
+    uint32_t bitmap;             /* Offset from header.bitmap_offset */
+    uint16_t adv_w;              /* Pixels */
+    uint8_t box_w;
+    uint8_t box_h;
+    int8_t ofs_x;
+    int8_t ofs_y;
+    uint16_t reserved;
+} sd_font_glyph_t;
+
+typedef struct {
+    uint32_t glyph_count;
+    uint32_t range_count;
+    uint32_t lookups;
+    uint32_t missing;            /* Codepoints the font does not have */
+    uint32_t block_hits;
+    uint32_t block_reads;        /* Blocks read from the card */
+    uint16_t cache_blocks;
+    uint16_t cache_used;
+    uint16_t pages;              /* Page table pages, 0 = ranges searched */
+    uint32_t table_bytes;
+} sd_font_stats_t;
+
+/*
+ * LVGL font read from a file on the SD card.
+ *
+ * open() reads the header and the codepoint ranges, nothing else, so it
+ * costs the same for a font with a hundred glyphs as for one with twenty
+ * thousand. A glyph's record and bitmap are read when LVGL first asks for
+ * them, through a cache of SD_FONT_BLOCK_SIZE blocks in PSRAM; put the
+ * glyph cache in front of font() so most glyphs never get this far.
+ *
+ * Codepoints in the Basic Multilingual Plane are looked up in a two-level
+ * table built by open(): the high byte picks a page of 256 glyph ids, the
+ * low byte the id, so a lookup is two loads however the ranges are spread.
+ * Other codepoints, and every codepoint if the table does not fit, use a
+ * binary search over the ranges.
+ *
+ * Codepoints missing from the file go to `fallback`, if given.
+ *
+ * Only the LVGL task may use it, like any LVGL font.
+ */
+class sd_font_t {
+public:
+    sd_font_t();
+
+    bool open(const char *path, uint16_t cache_blocks, const lv_font_t *fallback);
+    void close();
+    bool is_open() const { return opened; }
+
+    const lv_font_t *font() const { return opened ? &lv_font : NULL; }
+    const char *name() const { return header.name; }
+    const char *path() const { return file_path; }
+    uint16_t px_size() const { return header.px_size; }
+
+    /* Glyph id of a codepoint, or -1; what get_glyph_dsc looks up */
+    int32_t glyph_id(uint32_t letter) const { return (int32_t)find_glyph(letter); }
+    /* Off searches the ranges for every codepoint, for comparisons */
+    void set_page_table(bool enable) { use_pages = enable && page_of != NULL; }
+
+    void get_stats(sd_font_stats_t *out) const;
+    void dump(void (*print_line)(const char *line)) const;
+
+private:
+    static const uint32_t NO_GLYPH = 0xFFFFFFFF;
+    static const uint32_t NO_BLOCK = 0xFFFFFFFF;
+    static const uint16_t NO_PAGE = 0xFFFF;
+    static const uint16_t NO_ID = 0xFFFF;         /* Missing in a page */
+    static const uint16_t NO_SLOT = 0xFFFF;
+    static const int BLOCK_BUCKETS = 256;
+
+    File file;
+    bool opened;
+    char file_path[64];
+    sd_font_header_t header;
+    lv_font_t lv_font;
+    sd_font_range_t *ranges;
+    uint8_t *bitmap_buf;         /* One packed bitmap, max_bitmap_bytes */
+
+    /* Page table: page_of[high byte] is a page of 256 ids in `pages` */
+    uint16_t *page_of;
+    uint16_t *pages;
+    uint16_t page_count;
+    bool use_pages;
+
+    /* Block cache, least recently used replaced, found by a hash of the block number */
+    uint8_t *blocks;
+    uint32_t *block_tags;        /* Block number in the file, NO_BLOCK = empty */
+    uint32_t *block_used;        /* Stamp of the last use */
+    uint16_t *block_hash;        /* BLOCK_BUCKETS chains of slots */
+    uint16_t *block_chain;
+    uint16_t block_count;
+    uint16_t last_block;
+    uint32_t stamp;
+
+    /* Record of the last descriptor, for the bitmap call that follows */
+    uint32_t last_gid;
+    sd_font_glyph_t last_glyph;
+
+    uint32_t lookups;
+    uint32_t missing;
+    uint32_t block_hits;
+    uint32_t block_reads;
+
+    static bool get_dsc_cb(const lv_font_t *font, lv_font_glyph_dsc_t *dsc, uint32_t letter, uint32_t letter_next);
+    static const void *get_bitmap_cb(lv_font_glyph_dsc_t *dsc, lv_draw_buf_t *draw_buf);
+
+    bool get_dsc(lv_font_glyph_dsc_t *dsc, uint32_t letter);
+    const void *get_bitmap(lv_font_glyph_dsc_t *dsc, lv_draw_buf_t *draw_buf);
+
+    bool build_page_table();
+    uint32_t find_glyph(uint32_t letter) const;
+    uint32_t search_ranges(uint32_t letter) const;
+    bool read_glyph(uint32_t gid, sd_font_glyph_t *out);
+    bool read(uint32_t offset, void *buf, uint32_t len);
+    const uint8_t *block(uint32_t number);
+    void unlink_block(uint16_t slot);
+};
+
+extern sd_font_t sd_font;
+
+#endif
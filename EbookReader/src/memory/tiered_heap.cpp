@@ -0,0 +1,477 @@
+#include <stdio.h>
+#include <string.h>
+#include "tiered_heap.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "lvgl.h"
+
+static const char *TAG = "heap";
+
+tiered_heap_t tiered_heap;
+
+static const uint16_t CLASS_SIZES[tiered_heap_t::CLASS_COUNT] = { 16, 32, 64, 128, 256 };
+static const uint8_t SLAB_FREE = 0xFF;
+
+/* Arena used when there is no PSRAM */
+static const size_t ARENA_INTERNAL_FALLBACK = 64 * 1024;
+
+/*
+ * Arena block layout: an 8-byte header, then the payload. The header holds
+ * the block size (header included, multiple of 8, bit 0 set while in use)
+ * and the size of the block before it, so free() can merge both neighbours
+ * in O(1). A zero-size used header terminates the arena. Free blocks keep
+ * their free-list links in the payload.
+ */
+typedef struct {
+    uint32_t size;
+    uint32_t prev_size;
+} arena_header_t;
+
+typedef struct {
+    void *next;
+    void *prev;
+} arena_links_t;
+
+static const uint32_t ARENA_USED = 1;
+static const uint32_t ARENA_SIZE_MASK = ~(uint32_t)7;
+static const size_t ARENA_HEADER = sizeof(arena_header_t);
+static const size_t ARENA_MIN_BLOCK = (ARENA_HEADER + sizeof(arena_links_t) + 7) & ~(size_t)7;
+
+static inline arena_header_t *hdr(void *block) { return (arena_header_t *)block; }
+static inline arena_links_t *links(void *block) { return (arena_links_t *)((uint8_t *)block + ARENA_HEADER); }
+static inline uint32_t block_size(void *block) { return hdr(block)->size & ARENA_SIZE_MASK; }
+static inline bool block_used(void *block) { return hdr(block)->size & ARENA_USED; }
+static inline void *next_block(void *block) { return (uint8_t *)block + block_size(block); }
+
+tiered_heap_t::tiered_heap_t() :
+    sram(NULL),
+    sram_size(0),
+    slab_owner(NULL),
+    slab_count(0),
+    slabs_assigned(0),
+    arena(NULL),
+    arena_size(0),
+    arena_in_psram(false),
+    arena_free_list(NULL),
+    arena_used(0),
+    arena_high_water(0),
+    arena_blocks(0),
+    small_used(0),
+    high_water(0),
+    allocs(0),
+    frees(0),
+    failures(0) {
+    memset(classes, 0, sizeof(classes));
+}
+
+bool tiered_heap_t::begin(size_t sram_bytes, size_t arena_bytes) {
+    if (sram) return true;
+
+    slab_count = sram_bytes / SLAB_SIZE;
+    sram_size = slab_count * SLAB_SIZE;
+    sram = (uint8_t *)heap_caps_malloc(sram_size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    slab_owner = (uint8_t *)heap_caps_malloc(slab_count, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!sram || !slab_owner) {
+        ESP_LOGE(TAG, "No internal RAM for %u bytes of small pools", (unsigned)sram_size);
+        end();
+        return false;
+    }
+    memset(slab_owner, SLAB_FREE, slab_count);
+    slabs_assigned = 0;
+    for (int i = 0; i < CLASS_COUNT; i++) {
+        classes[i].block_size = CLASS_SIZES[i];
+        classes[i].slabs = 0;
+        classes[i].free_list = NULL;
+        classes[i].in_use = 0;
+        classes[i].high_water = 0;
+    }
+
+    arena_in_psram = true;
+    arena = (uint8_t *)heap_caps_malloc(arena_bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!arena) {
+        ESP_LOGW(TAG, "No PSRAM, arena of %u bytes in internal RAM", (unsigned)ARENA_INTERNAL_FALLBACK);
+        arena_in_psram = false;
+        arena_bytes = ARENA_INTERNAL_FALLBACK;
+        arena = (uint8_t *)heap_caps_malloc(arena_bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    }
+    if (!arena) {
+        ESP_LOGE(TAG, "No memory for the arena");
+        end();
+        return false;
+    }
+
+    /* One free block spanning the arena, then the terminating header */
+    arena_size = arena_bytes & ~(size_t)7;
+    void *first = arena;
+    hdr(first)->size = (uint32_t)(arena_size - ARENA_HEADER);
+    hdr(first)->prev_size = 0;
+    void *end_mark = next_block(first);
+    hdr(end_mark)->size = ARENA_USED;
+    hdr(end_mark)->prev_size = hdr(first)->size;
+    arena_free_list = NULL;
+    arena_link(first);
+    arena_used = ARENA_HEADER;
+    arena_high_water = arena_used;
+    arena_blocks = 0;
+
+    small_used = 0;
+    high_water = 0;
+    ESP_LOGI(TAG, "%u KB SRAM pools, %u KB arena in %s", (unsigned)(sram_size / 1024),
+             (unsigned)(arena_size / 1024), arena_in_psram ? "PSRAM" : "SRAM");
+    return true;
+}
+
+void tiered_heap_t::end() {
+    heap_caps_free(sram);
+    heap_caps_free(slab_owner);
+    heap_caps_free(arena);
+    sram = NULL;
+    slab_owner = NULL;
+    arena = NULL;
+    sram_size = 0;
+    slab_count = 0;
+    arena_size = 0;
+    arena_free_list = NULL;
+}
+
+void tiered_heap_t::note_used() {
+    size_t used = small_used + arena_used;
+    if (used > high_water) high_water = used;
+    if (arena_used > arena_high_water) arena_high_water = arena_used;
+}
+
+void *tiered_heap_t::alloc(size_t size) {
+    if (size == 0) size = 1;
+
+    void *p = NULL;
+    if (size <= MAX_SMALL) {
+        int cls = 0;
+        while (classes[cls].block_size < size) cls++;
+        p = small_alloc(cls);
+    }
+    if (!p) p = arena_alloc(size);
+
+    if (p) {
+        allocs++;
+        note_used();
+    } else {
+        failures++;
+        ESP_LOGE(TAG, "Out of memory allocating %u bytes", (unsigned)size);
+    }
+    return p;
+}
+
+void *tiered_heap_t::realloc(void *p, size_t size) {
+    if (!p) return alloc(size);
+
+    /* Shrinking, or growing within the slack of the block, stays in place */
+    size_t old_size = usable_size(p);
+    if (size <= old_size) return p;
+
+    void *n = alloc(size);
+    if (!n) return NULL;
+    memcpy(n, p, old_size);
+    free(p);
+    return n;
+}
+
+void tiered_heap_t::free(void *p) {
+    if (!p) return;
+    if (in_sram(p)) {
+        small_free(p);
+    } else if (in_arena(p)) {
+        arena_free(p);
+    } else {
+        ESP_LOGE(TAG, "free() of foreign pointer %p", p);
+        return;
+    }
+    frees++;
+}
+
+size_t tiered_heap_t::usable_size(const void *p) const {
+    if (in_sram(p)) {
+        size_t slab = ((const uint8_t *)p - sram) / SLAB_SIZE;
+        return classes[slab_owner[slab]].block_size;
+    }
+    void *block = (uint8_t *)p - ARENA_HEADER;
+    return block_size(block) - ARENA_HEADER;
+}
+
+/* ---- Small tier ---- */
+
+bool tiered_heap_t::grow_class(int cls) {
+    if (slabs_assigned >= slab_count) return false;
+
+    size_class_t &c = classes[cls];
+    uint8_t *slab = sram + slabs_assigned * SLAB_SIZE;
+    slab_owner[slabs_assigned] = (uint8_t)cls;
+    slabs_assigned++;
+    c.slabs++;
+
+    /* Thread the slab's blocks so the lowest address is handed out first */
+    for (size_t off = SLAB_SIZE; off >= c.block_size; off -= c.block_size) {
+        void *block = slab + off - c.block_size;
+        *(void **)block = c.free_list;
+        c.free_list = block;
+    }
+    return true;
+}
+
+void *tiered_heap_t::small_alloc(int cls) {
+    size_class_t &c = classes[cls];
+    if (!c.free_list && !grow_class(cls)) return NULL;
+
+    void *block = c.free_list;
+    c.free_list = *(void **)block;
+    c.in_use++;
+    if (c.in_use > c.high_water) c.high_water = c.in_use;
+    small_used += c.block_size;
+    return block;
+}
+
+void tiered_heap_t::small_free(void *p) {
+    size_t slab = ((uint8_t *)p - sram) / SLAB_SIZE;
+    size_class_t &c = classes[slab_owner[slab]];
+    *(void **)p = c.free_list;
+    c.free_list = p;
+    c.in_use--;
+    small_used -= c.block_size;
+}
+
+/* ---- Arena tier ---- */
+
+void tiered_heap_t::arena_link(void *block) {
+    links(block)->prev = NULL;
+    links(block)->next = arena_free_list;
+    if (arena_free_list) links(arena_free_list)->prev = block;
+    arena_free_list = block;
+}
+
+void tiered_heap_t::arena_unlink(void *block) {
+    arena_links_t *l = links(block);
+    if (l->prev) links(l->prev)->next = l->next;
+    else arena_free_list = l->next;
+    if (l->next) links(l->next)->prev = l->prev;
+}
+
+void *tiered_heap_t::arena_alloc(size_t size) {
+    if (!arena || size > arena_size) return NULL;
+
+    size_t need = (size + ARENA_HEADER + 7) & ~(size_t)7;
+    if (need < ARENA_MIN_BLOCK) need = ARENA_MIN_BLOCK;
+
+    void *block = arena_free_list;
+    while (block && block_size(block) < need) {
+        block = links(block)->next;
+    }
+    if (!block) return NULL;
+
+    arena_unlink(block);
+    uint32_t size_have = block_size(block);
+    if (size_have - need >= ARENA_MIN_BLOCK) {
+        void *rest = (uint8_t *)block + need;
+        hdr(rest)->size = size_have - (uint32_t)need;
+        hdr(rest)->prev_size = (uint32_t)need;
+        hdr(next_block(rest))->prev_size = hdr(rest)->size;
+        arena_link(rest);
+        size_have = (uint32_t)need;
+    }
+    hdr(block)->size = size_have | ARENA_USED;
+
+    arena_used += size_have;
+    arena_blocks++;
+    return (uint8_t *)block + ARENA_HEADER;
+}
+
+void tiered_heap_t::arena_free(void *p) {
+    void *block = (uint8_t *)p - ARENA_HEADER;
+    uint32_t size = block_size(block);
+    arena_used -= size;
+    arena_blocks--;
+
+    void *next = (uint8_t *)block + size;
+    if (!block_used(next)) {
+        arena_unlink(next);
+        size += block_size(next);
+    }
+    if (hdr(block)->prev_size) {
+        void *prev = (uint8_t *)block - hdr(block)->prev_size;
+        if (!block_used(prev)) {
+            arena_unlink(prev);
+            size += block_size(prev);
+            block = prev;
+        }
+    }
+
+    hdr(block)->size = size;
+    hdr(next_block(block))->prev_size = size;
+    arena_link(block);
+}
+
+/* ---- Statistics ---- */
+
+void tiered_heap_t::get_class_stats(int index, tiered_heap_class_stats_t *out) const {
+    const size_class_t &c = classes[index];
+    out->block_size = c.block_size;
+    out->slabs = c.slabs;
+    out->in_use = c.in_use;
+    out->high_water = c.high_water;
+}
+
+void tiered_heap_t::get_stats(tiered_heap_stats_t *out) const {
+    memset(out, 0, sizeof(*out));
+    out->sram_size = sram_size;
+    out->sram_free = (slab_count - slabs_assigned) * SLAB_SIZE;
+    out->live = arena_blocks;
+    for (int i = 0; i < CLASS_COUNT; i++) {
+        const size_class_t &c = classes[i];
+        out->sram_free += c.slabs * SLAB_SIZE - c.in_use * c.block_size;
+        out->live += c.in_use;
+    }
+
+    size_t arena_free_bytes = 0;
+    for (void *block = arena_free_list; block; block = links(block)->next) {
+        size_t size = block_size(block);
+        arena_free_bytes += size;
+        out->arena_free_blocks++;
+        if (size > out->arena_largest_free) out->arena_largest_free = size;
+    }
+    out->arena_size = arena_size;
+    out->arena_used = arena_used;
+    out->arena_high_water = arena_high_water;
+    if (arena_free_bytes) {
+        out->frag_pct = (uint8_t)(100 - out->arena_largest_free * 100 / arena_free_bytes);
+    }
+
+    out->used = small_used + arena_used;
+    out->high_water = high_water;
+    out->allocs = allocs;
+    out->frees = frees;
+    out->failures = failures;
+}
+
+bool tiered_heap_t::check() const {
+    if (!arena) return false;
+
+    size_t free_blocks = 0;
+    uint32_t prev_size = 0;
+    bool prev_free = false;
+    void *block = arena;
+    while (block_size(block) != 0) {
+        uint32_t size = block_size(block);
+        if (hdr(block)->prev_size != prev_size) return false;
+        if ((uint8_t *)block + size > arena + arena_size - ARENA_HEADER) return false;
+        if (!block_used(block)) {
+            if (prev_free) return false;  /* Neighbours should have merged */
+            free_blocks++;
+        }
+        prev_free = !block_used(block);
+        prev_size = size;
+        block = next_block(block);
+    }
+    if ((uint8_t *)block != arena + arena_size - ARENA_HEADER) return false;
+
+    size_t listed = 0;
+    for (void *b = arena_free_list; b; b = links(b)->next) listed++;
+    return listed == free_blocks;
+}
+
+void tiered_heap_t::dump(void (*print_line)(const char *line)) const {
+    char line[96];
+    tiered_heap_stats_t s;
+    get_stats(&s);
+
+    snprintf(line, sizeof(line), "class  slabs  in use  high water");
+    print_line(line);
+    for (int i = 0; i < CLASS_COUNT; i++) {
+        const size_class_t &c = classes[i];
+        snprintf(line, sizeof(line), "%5u  %5u  %6lu  %10lu", (unsigned)c.block_size, (unsigned)c.slabs,
+                 (unsigned long)c.in_use, (unsigned long)c.high_water);
+        print_line(line);
+    }
+    snprintf(line, sizeof(line), "SRAM pools: %u / %u bytes free, %u of %u slabs assigned",
+             (unsigned)s.sram_free, (unsigned)s.sram_size, (unsigned)slabs_assigned, (unsigned)slab_count);
+    print_line(line);
+    snprintf(line, sizeof(line), "Arena (%s): %u / %u bytes used, high water %u",
+             arena_in_psram ? "PSRAM" : "SRAM", (unsigned)s.arena_used, (unsigned)s.arena_size,
+             (unsigned)s.arena_high_water);
+    print_line(line);
+    snprintf(line, sizeof(line), "Arena free: %u blocks, largest %u bytes, fragmentation %u%%",
+             (unsigned)s.arena_free_blocks, (unsigned)s.arena_largest_free, (unsigned)s.frag_pct);
+    print_line(line);
+    snprintf(line, sizeof(line), "Total: %u bytes in %lu blocks, high water %u",
+             (unsigned)s.used, (unsigned long)s.live, (unsigned)s.high_water);
+    print_line(line);
+    snprintf(line, sizeof(line), "Calls: %lu allocs, %lu frees, %lu failed",
+             (unsigned long)s.allocs, (unsigned long)s.frees, (unsigned long)s.failures);
+    print_line(line);
+}
+
+/* ---- LVGL hooks (LV_USE_STDLIB_MALLOC = LV_STDLIB_CUSTOM in lv_conf.h) ---- */
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM
+
+extern "C" {
+
+void lv_mem_init(void)
+{
+    tiered_heap.begin(TIERED_HEAP_SRAM_SIZE, TIERED_HEAP_ARENA_SIZE);
+}
+
+void lv_mem_deinit(void)
+{
+    tiered_heap.end();
+}
+
+/* Both regions are fixed at lv_mem_init() */
+lv_mem_pool_t lv_mem_add_pool(void *mem, size_t bytes)
+{
+    LV_UNUSED(mem);
+    LV_UNUSED(bytes);
+    return NULL;
+}
+
+void lv_mem_remove_pool(lv_mem_pool_t pool)
+{
+    LV_UNUSED(pool);
+}
+
+void *lv_malloc_core(size_t size)
+{
+    return tiered_heap.alloc(size);
+}
+
+void *lv_realloc_core(void *p, size_t new_size)
+{
+    return tiered_heap.realloc(p, new_size);
+}
+
+void lv_free_core(void *p)
+{
+    tiered_heap.free(p);
+}
+
+void lv_mem_monitor_core(lv_mem_monitor_t *mon_p)
+{
+    tiered_heap_stats_t s;
+    tiered_heap.get_stats(&s);
+
+    size_t total = s.sram_size + s.arena_size;
+    mon_p->total_size = total;
+    mon_p->free_cnt = s.arena_free_blocks;
+    mon_p->free_size = s.sram_free + (s.arena_size - s.arena_used);
+    mon_p->free_biggest_size = s.arena_largest_free;
+    mon_p->used_cnt = s.live;
+    mon_p->max_used = s.high_water;
+    mon_p->used_pct = total ? (uint8_t)(s.used * 100 / total) : 0;
+    mon_p->frag_pct = s.frag_pct;
+}
+
+lv_result_t lv_mem_test_core(void)
+{
+    return tiered_heap.check() ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
+}
+
+#endif
@@ -0,0 +1,130 @@
+#ifndef TIERED_HEAP_H
+#define TIERED_HEAP_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* Internal SRAM reserved for the small-object pools */
+#ifndef TIERED_HEAP_SRAM_SIZE
+#define TIERED_HEAP_SRAM_SIZE (48 * 1024)
+#endif
+
+/* PSRAM arena for everything larger than the biggest size class */
+#ifndef TIERED_HEAP_ARENA_SIZE
+#define TIERED_HEAP_ARENA_SIZE (1024 * 1024)
+#endif
+
+typedef struct {
+    uint16_t block_size;
+    uint16_t slabs;          /* 1 KB slabs owned by this class */
+    uint32_t in_use;         /* Blocks handed out */
+    uint32_t high_water;     /* Most blocks handed out at once */
+} tiered_heap_class_stats_t;
+
+typedef struct {
+    size_t sram_size;
+    size_t sram_free;        /* Free blocks plus unassigned slabs */
+    size_t arena_size;
+    size_t arena_used;       /* Including block headers */
+    size_t arena_high_water;
+    size_t arena_free_blocks;
+    size_t arena_largest_free;
+    size_t used;             /* Both tiers */
+    uint32_t live;           /* Blocks currently allocated */
+    size_t high_water;
+    uint32_t allocs;         /* Successful malloc/realloc calls since boot */
+    uint32_t frees;
+    uint32_t failures;
+    uint8_t frag_pct;        /* Arena: 100 - largest free block / free bytes */
+} tiered_heap_stats_t;
+
+/*
+ * Two-tier heap behind LVGL's lv_malloc (LV_USE_STDLIB_MALLOC = LV_STDLIB_CUSTOM).
+ *
+ * Requests up to 256 bytes - widget structs, styles, label text - come from
+ * fixed size classes carved out of 1 KB slabs in internal SRAM. A slab
+ * belongs to one class for good, so the small tier cannot fragment and the
+ * hot structs sit close together. Larger requests go to a first-fit arena
+ * in PSRAM with boundary tags, so neighbouring free blocks merge on free.
+ * When a size class runs out of slabs its requests fall through to the arena.
+ *
+ * Not thread-safe: like the rest of LVGL it is only used from the LVGL task.
+ */
+class tiered_heap_t {
+public:
+    static const int CLASS_COUNT = 5;
+    static const size_t SLAB_SIZE = 1024;
+    static const size_t MAX_SMALL = 256;
+
+    tiered_heap_t();
+
+    /* Reserve both regions. The arena falls back to internal RAM without PSRAM */
+    bool begin(size_t sram_bytes, size_t arena_bytes);
+    void end();
+
+    void *alloc(size_t size);
+    void *realloc(void *p, size_t size);
+    void free(void *p);
+
+    void get_stats(tiered_heap_stats_t *out) const;
+    void get_class_stats(int index, tiered_heap_class_stats_t *out) const;
+    uint32_t alloc_count() const { return allocs; }
+
+    /* Walk the arena and check its boundary tags */
+    bool check() const;
+
+    /* Print the per-class and arena statistics */
+    void dump(void (*print_line)(const char *line)) const;
+
+private:
+    struct size_class_t {
+        uint16_t block_size;
+        uint16_t slabs;
+        void *free_list;
+        uint32_t in_use;
+        uint32_t high_water;
+    };
+
+    uint8_t *sram;
+    size_t sram_size;
+    uint8_t *slab_owner;     /* Class index per slab, 0xFF while unassigned */
+    size_t slab_count;
+    size_t slabs_assigned;
+    size_class_t classes[CLASS_COUNT];
+
+    uint8_t *arena;
+    size_t arena_size;
+    bool arena_in_psram;
+    void *arena_free_list;
+    size_t arena_used;
+    size_t arena_high_water;
+    uint32_t arena_blocks;
+
+    size_t small_used;
+    size_t high_water;
+    uint32_t allocs;
+    uint32_t frees;
+    uint32_t failures;
+
+    bool in_sram(const void *p) const {
+        return (const uint8_t *)p >= sram && (const uint8_t *)p < sram + sram_size;
+    }
+    bool in_arena(const void *p) const {
+        return (const uint8_t *)p >= arena && (const uint8_t *)p < arena + arena_size;
+    }
+    size_t usable_size(const void *p) const;
+    void note_used();
+
+    void *small_alloc(int cls);
+    void small_free(void *p);
+    bool grow_class(int cls);
+
+    void *arena_alloc(size_t size);
+    void arena_free(void *p);
+    void arena_unlink(void *block);
+    void arena_link(void *block);
+};
+
+extern tiered_heap_t tiered_heap;
+
+#endif
@@ -0,0 +1,138 @@
+#include "telemetry.h"
+#include <Arduino.h>
+#include <stdio.h>
+#include <string.h>
+
+Telemetry telemetry;
+
+static const char* STAGE_NAMES[TM_STAGE_COUNT] = {
+    "input",
+    "sd",
+    "layout",
+    "render",
+    "flush",
+    "spi",
+    "busy",
+    "total"
+};
+
+Telemetry::Telemetry() : page_turn_start_us(0), page_turn_active(false), render_start_us(0) {
+    reset();
+}
+
+void Telemetry::reset() {
+    memset(histograms, 0, sizeof(histograms));
+    for (int i = 0; i < TM_STAGE_COUNT; i++) {
+        histograms[i].min_us = UINT32_MAX;
+    }
+}
+
+int Telemetry::bucket_index(uint32_t us) {
+    if (us < SUB_BUCKETS) return us;
+
+    int msb = 31 - __builtin_clz(us);
+    int sub = (us >> (msb - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1);
+    int index = (msb - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + sub;
+    return index < BUCKET_COUNT ? index : BUCKET_COUNT - 1;
+}
+
+uint32_t Telemetry::bucket_midpoint(int index) {
+    if (index < SUB_BUCKETS) return index;
+
+    int msb = index / SUB_BUCKETS + SUB_BUCKET_BITS - 1;
+    int sub = index % SUB_BUCKETS;
+    uint64_t lower = ((uint64_t)(SUB_BUCKETS + sub)) << (msb - SUB_BUCKET_BITS);
+    uint64_t width = 1ULL << (msb - SUB_BUCKET_BITS);
+    uint64_t mid = lower + width / 2;
+    return mid > UINT32_MAX ? UINT32_MAX : (uint32_t)mid;
+}
+
+void Telemetry::record(TelemetryStage stage, uint32_t duration_us) {
+    if (stage < 0 || stage >= TM_STAGE_COUNT) return;
+
+    Histogram& h = histograms[stage];
+    h.buckets[bucket_index(duration_us)]++;
+    h.count++;
+    h.sum_us += duration_us;
+    if (duration_us < h.min_us) h.min_us = duration_us;
+    if (duration_us > h.max_us) h.max_us = duration_us;
+}
+
+void Telemetry::begin_page_turn(uint32_t edge_us) {
+    page_turn_start_us = edge_us;
+    page_turn_active = true;
+}
+
+void Telemetry::end_page_turn() {
+    if (!page_turn_active) return;
+    page_turn_active = false;
+    record(TM_PAGE_TURN, micros() - page_turn_start_us);
+}
+
+void Telemetry::mark_render_start() {
+    render_start_us = micros();
+}
+
+void Telemetry::record_render_end(uint32_t flush_us) {
+    if (render_start_us == 0) return;
+    uint32_t elapsed = micros() - render_start_us;
+    record(TM_RENDER, elapsed > flush_us ? elapsed - flush_us : 0);
+    render_start_us = 0;
+}
+
+uint32_t Telemetry::get_count(TelemetryStage stage) const {
+    return histograms[stage].count;
+}
+
+uint32_t Telemetry::percentile(TelemetryStage stage, int p) const {
+    const Histogram& h = histograms[stage];
+    if (h.count == 0) return 0;
+
+    // Rank of the sample at percentile p, rounded up
+    uint32_t rank = (uint32_t)(((uint64_t)h.count * p + 99) / 100);
+    if (rank == 0) rank = 1;
+
+    uint32_t seen = 0;
+    for (int i = 0; i < BUCKET_COUNT; i++) {
+        seen += h.buckets[i];
+        if (seen >= rank) {
+            uint32_t mid = bucket_midpoint(i);
+            if (mid > h.max_us) return h.max_us;
+            if (mid < h.min_us) return h.min_us;
+            return mid;
+        }
+    }
+    return h.max_us;
+}
+
+const char* Telemetry::stage_name(TelemetryStage stage) {
+    return (stage >= 0 && stage < TM_STAGE_COUNT) ? STAGE_NAMES[stage] : "?";
+}
+
+void Telemetry::format_summary(char* buf, size_t len) const {
+    size_t used = snprintf(buf, len, "ms    p50/p95/p99\n");
+    for (int i = 0; i < TM_STAGE_COUNT && used < len; i++) {
+        TelemetryStage s = (TelemetryStage)i;
+        used += snprintf(buf + used, len - used, "%-7s%.1f/%.1f/%.1f\n", stage_name(s),
+                         percentile(s, 50) / 1000.0f, percentile(s, 95) / 1000.0f,
+                         percentile(s, 99) / 1000.0f);
+    }
+}
+
+void Telemetry::print_report() const {
+    Serial.println("stage    count      p50      p95      p99      max   (us)");
+    for (int i = 0; i < TM_STAGE_COUNT; i++) {
+        TelemetryStage s = (TelemetryStage)i;
+        const Histogram& h = histograms[i];
+        Serial.printf("%-8s %5lu %8lu %8lu %8lu %8lu\n", stage_name(s), (unsigned long)h.count,
+                      (unsigned long)percentile(s, 50), (unsigned long)percentile(s, 95),
+                      (unsigned long)percentile(s, 99), (unsigned long)h.max_us);
+    }
+}
+
+TelemetryScope::TelemetryScope(TelemetryStage s) : stage(s), start_us(micros()) {
+}
+
+TelemetryScope::~TelemetryScope() {
+    telemetry.record(stage, micros() - start_us);
+}
@@ -0,0 +1,86 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Stages of a page turn, from the button edge to the end of the panel BUSY period
+enum TelemetryStage {
+    TM_INPUT = 0,      // Edge to the app reacting to it
+    TM_SD_READ,        // Filling the text window with the page's first bytes
+    TM_LAYOUT,         // Line breaking the page (and reads past the window), setting the label
+    TM_RENDER,         // LVGL drawing into the draw buffer
+    TM_FLUSH,          // RGB565 to 1 bpp conversion in the flush callback
+    TM_SPI,            // Sending the framebuffer to the panel
+    TM_BUSY,           // Waiting for the panel refresh to finish
+    TM_PAGE_TURN,      // Whole page turn
+    TM_STAGE_COUNT
+};
+
+// Fixed-bucket latency histograms kept in RAM.
+// Each power of two is split into SUB_BUCKETS linear buckets and a
+// percentile reports the bucket midpoint, so its relative error stays
+// below 1 / (2 * SUB_BUCKETS).
+class Telemetry {
+private:
+    static const int SUB_BUCKET_BITS = 3;
+    static const int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    static const int BUCKET_COUNT = 32 * SUB_BUCKETS;
+
+    struct Histogram {
+        uint32_t buckets[BUCKET_COUNT];
+        uint32_t count;
+        uint32_t min_us;
+        uint32_t max_us;
+        uint64_t sum_us;
+    };
+
+    Histogram histograms[TM_STAGE_COUNT];
+    volatile uint32_t page_turn_start_us;
+    volatile bool page_turn_active;
+    uint32_t render_start_us;
+
+    static int bucket_index(uint32_t us);
+    static uint32_t bucket_midpoint(int index);
+
+public:
+    Telemetry();
+
+    void reset();
+    void record(TelemetryStage stage, uint32_t duration_us);
+
+    // A page turn spans the input handler and the LVGL task
+    void begin_page_turn(uint32_t edge_us);
+    void end_page_turn();
+
+    // Called from the display render-start event and the last flush.
+    // In partial mode bands are flushed while rendering goes on, so the
+    // flush time is passed in and left out of the render stage.
+    void mark_render_start();
+    void record_render_end(uint32_t flush_us);
+
+    uint32_t get_count(TelemetryStage stage) const;
+    // Latency at percentile p (0-100), in microseconds
+    uint32_t percentile(TelemetryStage stage, int p) const;
+
+    static const char* stage_name(TelemetryStage stage);
+
+    // Multi-line p50/p95/p99 table, one stage per line
+    void format_summary(char* buf, size_t len) const;
+    void print_report() const;
+};
+
+// Measures the lifetime of the scope into one stage
+class TelemetryScope {
+private:
+    TelemetryStage stage;
+    uint32_t start_us;
+
+public:
+    explicit TelemetryScope(TelemetryStage s);
+    ~TelemetryScope();
+};
+
+extern Telemetry telemetry;
+
+#endif
@@ -0,0 +1,68 @@
+#include "text_window.h"
+#include <Arduino.h>
+
+TextWindow::TextWindow() : source(nullptr), book_size(0), start(0), len(0) {
+}
+
+void TextWindow::attach(BookSource* s) {
+    source = s;
+    book_size = s ? s->size() : 0;
+    len = 0;
+}
+
+void TextWindow::detach() {
+    source = nullptr;
+    book_size = 0;
+    len = 0;
+}
+
+int TextWindow::fill(uint32_t offset) {
+    if (!source || offset >= book_size) return -1;
+    len = 0;
+    start = offset;
+    int got = source->read(offset, buf, SIZE);
+    if (got <= 0) return -1;
+    len = got;
+    return buf[0];
+}
+
+int TextWindow::fill_back(uint32_t offset) {
+    if (offset >= book_size) return -1;
+    if (fill(offset >= SIZE - 1 ? offset - (SIZE - 1) : 0) < 0 || offset - start >= len) return -1;
+    return buf[offset - start];
+}
+
+int TextWindow::decode(uint32_t offset, uint32_t* cp) {
+    int c = byte_at(offset);
+    if (c < 0) return 0;
+    if (c < 0x80) {
+        *cp = c;
+        return 1;
+    }
+
+    int n;
+    uint32_t value;
+    if ((c & 0xE0) == 0xC0) {
+        n = 2;
+        value = c & 0x1F;
+    } else if ((c & 0xF0) == 0xE0) {
+        n = 3;
+        value = c & 0x0F;
+    } else if ((c & 0xF8) == 0xF0) {
+        n = 4;
+        value = c & 0x07;
+    } else {
+        *cp = 0xFFFD;
+        return 1;
+    }
+    for (int i = 1; i < n; i++) {
+        int next = byte_at(offset + i);
+        if (next < 0 || (next & 0xC0) != 0x80) {
+            *cp = 0xFFFD;
+            return 1;
+        }
+        value = (value << 6) | (next & 0x3F);
+    }
+    *cp = value;
+    return n;
+}
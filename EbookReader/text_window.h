@@ -0,0 +1,54 @@
+#ifndef TEXT_WINDOW_H
+#define TEXT_WINDOW_H
+
+#include <stdint.h>
+#include "book_source.h"
+
+// A window of a book's text, read from its source SIZE bytes at a time.
+// Layout walks the text a byte at a time; inside the window that is an
+// array access, and leaving it costs one read from the source. Each user
+// of the book (the page on screen, the background indexer) has a window of
+// its own over the same source, so they do not evict each other's bytes.
+class TextWindow {
+public:
+    static const int SIZE = 2048;
+
+    TextWindow();
+
+    void attach(BookSource* source);
+    void detach();
+    // Forgets the bytes read so far
+    void invalidate() { len = 0; }
+
+    uint32_t size() const { return book_size; }
+
+    // Byte at `offset`, -1 at or past the end of the book or on a read error
+    int byte_at(uint32_t offset) {
+        if (offset - start < len) return buf[offset - start];
+        return fill(offset);
+    }
+
+    // The same, for walking backwards: a miss reads the SIZE bytes that end
+    // at `offset`
+    int byte_at_back(uint32_t offset) {
+        if (offset - start < len) return buf[offset - start];
+        return fill_back(offset);
+    }
+
+    // Decodes the UTF-8 character at `offset` into `cp` and returns its
+    // length; a malformed byte comes back as U+FFFD of length 1, the end
+    // of the book as length 0
+    int decode(uint32_t offset, uint32_t* cp);
+
+private:
+    BookSource* source;
+    uint32_t book_size;
+    uint32_t start;
+    uint32_t len;
+    uint8_t buf[SIZE];
+
+    int fill(uint32_t offset);
+    int fill_back(uint32_t offset);
+};
+
+#endif
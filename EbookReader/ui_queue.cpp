@@ -0,0 +1,42 @@
+#include "ui_queue.h"
+#include "user_app.h"
+#include <Arduino.h>
+
+UiQueue ui_queue;
+
+UiQueue::UiQueue() : dropped(0) {
+}
+
+bool UiQueue::post(const UiCommand& cmd) {
+    if (!commands.push(cmd)) {
+        dropped++;
+        Serial.printf("UI queue full, dropped command %d\n", (int)cmd.type);
+        return false;
+    }
+    lvgl_port_wake();
+    return true;
+}
+
+bool UiQueue::post_button(const ButtonEvent& event) {
+    UiCommand cmd;
+    cmd.type = UI_CMD_BUTTON;
+    cmd.button = event;
+    return post(cmd);
+}
+
+bool UiQueue::post_battery(int level) {
+    UiCommand cmd;
+    cmd.type = UI_CMD_BATTERY;
+    cmd.battery_level = level;
+    return post(cmd);
+}
+
+int UiQueue::drain(UiCommandHandler handler) {
+    int count = 0;
+    UiCommand cmd;
+    while (commands.pop(cmd)) {
+        handler(cmd);
+        count++;
+    }
+    return count;
+}
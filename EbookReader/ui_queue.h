@@ -0,0 +1,54 @@
+#ifndef UI_QUEUE_H
+#define UI_QUEUE_H
+
+#include <stdint.h>
+#include "button_input.h"
+#include "spsc_ring.h"
+
+enum UiCommandType {
+    UI_CMD_BUTTON = 0,   // Run the current app's button handler
+    UI_CMD_BATTERY,      // Show a new battery level in the bottom bar
+    UI_CMD_HEAP_REPORT,      // Print the LVGL heap statistics
+    UI_CMD_TELEMETRY_REPORT, // Print the latency histograms
+    UI_CMD_TELEMETRY_RESET,  // Clear the latency histograms
+    UI_CMD_TRACE_DUMP,       // Print the panel trace
+    UI_CMD_TRACE_CLEAR       // Clear the panel trace
+};
+
+struct UiCommand {
+    UiCommandType type;
+    union {
+        ButtonEvent button;
+        int battery_level;
+    };
+};
+
+typedef void (*UiCommandHandler)(const UiCommand& cmd);
+
+// Commands from the input task to the LVGL task.
+// LVGL objects are only touched on the LVGL task: the input task posts
+// here and the LVGL task drains the whole batch before lv_timer_handler(),
+// so the updates of one key press end up in a single render.
+// The input task is the only producer.
+class UiQueue {
+private:
+    SpscRing<UiCommand, 32> commands;
+    volatile uint32_t dropped;
+
+public:
+    UiQueue();
+
+    // Input task side. Wakes the LVGL task; returns false if the queue is full.
+    bool post(const UiCommand& cmd);
+    bool post_button(const ButtonEvent& event);
+    bool post_battery(int level);
+
+    // LVGL task side, with the LVGL lock held. Returns the number of commands run.
+    int drain(UiCommandHandler handler);
+
+    uint32_t get_dropped() const { return dropped; }
+};
+
+extern UiQueue ui_queue;
+
+#endif
@@ -4,11 +4,26 @@
 #include "user_app.h"
 #include "user_config.h"
 #include "src/power/board_power_bsp.h"
+#include "src/display/epd_trace.h"
+#include "src/memory/tiered_heap.h"
+#include "src/font/glyph_cache.h"
+#include "src/font/sd_font.h"
+#include "telemetry.h"
+#include "button_input.h"
+#include "ui_queue.h"
 #include "app_manager.h"
 #include "bottom_bar.h"
 #include "main_menu_app.h"
 #include "reading_app.h"
 
+// 内置正文字体：没有 SD 字体时使用，也补充 SD 字体缺的字
+#if READER_BUILTIN_FONT
+LV_FONT_DECLARE(my_font_chinese_16);
+#define BUILTIN_TEXT_FONT (&my_font_chinese_16)
+#else
+#define BUILTIN_TEXT_FONT LV_FONT_DEFAULT
+#endif
+
 // --- 全局对象 ---
 epaper_driver_display *driver = NULL;
 board_power_bsp_t board_power_bsp(EPD_PWR_PIN, Audio_PWR_PIN, VBAT_PWR_PIN);
@@ -29,9 +44,86 @@ const int APP_COUNT = sizeof(app_list) / sizeof(app_list[0]);
 unsigned long last_battery_update = 0;
 const unsigned long BATTERY_UPDATE_INTERVAL = 60000; // Update every 60 seconds
 
-// Last app info to detect changes
+// Last app info to detect changes (LVGL task only)
 char last_app_info[64] = "";
 
+// Longest sleep of the input task, so the serial console is still polled
+const uint32_t INPUT_IDLE_WAIT_MS = 1000;
+
+// Panel trace ring size (records of 16 bytes, kept in PSRAM)
+const int EPD_TRACE_CAPACITY = 4096;
+
+static void serial_print_line(const char* line)
+{
+  Serial.println(line);
+}
+
+// Serial commands: 't' dumps the panel trace, 'c' clears it,
+// 'h' prints the latency histograms, 'r' resets them,
+// 'm' prints the LVGL heap and app arena statistics
+static void handle_serial_commands(void)
+{
+  while (Serial.available() > 0) {
+    int c = Serial.read();
+    if (c == 't' || c == 'c') {
+      // The panel driver pushes trace records on the LVGL task
+      UiCommand cmd;
+      cmd.type = c == 't' ? UI_CMD_TRACE_DUMP : UI_CMD_TRACE_CLEAR;
+      ui_queue.post(cmd);
+    } else if (c == 'h' || c == 'r') {
+      // The flush callback records into the histograms on the LVGL task
+      UiCommand cmd;
+      cmd.type = c == 'h' ? UI_CMD_TELEMETRY_REPORT : UI_CMD_TELEMETRY_RESET;
+      ui_queue.post(cmd);
+    } else if (c == 'm') {
+      // The heap belongs to the LVGL task, read it there
+      UiCommand cmd;
+      cmd.type = UI_CMD_HEAP_REPORT;
+      ui_queue.post(cmd);
+    }
+  }
+}
+
+// Runs on the LVGL task
+static void execute_ui_command(const UiCommand& cmd)
+{
+  switch (cmd.type) {
+    case UI_CMD_BUTTON:
+      app_manager.handle_button(cmd.button);
+      break;
+    case UI_CMD_BATTERY:
+      // Trace records come from the LVGL task only, the mark too
+      EPD_TRACE_MARK("battery");
+      bottom_bar.update_battery(cmd.battery_level);
+      break;
+    case UI_CMD_HEAP_REPORT:
+      tiered_heap.dump(serial_print_line);
+      sd_font.dump(serial_print_line);
+      glyph_cache.dump(serial_print_line);
+      app_manager.dump_memory(serial_print_line);
+      break;
+    case UI_CMD_TELEMETRY_REPORT:
+      telemetry.print_report();
+      break;
+    case UI_CMD_TELEMETRY_RESET:
+      telemetry.reset();
+      Serial.println("Telemetry reset");
+      break;
+    case UI_CMD_TRACE_DUMP:
+      epd_trace.dump(serial_print_line);
+      break;
+    case UI_CMD_TRACE_CLEAR:
+      epd_trace.clear();
+      Serial.println("Trace cleared");
+      break;
+  }
+}
+
+static void post_button_event(const ButtonEvent& event)
+{
+  ui_queue.post_button(event);
+}
+
 // --- 初始化硬件 ---
 void user_app_init(void)
 {
@@ -43,9 +135,8 @@ void user_app_init(void)
   board_power_bsp.POWEER_Audio_ON();
   delay(100);
 
-  // 2. 按键初始化
-  pinMode(BOOT_BUTTON_PIN, INPUT_PULLUP);
-  pinMode(PWR_BUTTON_PIN, INPUT_PULLUP); // 假设 GPIO18 需要上拉
+  // 2. 按键初始化 (边沿中断，唤醒当前的 loop 任务)
+  button_input.begin(xTaskGetCurrentTaskHandle());
 
   // 3. SD 卡初始化
   // 必须指定引脚，防止 S3 使用默认的其他引脚
@@ -57,6 +148,12 @@ void user_app_init(void)
   }
 
   // 4. 墨水屏底层驱动初始化
+#if EPD_TRACE_ENABLE
+  if (!epd_trace.begin(EPD_TRACE_CAPACITY)) {
+      Serial.println(">>> EPD trace disabled (no memory)");
+  }
+  EPD_TRACE_MARK("boot");
+#endif
   custom_lcd_spi_t driver_config = {};
     driver_config.cs = EPD_CS_PIN;
     driver_config.dc = EPD_DC_PIN;
@@ -74,15 +171,50 @@ void user_app_init(void)
   driver->EPD_Init_Partial(); // 开启局部刷新
 }
 
+// --- 正文字体 ---
+// 打开 READER_FONT_FILE，未指定或打不开时取 READER_FONT_DIR 中第一个能打开的 .ebf；
+// 都没有时返回内置字体
+static const lv_font_t* open_text_font(void)
+{
+  char path[64];
+  if (READER_FONT_FILE[0] != '\0') {
+    snprintf(path, sizeof(path), "%s/%s", READER_FONT_DIR, READER_FONT_FILE);
+    if (sd_font.open(path, SD_FONT_CACHE_BLOCKS, BUILTIN_TEXT_FONT)) return sd_font.font();
+  }
+
+  File dir = SD.open(READER_FONT_DIR);
+  if (dir && dir.isDirectory()) {
+    bool is_dir = false;
+    while (true) {
+      String name = dir.getNextFileName(&is_dir);
+      if (name.isEmpty()) break;
+      const char* ext = strrchr(name.c_str(), '.');
+      if (is_dir || !ext || strcasecmp(ext, ".ebf") != 0) continue;
+      if (sd_font.open(name.c_str(), SD_FONT_CACHE_BLOCKS, BUILTIN_TEXT_FONT)) break;
+    }
+    dir.close();
+  }
+  if (sd_font.is_open()) return sd_font.font();
+
+  Serial.println(">>> No SD font, using the built-in font");
+  return BUILTIN_TEXT_FONT;
+}
+
 // --- 初始化 UI ---
 void user_ui_init(void)
 {
+    // The apps draw text through the glyph cache, in front of the SD font
+    glyph_cache.begin(open_text_font(), GLYPH_CACHE_SRAM_SLOTS, GLYPH_CACHE_PSRAM_SLOTS);
+    
     // Register all apps with the manager
     app_manager.register_apps(app_list, APP_COUNT);
     
     // Create bottom bar first
     bottom_bar.create();
     
+    // Buttons also feed an LVGL keypad
+    button_input.create_indev();
+    
     // Initialize battery display
     int battery_level = board_power_bsp.read_battery_percentage();
     bottom_bar.update_battery(battery_level);
@@ -92,24 +224,42 @@ void user_ui_init(void)
     app_manager.switch_to_app(0);
 }
 
-// --- 循环按键检测和电池更新 ---
-void reader_loop_handle(void) {
+// --- 执行界面命令 (LVGL 任务) ---
+void user_ui_drain(void) {
+    if (ui_queue.drain(execute_ui_command) > 0) {
+        // Call current app's loop
+        app_manager.loop();
+        
+        // Update bottom bar with current app info only if it changed
+        const char* current_app_info = app_manager.get_current_app_info();
+        if (strcmp(current_app_info, last_app_info) != 0) {
+            bottom_bar.update_app_info(current_app_info);
+            strncpy(last_app_info, current_app_info, sizeof(last_app_info) - 1);
+            last_app_info[sizeof(last_app_info) - 1] = '\0';
+        }
+    }
+    
+    // Staged bottom bar changes join the content refresh, if there is one
+    bottom_bar.commit_with_content();
+}
+
+// --- 按键事件和电池更新 (loop 任务，不直接操作 LVGL) ---
+uint32_t reader_loop_handle(void) {
+    handle_serial_commands();
+    
+    // Debounced button events are handled by the current app on the LVGL task
+    uint32_t wait_ms = button_input.process(post_button_event);
+    
     // Update battery periodically (with millis() wraparound handling)
     unsigned long current_time = millis();
     if (current_time - last_battery_update >= BATTERY_UPDATE_INTERVAL) {
         int battery_level = board_power_bsp.read_battery_percentage();
-        bottom_bar.update_battery(battery_level);
+        ui_queue.post_battery(battery_level);
         last_battery_update = current_time;
     }
     
-    // Update bottom bar with current app info only if it changed
-    const char* current_app_info = app_manager.get_current_app_info();
-    if (strcmp(current_app_info, last_app_info) != 0) {
-        bottom_bar.update_app_info(current_app_info);
-        strncpy(last_app_info, current_app_info, sizeof(last_app_info) - 1);
-        last_app_info[sizeof(last_app_info) - 1] = '\0';
-    }
-    
-    // Call current app's loop
-    app_manager.loop();
+    uint32_t battery_wait_ms = BATTERY_UPDATE_INTERVAL - (current_time - last_battery_update);
+    if (battery_wait_ms < wait_ms) wait_ms = battery_wait_ms;
+    if (INPUT_IDLE_WAIT_MS < wait_ms) wait_ms = INPUT_IDLE_WAIT_MS;
+    return wait_ms;
 }
\ No newline at end of file
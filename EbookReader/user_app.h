@@ -17,8 +17,15 @@ void user_app_init(void);
 // 初始化 UI
 void user_ui_init(void);
 
-// 按键处理 (在 loop 中调用)
-void reader_loop_handle(void);
+// 按键事件和定时任务处理 (在 loop 中调用)
+// 返回距下一个定时任务的毫秒数，loop 据此阻塞等待按键通知
+uint32_t reader_loop_handle(void);
+
+// 在 LVGL 任务中执行排队的界面命令 (持有 LVGL 锁，lv_timer_handler 之前调用)
+void user_ui_drain(void);
+
+// 唤醒 LVGL 任务 (界面失效、输入或定时器到期时调用)
+void lvgl_port_wake(void);
 
 #ifdef __cplusplus
 }
@@ -33,8 +33,26 @@
 #define PWR_BUTTON_PIN  GPIO_NUM_18
 
 // --- LVGL 配置 ---
-#define EXAMPLE_LVGL_TICK_PERIOD_MS    5
-#define EXAMPLE_LVGL_TASK_MAX_DELAY_MS 500
+// LVGL 任务空闲时阻塞等待通知，这里只限制两次处理之间的最短间隔
 #define EXAMPLE_LVGL_TASK_MIN_DELAY_MS 20
+// 底栏 (电量/应用信息) 的修改随下一次内容刷新一起提交，
+// 超过这个时间仍没有内容刷新时才单独刷新一次
+#define BOTTOM_BAR_STALE_MS            (5 * 60 * 1000)
+// 局部渲染条带高度 (行)，两块条带缓冲放在内部 SRAM
+#define EXAMPLE_LVGL_BAND_LINES        20
+
+// --- 应用切换 ---
+// 切换应用时挂起原应用，保留状态和界面，返回时只需刷新一次；
+// LVGL 堆剩余少于这个值时改为完全释放
+#define APP_SUSPEND_MIN_FREE_BYTES     (32 * 1024)
+
+// --- 字体 ---
+// 正文字体从 SD 卡读取 (tools/ebf_convert.py 生成的 .ebf 文件)
+#define READER_FONT_DIR                "/fonts"
+// 指定字体文件名；为空时使用目录中找到的第一个 .ebf
+#define READER_FONT_FILE               ""
+// 为 1 时把 my_font_chinese_16 编译进固件，没有 SD 字体时使用，
+// SD 字体缺字时也用它补充；设为 0 去掉它，固件小一个数量级
+#define READER_BUILTIN_FONT            1
 
 #endif
\ No newline at end of file
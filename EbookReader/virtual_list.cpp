@@ -0,0 +1,101 @@
+#include "virtual_list.h"
+#include <stdio.h>
+#include <string.h>
+
+VirtualList::VirtualList() : page_label(nullptr), rows(0), first(0), selected(0), count(0),
+                             shown_page(-1), source(nullptr), source_ctx(nullptr) {
+    memset(labels, 0, sizeof(labels));
+    memset(item_text, 0, sizeof(item_text));
+    memset(row_text, 0, sizeof(row_text));
+    memset(page_text, 0, sizeof(page_text));
+    for (int i = 0; i < MAX_ROWS; i++) {
+        bound[i] = -1;
+        row_selected[i] = false;
+    }
+}
+
+void VirtualList::create(lv_obj_t* parent, int row_count, int32_t y, int32_t row_height,
+                         const lv_font_t* font) {
+    if (labels[0]) return;
+    rows = row_count > MAX_ROWS ? MAX_ROWS : row_count;
+
+    for (int i = 0; i < rows; i++) {
+        labels[i] = lv_label_create(parent);
+        lv_obj_set_style_text_font(labels[i], font, 0);
+        lv_label_set_long_mode(labels[i], LV_LABEL_LONG_CLIP);
+        lv_obj_set_width(labels[i], lv_pct(100));
+        lv_label_set_text_static(labels[i], row_text[i]);
+        lv_obj_align(labels[i], LV_ALIGN_TOP_LEFT, 10, y + i * row_height);
+        lv_obj_add_flag(labels[i], LV_OBJ_FLAG_HIDDEN);
+    }
+
+    page_label = lv_label_create(parent);
+    lv_obj_set_style_text_font(page_label, font, 0);
+    lv_label_set_text_static(page_label, page_text);
+    lv_obj_align(page_label, LV_ALIGN_TOP_RIGHT, 0, 5);
+    lv_obj_add_flag(page_label, LV_OBJ_FLAG_HIDDEN);
+}
+
+void VirtualList::set_source(ItemText item_text_cb, void* ctx, int item_count) {
+    source = item_text_cb;
+    source_ctx = ctx;
+    count = item_count;
+    if (selected >= count) selected = count > 0 ? count - 1 : 0;
+    invalidate();
+}
+
+void VirtualList::invalidate() {
+    for (int i = 0; i < rows; i++) {
+        bound[i] = -2;  // Never a valid binding, forces a rebind
+    }
+    shown_page = -1;
+}
+
+void VirtualList::set_selected(int index) {
+    if (!labels[0]) return;
+    if (index < 0) index = 0;
+    if (index >= count) index = count > 0 ? count - 1 : 0;
+    selected = index;
+    first = (selected / rows) * rows;
+
+    for (int r = 0; r < rows; r++) {
+        int item = first + r < count ? first + r : -1;
+        bool is_selected = item >= 0 && item == selected;
+        bool rebind = bound[r] != item;
+
+        if (rebind) {
+            bound[r] = item;
+            if (item < 0) {
+                lv_obj_add_flag(labels[r], LV_OBJ_FLAG_HIDDEN);
+                continue;
+            }
+            item_text[r][0] = '\0';
+            if (source) source(source_ctx, item, item_text[r], sizeof(item_text[r]));
+        } else if (item < 0 || row_selected[r] == is_selected) {
+            continue;
+        }
+
+        // Selected item gets a cursor; no highlighting on e-ink
+        row_selected[r] = is_selected;
+        snprintf(row_text[r], sizeof(row_text[r]), "%s%s", is_selected ? "▶ " : "", item_text[r]);
+        lv_label_set_text_static(labels[r], row_text[r]);
+        lv_obj_clear_flag(labels[r], LV_OBJ_FLAG_HIDDEN);
+    }
+
+    update_page_label();
+}
+
+void VirtualList::update_page_label() {
+    int pages = (count + rows - 1) / rows;
+    int page = first / rows;
+    if (page == shown_page) return;
+    shown_page = page;
+
+    if (pages <= 1) {
+        lv_obj_add_flag(page_label, LV_OBJ_FLAG_HIDDEN);
+        return;
+    }
+    snprintf(page_text, sizeof(page_text), "%d/%d", page + 1, pages);
+    lv_label_set_text_static(page_label, page_text);
+    lv_obj_clear_flag(page_label, LV_OBJ_FLAG_HIDDEN);
+}
@@ -0,0 +1,57 @@
+#ifndef VIRTUAL_LIST_H
+#define VIRTUAL_LIST_H
+
+#include <stddef.h>
+#include "lvgl.h"
+
+// Fixed pool of label rows showing a window of a longer list.
+// Rows are bound to items through a callback only when the window moves,
+// so the data source (e.g. the book catalog on SD) is read a screenful at a
+// time. The window pages by screenfuls and always contains the selection;
+// on each update only rows whose item or cursor changed are touched, so a
+// cursor move redraws two rows. Memory and render cost depend on the number
+// of rows, not on the number of items.
+class VirtualList {
+public:
+    static const int MAX_ROWS = 8;
+    static const int TEXT_SIZE = 140;
+
+    // Writes the text of item `index` into `buf`
+    typedef void (*ItemText)(void* ctx, int index, char* buf, size_t len);
+
+    VirtualList();
+
+    // Builds the rows inside `parent`, the first at `y`
+    void create(lv_obj_t* parent, int rows, int32_t y, int32_t row_height, const lv_font_t* font);
+
+    // New data: all rows are bound again on the next update
+    void set_source(ItemText item_text, void* ctx, int count);
+    void invalidate();
+
+    // Moves the cursor to `index` and updates the rows that changed
+    void set_selected(int index);
+
+    int get_selected() const { return selected; }
+    int get_count() const { return count; }
+    int get_first() const { return first; }
+
+private:
+    lv_obj_t* labels[MAX_ROWS];
+    lv_obj_t* page_label;          // "page/pages", shown when there is more than one screenful
+    char item_text[MAX_ROWS][TEXT_SIZE];
+    char row_text[MAX_ROWS][TEXT_SIZE + 4];
+    char page_text[16];
+    int bound[MAX_ROWS];           // Item shown by each row, -1 = hidden
+    bool row_selected[MAX_ROWS];
+    int rows;
+    int first;
+    int selected;
+    int count;
+    int shown_page;
+    ItemText source;
+    void* source_ctx;
+
+    void update_page_label();
+};
+
+#endif
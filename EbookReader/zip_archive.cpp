@@ -0,0 +1,142 @@
+#include "zip_archive.h"
+#include <Arduino.h>
+#include <string.h>
+
+static const uint32_t END_SIGNATURE = 0x06054B50;
+static const uint32_t DIRECTORY_SIGNATURE = 0x02014B50;
+static const uint32_t LOCAL_SIGNATURE = 0x04034B50;
+static const uint32_t END_SIZE = 22;
+static const uint32_t DIRECTORY_HEADER_SIZE = 46;
+static const uint32_t LOCAL_HEADER_SIZE = 30;
+// The end record is followed by a comment of at most 64 KB
+static const uint32_t MAX_COMMENT = 0xFFFF;
+
+static uint16_t get16(const uint8_t* p) {
+    return p[0] | (p[1] << 8);
+}
+
+static uint32_t get32(const uint8_t* p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+ZipArchive::ZipArchive() : file(nullptr), directory(nullptr), directory_size(0), entry_count(0),
+                           data_offset(0), done(0) {
+    memset(&current, 0, sizeof(current));
+}
+
+ZipArchive::~ZipArchive() {
+    close();
+}
+
+// Finds the end of central directory record, normally the last 22 bytes
+bool ZipArchive::find_end(uint32_t* dir_offset, uint32_t* dir_size, int* count) {
+    uint32_t size = file->size();
+    if (size < END_SIZE) return false;
+
+    uint8_t buf[512];
+    uint32_t lowest = size > END_SIZE + MAX_COMMENT ? size - END_SIZE - MAX_COMMENT : 0;
+    uint32_t end = size;
+    while (end > lowest) {
+        // Chunks overlap by END_SIZE - 1 so a record on a boundary is seen
+        uint32_t start = end > sizeof(buf) ? end - sizeof(buf) : 0;
+        if (start < lowest) start = lowest;
+        uint32_t len = end - start;
+        if (!file->seek(start) || file->read(buf, len) != len) return false;
+        for (int i = (int)len - (int)END_SIZE; i >= 0; i--) {
+            if (get32(buf + i) != END_SIGNATURE) continue;
+            *count = get16(buf + i + 10);
+            *dir_size = get32(buf + i + 12);
+            *dir_offset = get32(buf + i + 16);
+            return *dir_offset + *dir_size <= start + i;
+        }
+        if (start == lowest) break;
+        end = start + END_SIZE - 1;
+    }
+    return false;
+}
+
+bool ZipArchive::open(File* f, AppArena& arena) {
+    close();
+    file = f;
+
+    uint32_t offset = 0;
+    uint32_t size = 0;
+    int count = 0;
+    if (!find_end(&offset, &size, &count)) {
+        Serial.println("Not a ZIP file");
+        return false;
+    }
+    uint8_t* dir = (uint8_t*)arena.alloc(size, 4);
+    if (!dir) {
+        Serial.printf("ZIP directory of %lu bytes does not fit\n", (unsigned long)size);
+        return false;
+    }
+    if (!file->seek(offset) || file->read(dir, size) != size) return false;
+    if (!stream.begin()) return false;
+
+    directory = dir;
+    directory_size = size;
+    entry_count = count;
+    return true;
+}
+
+void ZipArchive::close() {
+    stream.end();
+    directory = nullptr;
+    directory_size = 0;
+    entry_count = 0;
+    file = nullptr;
+}
+
+bool ZipArchive::find(const char* name, ZipEntry& entry) const {
+    size_t name_len = strlen(name);
+    uint32_t pos = 0;
+    for (int i = 0; i < entry_count && pos + DIRECTORY_HEADER_SIZE <= directory_size; i++) {
+        const uint8_t* h = directory + pos;
+        if (get32(h) != DIRECTORY_SIGNATURE) return false;
+        uint16_t len = get16(h + 28);
+        uint16_t extra = get16(h + 30);
+        uint16_t comment = get16(h + 32);
+        if (pos + DIRECTORY_HEADER_SIZE + len > directory_size) return false;
+        if (len == name_len && memcmp(h + DIRECTORY_HEADER_SIZE, name, len) == 0) {
+            entry.method = get16(h + 10);
+            entry.compressed_size = get32(h + 20);
+            entry.size = get32(h + 24);
+            entry.local_offset = get32(h + 42);
+            return true;
+        }
+        pos += DIRECTORY_HEADER_SIZE + len + extra + comment;
+    }
+    return false;
+}
+
+bool ZipArchive::begin_entry(const ZipEntry& entry) {
+    uint8_t h[LOCAL_HEADER_SIZE];
+    if (!file || (entry.method != 0 && entry.method != 8)) return false;
+    if (!file->seek(entry.local_offset) || file->read(h, sizeof(h)) != sizeof(h) ||
+        get32(h) != LOCAL_SIGNATURE) {
+        return false;
+    }
+    current = entry;
+    data_offset = entry.local_offset + LOCAL_HEADER_SIZE + get16(h + 26) + get16(h + 28);
+    done = 0;
+    if (entry.method == 8) stream.start(file, data_offset);
+    return true;
+}
+
+int ZipArchive::read(uint8_t* buf, int len) {
+    if (!file) return -1;
+    uint32_t left = current.size - done;
+    if ((uint32_t)len > left) len = left;
+    if (len == 0) return 0;
+
+    int got;
+    if (current.method == 0) {
+        got = file->seek(data_offset + done) ? file->read(buf, len) : -1;
+    } else {
+        got = stream.read(buf, len);
+    }
+    if (got <= 0) return -1;
+    done += got;
+    return got;
+}
@@ -0,0 +1,51 @@
+#ifndef ZIP_ARCHIVE_H
+#define ZIP_ARCHIVE_H
+
+#include <stdint.h>
+#include <SD.h>
+#include "app_arena.h"
+#include "src/compress/inflate.h"
+
+struct ZipEntry {
+    uint32_t local_offset;     // Local file header
+    uint32_t compressed_size;
+    uint32_t size;
+    uint16_t method;           // 0 stored, 8 deflate
+};
+
+// Reads members of a ZIP file, one at a time, without unpacking it.
+// open() loads the central directory into the caller's arena; find() looks
+// a name up there, and an entry is then streamed with begin_entry() and
+// read(), inflated on the fly. ZIP64 and encrypted members are not
+// supported.
+class ZipArchive {
+public:
+    ZipArchive();
+    ~ZipArchive();
+
+    // The directory stays in `arena` until the caller releases it
+    bool open(File* file, AppArena& arena);
+    void close();
+
+    int count() const { return entry_count; }
+    bool find(const char* name, ZipEntry& entry) const;
+
+    bool begin_entry(const ZipEntry& entry);
+    // Up to `len` bytes of the entry: the count, 0 at its end, -1 on error
+    int read(uint8_t* buf, int len);
+
+private:
+    File* file;
+    const uint8_t* directory;
+    uint32_t directory_size;
+    int entry_count;
+
+    inflate_t stream;
+    ZipEntry current;
+    uint32_t data_offset;
+    uint32_t done;
+
+    bool find_end(uint32_t* dir_offset, uint32_t* dir_size, int* count);
+};
+
+#endif
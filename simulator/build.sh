@@ -0,0 +1,67 @@
+#!/bin/sh
+# Build the host simulator.
+#
+#   LVGL_DIR=/path/to/lvgl-9.2 ./simulator/build.sh
+#
+# FONT_SRC may point at the generated my_font_chinese_16.c. Without it the
+# built-in Source Han Sans 16 CJK font from LVGL stands in for it.
+
+set -e
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+SIM="$ROOT/simulator"
+APP="$ROOT/EbookReader"
+OUT=${BUILD_DIR:-"$SIM/build"}
+CC=${CC:-cc}
+CXX=${CXX:-c++}
+
+if [ -z "$LVGL_DIR" ] || [ ! -f "$LVGL_DIR/lvgl.h" ]; then
+    echo "Set LVGL_DIR to an LVGL 9.2 source tree" >&2
+    exit 1
+fi
+
+CFLAGS="-O2 -g -DLV_CONF_INCLUDE_SIMPLE -I$SIM -I$LVGL_DIR/.. -I$LVGL_DIR"
+CXXFLAGS="$CFLAGS -std=gnu++17 -I$SIM/include -I$APP"
+
+mkdir -p "$OUT/lvgl"
+for src in $(find "$LVGL_DIR/src" -name '*.c'); do
+    obj="$OUT/lvgl/$(echo "${src#$LVGL_DIR/}" | tr '/' '_' | sed 's/\.c$/.o/')"
+    if [ ! -f "$obj" ] || [ "$src" -nt "$obj" ]; then
+        $CC $CFLAGS -c "$src" -o "$obj"
+    fi
+done
+
+FONT_OBJ=""
+LDFLAGS=""
+if [ -n "$FONT_SRC" ]; then
+    $CC $CFLAGS -I$LVGL_DIR/src -c "$FONT_SRC" -o "$OUT/font.o"
+    FONT_OBJ="$OUT/font.o"
+else
+    LDFLAGS="-Wl,--defsym=my_font_chinese_16=lv_font_source_han_sans_sc_16_cjk"
+fi
+
+# Everything under src/ except the GUI Guider output, which the apps do not use
+APP_SRCS=$(find "$APP/src" -name '*.cpp' -not -path '*/ui_src/*')
+
+$CXX $CXXFLAGS \
+    "$SIM"/*.cpp \
+    "$APP"/*.cpp \
+    $APP_SRCS \
+    $FONT_OBJ "$OUT"/lvgl/*.o $LDFLAGS -o "$OUT/ebook_sim"
+
+$CXX $CXXFLAGS \
+    "$SIM/tools/trace_replay.cpp" \
+    "$SIM/sim_hal.cpp" \
+    "$SIM/sim_panel.cpp" \
+    "$APP/src/display/epd_trace.cpp" \
+    "$APP/src/display/epaper_driver_bsp.cpp" \
+    -o "$OUT/trace_replay"
+
+$CXX $CXXFLAGS \
+    "$SIM/tools/font_bench.cpp" \
+    "$SIM/sim_sd.cpp" \
+    "$APP/src/font/sd_font.cpp" \
+    "$APP/src/memory/tiered_heap.cpp" \
+    "$OUT"/lvgl/*.o -o "$OUT/font_bench"
+
+echo "Built $OUT/ebook_sim, $OUT/trace_replay and $OUT/font_bench"
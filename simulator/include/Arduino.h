@@ -0,0 +1,91 @@
+#ifndef SIM_ARDUINO_H
+#define SIM_ARDUINO_H
+
+// Host shim for the Arduino-ESP32 core API used by the firmware.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <strings.h>
+#include <math.h>
+#include <assert.h>
+#include <string>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "driver/gpio.h"
+#include "sim_hal.h"
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT        0x01
+#define OUTPUT       0x03
+#define INPUT_PULLUP 0x05
+
+#define RISING  0x01
+#define FALLING 0x02
+#define CHANGE  0x03
+
+#define digitalPinToInterrupt(p) (p)
+
+#define IRAM_ATTR
+
+static inline unsigned long millis(void) { return (unsigned long)(sim_now_us() / 1000); }
+static inline unsigned long micros(void) { return (unsigned long)sim_now_us(); }
+static inline void delay(uint32_t ms) { sim_advance_us((uint64_t)ms * 1000); }
+static inline void delayMicroseconds(uint32_t us) { sim_advance_us(us); }
+
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t level);
+void attachInterruptArg(uint8_t pin, void (*handler)(void *), void *arg, int mode);
+void detachInterrupt(uint8_t pin);
+
+// The part of Arduino's String the firmware uses
+class String {
+public:
+    String() {}
+    String(const char *s) : str(s ? s : "") {}
+    const char *c_str() const { return str.c_str(); }
+    unsigned int length() const { return (unsigned int)str.size(); }
+    bool isEmpty() const { return str.empty(); }
+    bool operator==(const char *s) const { return str == s; }
+
+private:
+    std::string str;
+};
+
+class SimSerial {
+public:
+    void begin(unsigned long baud) { (void)baud; }
+    int available() { return 0; }
+    int read() { return -1; }
+
+    size_t print(const char *s) { return fputs(s, stdout) >= 0 ? strlen(s) : 0; }
+    size_t print(int v) { return printf("%d", v); }
+    size_t print(unsigned long v) { return printf("%lu", v); }
+    size_t println() { return print("\n"); }
+    size_t println(const char *s) { return print(s) + println(); }
+    size_t println(int v) { return print(v) + println(); }
+    size_t println(unsigned long v) { return print(v) + println(); }
+
+    size_t printf(const char *fmt, ...) __attribute__((format(printf, 2, 3)))
+    {
+        va_list ap;
+        va_start(ap, fmt);
+        int n = vprintf(fmt, ap);
+        va_end(ap);
+        return n < 0 ? 0 : (size_t)n;
+    }
+};
+
+extern SimSerial Serial;
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef SIM_SD_H
+#define SIM_SD_H
+
+// Host shim for the Arduino-ESP32 SD library.
+// Paths are resolved below the directory passed to sim_sd_set_root().
+
+#include <stdint.h>
+#include <stddef.h>
+#include <memory>
+#include <time.h>
+#include <Arduino.h>
+#include "SPI.h"
+
+#define FILE_READ   "r"
+#define FILE_WRITE  "w"
+#define FILE_APPEND "a"
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+struct SimFileImpl;
+
+class File {
+public:
+    File() {}
+    explicit File(std::shared_ptr<SimFileImpl> impl) : impl(impl) {}
+
+    operator bool() const;
+    const char *name() const;
+    const char *path() const;
+    bool isDirectory() const;
+    size_t size() const;
+    size_t position() const;
+    bool seek(uint32_t pos, SeekMode mode = SeekSet);
+    int available();
+    int read();
+    size_t read(uint8_t *buf, size_t len);
+    size_t readBytes(char *buf, size_t len) { return read((uint8_t *)buf, len); }
+    size_t write(uint8_t b) { return write(&b, 1); }
+    size_t write(const uint8_t *buf, size_t len);
+    void flush();
+    time_t getLastWrite();
+    File openNextFile(const char *mode = FILE_READ);
+    // Next entry's path without opening it; empty at the end
+    String getNextFileName(bool *isDir);
+    void rewindDirectory();
+    void close();
+
+private:
+    std::shared_ptr<SimFileImpl> impl;
+};
+
+class SDFS {
+public:
+    bool begin(uint8_t ssPin = 0xFF, SPIClass &spi = SPI, uint32_t frequency = 4000000,
+               const char *mountpoint = "/sd", uint8_t max_files = 5, bool format_if_empty = false);
+    bool exists(const char *path);
+    File open(const char *path, const char *mode = FILE_READ, bool create = false);
+    bool mkdir(const char *path);
+    bool remove(const char *path);
+    bool rename(const char *from, const char *to);
+};
+
+extern SDFS SD;
+
+void sim_sd_set_root(const char *host_dir);
+
+#endif
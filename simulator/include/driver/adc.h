@@ -0,0 +1,12 @@
+#ifndef SIM_DRIVER_ADC_H
+#define SIM_DRIVER_ADC_H
+
+typedef enum { ADC1_CHANNEL_0 = 0 } adc1_channel_t;
+typedef enum { ADC_WIDTH_BIT_12 = 3 } adc_bits_width_t;
+typedef enum { ADC_ATTEN_DB_11 = 3 } adc_atten_t;
+
+static inline int adc1_config_width(adc_bits_width_t w) { (void)w; return 0; }
+static inline int adc1_config_channel_atten(adc1_channel_t c, adc_atten_t a) { (void)c; (void)a; return 0; }
+static inline int adc1_get_raw(adc1_channel_t c) { (void)c; return 3000; }
+
+#endif
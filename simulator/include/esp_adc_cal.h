@@ -0,0 +1,6 @@
+#ifndef SIM_ESP_ADC_CAL_H
+#define SIM_ESP_ADC_CAL_H
+
+#include "driver/adc.h"
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef SIM_ESP_ERR_H
+#define SIM_ESP_ERR_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+typedef int esp_err_t;
+
+#define ESP_OK   0
+#define ESP_FAIL -1
+
+#define ESP_ERROR_CHECK(x) do {                                        \
+        esp_err_t err_rc_ = (x);                                       \
+        if (err_rc_ != ESP_OK) {                                       \
+            fprintf(stderr, "ESP_ERROR_CHECK failed: %s\n", #x);       \
+            abort();                                                   \
+        }                                                              \
+    } while (0)
+
+#define ESP_ERROR_CHECK_WITHOUT_ABORT(x) (x)
+
+#endif
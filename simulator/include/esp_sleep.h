@@ -0,0 +1,25 @@
+#ifndef SIM_ESP_SLEEP_H
+#define SIM_ESP_SLEEP_H
+
+#include "esp_err.h"
+#include "driver/gpio.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static inline esp_err_t esp_sleep_enable_ext0_wakeup(gpio_num_t pin, int level)
+{
+    (void)pin;
+    (void)level;
+    return ESP_OK;
+}
+
+// Deep sleep ends the simulation run.
+void esp_deep_sleep_start(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
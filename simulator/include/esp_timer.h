@@ -0,0 +1,43 @@
+#ifndef SIM_ESP_TIMER_H
+#define SIM_ESP_TIMER_H
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "sim_hal.h"
+
+typedef void (*esp_timer_cb_t)(void *arg);
+typedef struct sim_esp_timer *esp_timer_handle_t;
+
+typedef struct {
+    esp_timer_cb_t callback;
+    void *arg;
+    int dispatch_method;
+    const char *name;
+    bool skip_unhandled_events;
+} esp_timer_create_args_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static inline int64_t esp_timer_get_time(void) { return (int64_t)sim_now_us(); }
+
+// Periodic timers are not emulated, the simulator drives LVGL from its own clock.
+static inline esp_err_t esp_timer_create(const esp_timer_create_args_t *args, esp_timer_handle_t *out)
+{
+    (void)args;
+    *out = NULL;
+    return ESP_OK;
+}
+static inline esp_err_t esp_timer_start_periodic(esp_timer_handle_t t, uint64_t period_us)
+{
+    (void)t;
+    (void)period_us;
+    return ESP_OK;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,21 @@
+/**
+ * LVGL configuration for the host simulator.
+ * Options not set here keep the defaults from lv_conf_internal.h.
+ */
+
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+#define LV_COLOR_DEPTH 16
+
+/* Same tiered heap as the device (EbookReader/src/memory/tiered_heap.cpp) */
+#define LV_USE_STDLIB_MALLOC LV_STDLIB_CUSTOM
+
+#define LV_USE_OS LV_OS_NONE
+
+#define LV_FONT_MONTSERRAT_16 1
+#define LV_FONT_SOURCE_HAN_SANS_SC_16_CJK 1
+
+#define LV_USE_LOG 0
+
+#endif
@@ -0,0 +1,37 @@
+#include <stddef.h>
+#include <stdint.h>
+#include "sim_hal.h"
+
+// Counting replacements for the C allocator (glibc). operator new and LVGL
+// with LV_STDLIB_CLIB both end up here, so the count covers every heap
+// allocation the firmware makes.
+
+extern "C" void *__libc_malloc(size_t size);
+extern "C" void *__libc_calloc(size_t count, size_t size);
+extern "C" void *__libc_realloc(void *ptr, size_t size);
+extern "C" void __libc_free(void *ptr);
+
+static uint64_t alloc_count = 0;
+
+extern "C" void *malloc(size_t size) {
+    alloc_count++;
+    return __libc_malloc(size);
+}
+
+extern "C" void *calloc(size_t count, size_t size) {
+    alloc_count++;
+    return __libc_calloc(count, size);
+}
+
+extern "C" void *realloc(void *ptr, size_t size) {
+    alloc_count++;
+    return __libc_realloc(ptr, size);
+}
+
+extern "C" void free(void *ptr) {
+    __libc_free(ptr);
+}
+
+extern "C" uint64_t sim_alloc_count(void) {
+    return alloc_count;
+}
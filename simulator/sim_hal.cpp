@@ -0,0 +1,238 @@
+#include <Arduino.h>
+#include <SPI.h>
+#include "driver/spi_master.h"
+#include "esp_sleep.h"
+#include "sim_hal.h"
+#include <unistd.h>
+#include "sim_panel.h"
+
+SimSerial Serial;
+SPIClass SPI;
+
+static uint64_t now_us = 0;
+static const int MAX_PINS = 64;
+static int pin_levels[MAX_PINS];
+static bool pins_initialized = false;
+
+struct sim_pin_isr {
+    void (*handler)(void *);
+    void *arg;
+    int mode;
+};
+
+static sim_pin_isr pin_isrs[MAX_PINS];
+
+// Cost of one polling SPI transaction on top of the bit time
+static const uint64_t SPI_TRANSACTION_OVERHEAD_US = 8;
+
+struct sim_spi_device {
+    int clock_speed_hz;
+};
+
+static sim_spi_device spi_devices[4];
+static int spi_device_count = 0;
+
+static void init_pins() {
+    if (pins_initialized) return;
+    // Inputs idle high through their pull-ups
+    for (int i = 0; i < MAX_PINS; i++) pin_levels[i] = 1;
+    pins_initialized = true;
+}
+
+extern "C" uint64_t sim_now_us(void) {
+    return now_us;
+}
+
+extern "C" void sim_advance_us(uint64_t us) {
+    now_us += us;
+}
+
+static void (*exit_hook)(void) = nullptr;
+
+extern "C" void sim_set_exit_hook(void (*hook)(void)) {
+    exit_hook = hook;
+}
+
+extern "C" void sim_exit(int code) {
+    if (exit_hook) exit_hook();
+    fflush(stdout);
+    _exit(code);
+}
+
+extern "C" void sim_set_input_level(int pin, int level) {
+    init_pins();
+    if (pin < 0 || pin >= MAX_PINS) return;
+
+    int old_level = pin_levels[pin];
+    pin_levels[pin] = level ? 1 : 0;
+    if (old_level == pin_levels[pin] || !pin_isrs[pin].handler) return;
+
+    int mode = pin_isrs[pin].mode;
+    bool rising = pin_levels[pin] == 1;
+    if (mode == CHANGE || (mode == RISING && rising) || (mode == FALLING && !rising)) {
+        pin_isrs[pin].handler(pin_isrs[pin].arg);
+    }
+}
+
+// --- GPIO ---
+
+extern "C" esp_err_t gpio_config(const gpio_config_t *conf) {
+    (void)conf;
+    init_pins();
+    return ESP_OK;
+}
+
+extern "C" esp_err_t gpio_set_level(gpio_num_t pin, uint32_t level) {
+    init_pins();
+    if (pin < 0 || pin >= MAX_PINS) return ESP_FAIL;
+    pin_levels[pin] = level ? 1 : 0;
+    if (sim_panel.owns_pin(pin)) sim_panel.on_gpio(pin, pin_levels[pin]);
+    return ESP_OK;
+}
+
+extern "C" int gpio_get_level(gpio_num_t pin) {
+    init_pins();
+    if (pin < 0 || pin >= MAX_PINS) return 0;
+    if (sim_panel.is_busy_pin(pin)) return sim_panel.read_busy_level();
+    return pin_levels[pin];
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    init_pins();
+    if (pin < MAX_PINS && mode == INPUT_PULLUP) pin_levels[pin] = 1;
+}
+
+int digitalRead(uint8_t pin) {
+    return gpio_get_level((gpio_num_t)pin);
+}
+
+void digitalWrite(uint8_t pin, uint8_t level) {
+    gpio_set_level((gpio_num_t)pin, level);
+}
+
+void attachInterruptArg(uint8_t pin, void (*handler)(void *), void *arg, int mode) {
+    if (pin >= MAX_PINS) return;
+    pin_isrs[pin].handler = handler;
+    pin_isrs[pin].arg = arg;
+    pin_isrs[pin].mode = mode;
+}
+
+void detachInterrupt(uint8_t pin) {
+    if (pin < MAX_PINS) pin_isrs[pin].handler = nullptr;
+}
+
+// --- SPI ---
+
+extern "C" esp_err_t spi_bus_initialize(spi_host_device_t host, const spi_bus_config_t *cfg, int dma_chan) {
+    (void)host;
+    (void)cfg;
+    (void)dma_chan;
+    return ESP_OK;
+}
+
+extern "C" esp_err_t spi_bus_add_device(spi_host_device_t host, const spi_device_interface_config_t *cfg,
+                                        spi_device_handle_t *handle) {
+    (void)host;
+    if (spi_device_count >= 4) return ESP_FAIL;
+    spi_devices[spi_device_count].clock_speed_hz = cfg->clock_speed_hz;
+    *handle = &spi_devices[spi_device_count++];
+    return ESP_OK;
+}
+
+extern "C" esp_err_t spi_device_polling_transmit(spi_device_handle_t handle, spi_transaction_t *trans) {
+    size_t bytes = trans->length / 8;
+    if (trans->tx_buffer) sim_panel.on_spi((const uint8_t *)trans->tx_buffer, bytes);
+
+    uint64_t bit_time_us = (uint64_t)trans->length * 1000000 / (uint64_t)handle->clock_speed_hz;
+    sim_advance_us(bit_time_us + SPI_TRANSACTION_OVERHEAD_US);
+    return ESP_OK;
+}
+
+// --- FreeRTOS ---
+
+static int sim_mutex;
+
+extern "C" SemaphoreHandle_t xSemaphoreCreateMutex(void) {
+    return &sim_mutex;
+}
+
+extern "C" BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks) {
+    (void)sem;
+    (void)ticks;
+    return pdTRUE;
+}
+
+extern "C" BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) {
+    (void)sem;
+    return pdTRUE;
+}
+
+extern "C" BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack,
+                                              void *arg, UBaseType_t prio, TaskHandle_t *handle, BaseType_t core) {
+    // The simulator main loop plays the role of every task
+    (void)fn;
+    (void)stack;
+    (void)arg;
+    (void)prio;
+    (void)core;
+    if (handle) *handle = (TaskHandle_t)name;
+    return pdPASS;
+}
+
+extern "C" void vTaskDelay(TickType_t ticks) {
+    sim_advance_us((uint64_t)ticks * portTICK_PERIOD_MS * 1000);
+}
+
+extern "C" TaskHandle_t xTaskGetCurrentTaskHandle(void) {
+    return (TaskHandle_t)"main";
+}
+
+// Tasks never block in the cooperative loop: notifications are only
+// recorded, and the main loop picks them up with sim_task_take_notify()
+static const int MAX_NOTIFIED_TASKS = 8;
+static void *notified_tasks[MAX_NOTIFIED_TASKS];
+
+static void record_notify(TaskHandle_t task) {
+    for (int i = 0; i < MAX_NOTIFIED_TASKS; i++) {
+        if (notified_tasks[i] == task) return;
+    }
+    for (int i = 0; i < MAX_NOTIFIED_TASKS; i++) {
+        if (!notified_tasks[i]) {
+            notified_tasks[i] = task;
+            return;
+        }
+    }
+}
+
+extern "C" bool sim_task_take_notify(void *task) {
+    for (int i = 0; i < MAX_NOTIFIED_TASKS; i++) {
+        if (notified_tasks[i] == task) {
+            notified_tasks[i] = nullptr;
+            return true;
+        }
+    }
+    return false;
+}
+
+extern "C" BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+    record_notify(task);
+    return pdPASS;
+}
+
+extern "C" void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higher_prio_woken) {
+    record_notify(task);
+    if (higher_prio_woken) *higher_prio_woken = pdFALSE;
+}
+
+extern "C" uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t wait_ticks) {
+    (void)clear_on_exit;
+    (void)wait_ticks;
+    return 0;
+}
+
+// --- Sleep ---
+
+extern "C" void esp_deep_sleep_start(void) {
+    printf("Deep sleep requested at %.3f s, ending simulation\n", sim_now_us() / 1000000.0);
+    sim_exit(0);
+}
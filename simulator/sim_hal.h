@@ -0,0 +1,37 @@
+#ifndef SIM_HAL_H
+#define SIM_HAL_H
+
+// Simulated clock and pin state shared by the host shims.
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Simulated time since boot, in microseconds. Only moves when advanced.
+uint64_t sim_now_us(void);
+void sim_advance_us(uint64_t us);
+
+// Drive an input pin from the outside world (buttons).
+// Runs the pin's interrupt handler in place when the level changes.
+void sim_set_input_level(int pin, int level);
+
+// Consumes a task notification given to `task` (xTaskNotifyGive and
+// friends). The main loop uses it to wake the task it stands in for.
+bool sim_task_take_notify(void *task);
+
+// Number of malloc/calloc/realloc calls (and so operator new) so far.
+uint64_t sim_alloc_count(void);
+
+// End the run. Firmware globals are never destroyed on the device,
+// so the process exits without running static destructors.
+void sim_set_exit_hook(void (*hook)(void));
+void sim_exit(int code);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,130 @@
+#include <Arduino.h>
+#include "lvgl.h"
+#include "user_app.h"
+#include "user_config.h"
+#include "telemetry.h"
+#include "button_input.h"
+#include "src/memory/tiered_heap.h"
+#include "sim_lvgl_port.h"
+
+#define BYTES_PER_PIXEL (LV_COLOR_FORMAT_GET_SIZE(LV_COLOR_FORMAT_RGB565))
+#define BUFF_SIZE (EPD_WIDTH * EXAMPLE_LVGL_BAND_LINES * BYTES_PER_PIXEL)
+
+static uint32_t flush_us_total = 0;
+static bool wake_pending = false;
+static uint32_t wakeups = 0;
+static uint64_t app_allocs = 0;
+
+// LVGL allocates from the tiered heap, everything else from the C heap
+static uint64_t heap_allocs(void)
+{
+    return sim_alloc_count() + tiered_heap.alloc_count();
+}
+
+// Same band gathering as example_lvgl_flush_cb() on the device
+static void sim_lvgl_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *color_p)
+{
+    if (!driver) {
+        lv_display_flush_ready(disp);
+        return;
+    }
+
+    unsigned long flush_start = micros();
+
+    uint16_t *buffer = (uint16_t *)color_p;
+    for (int y = area->y1; y <= area->y2; y++) {
+        for (int x = area->x1; x <= area->x2; x++) {
+            uint8_t color = (*buffer < 0x7fff) ? DRIVER_COLOR_BLACK : DRIVER_COLOR_WHITE;
+            driver->EPD_DrawColorPixel(x, y, color);
+            buffer++;
+        }
+    }
+
+    flush_us_total += micros() - flush_start;
+
+    if (!lv_display_flush_is_last(disp)) {
+        lv_display_flush_ready(disp);
+        return;
+    }
+
+    telemetry.record_render_end(flush_us_total);
+    telemetry.record(TM_FLUSH, flush_us_total);
+    flush_us_total = 0;
+
+    driver->EPD_DisplayPart();
+    telemetry.record(TM_SPI, driver->get_last_transfer_us());
+    telemetry.record(TM_BUSY, driver->get_last_busy_us());
+    telemetry.end_page_turn();
+    lv_display_flush_ready(disp);
+}
+
+static void sim_lvgl_render_start_cb(lv_event_t *e)
+{
+    telemetry.mark_render_start();
+}
+
+static void sim_lvgl_invalidate_cb(lv_event_t *e)
+{
+    lvgl_port_wake();
+}
+
+// Stands in for the task notification on the device
+void lvgl_port_wake(void)
+{
+    wake_pending = true;
+}
+
+static uint32_t sim_lvgl_tick_get(void)
+{
+    return millis();
+}
+
+void sim_lvgl_port_init(void)
+{
+    lv_init();
+    lv_tick_set_cb(sim_lvgl_tick_get);
+
+    lv_display_t *disp = lv_display_create(EPD_WIDTH, EPD_HEIGHT);
+    lv_display_set_flush_cb(disp, sim_lvgl_flush_cb);
+    lv_display_add_event_cb(disp, sim_lvgl_render_start_cb, LV_EVENT_RENDER_START, NULL);
+    lv_display_add_event_cb(disp, sim_lvgl_invalidate_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+
+    uint8_t *buffer_1 = (uint8_t *)heap_caps_malloc(BUFF_SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    uint8_t *buffer_2 = (uint8_t *)heap_caps_malloc(BUFF_SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    assert(buffer_1 && buffer_2);
+    lv_display_set_buffers(disp, buffer_1, buffer_2, BUFF_SIZE, LV_DISPLAY_RENDER_MODE_PARTIAL);
+
+    user_ui_init();
+}
+
+uint32_t sim_lvgl_port_run(void)
+{
+    wakeups++;
+    wake_pending = false;
+    uint64_t allocs_before = heap_allocs();
+    user_ui_drain();
+    button_input.lvgl_read();
+    app_allocs += heap_allocs() - allocs_before;
+
+    uint32_t task_delay_ms = lv_timer_handler();
+    if (task_delay_ms == LV_NO_TIMER_READY) return task_delay_ms;
+    if (task_delay_ms < EXAMPLE_LVGL_TASK_MIN_DELAY_MS) task_delay_ms = EXAMPLE_LVGL_TASK_MIN_DELAY_MS;
+    return task_delay_ms;
+}
+
+bool sim_lvgl_port_take_wake(void)
+{
+    bool pending = wake_pending;
+    wake_pending = false;
+    return pending;
+}
+
+uint32_t sim_lvgl_port_wakeups(void)
+{
+    return wakeups;
+}
+
+uint64_t sim_lvgl_port_app_allocs(void)
+{
+    return app_allocs;
+}
@@ -0,0 +1,24 @@
+#ifndef SIM_LVGL_PORT_H
+#define SIM_LVGL_PORT_H
+
+#include <stdint.h>
+
+// Host counterpart of lvgl_port() in EbookReader.ino: same display
+// setup and flush path, but driven by the simulated clock.
+void sim_lvgl_port_init(void);
+
+// One iteration of the LVGL task. Returns the delay before the next one,
+// in ms, or LV_NO_TIMER_READY to wait for lvgl_port_wake().
+uint32_t sim_lvgl_port_run(void);
+
+// Consumes a pending lvgl_port_wake() notification
+bool sim_lvgl_port_take_wake(void);
+
+// Number of LVGL task iterations so far
+uint32_t sim_lvgl_port_wakeups(void);
+
+// Heap allocations made while running UI commands (app code), as
+// opposed to LVGL rendering
+uint64_t sim_lvgl_port_app_allocs(void);
+
+#endif
@@ -0,0 +1,281 @@
+// Host entry point: runs the unmodified apps against the simulated
+// panel, buttons and SD card, and reports refresh statistics.
+//
+//   ebook_sim --sd ./sdcard --frames ./frames --script "P P 5*b p B p P"
+//
+// --trace FILE writes the panel trace ring at the end of the run, in the
+// same format as the 't' serial command on the device.
+//
+// Script tokens (separated by spaces or commas):
+//   b / B   BOOT short / long press
+//   p / P   PWR short / long press
+//   wN      wait N ms
+//   s       start measuring: clear the per-action statistics so far
+//   N*tok   repeat a token N times
+//
+// --zero-alloc ACTIONS fails the run (exit status 1) if app code allocated
+// from the heap while handling any of the listed press kinds, e.g.
+//   --script "w3000 p w1500 P w2000 s 10000*b" --zero-alloc b
+//
+// --no-glyph-cache draws straight from the fonts, to compare the render
+// stage with and without the glyph cache on the same script.
+
+#include <Arduino.h>
+#include <SD.h>
+#include <string>
+#include <vector>
+#include "user_app.h"
+#include "user_config.h"
+#include "sim_hal.h"
+#include "sim_panel.h"
+#include "sim_lvgl_port.h"
+#include "src/display/epd_trace.h"
+#include "src/memory/tiered_heap.h"
+#include "src/font/glyph_cache.h"
+#include "src/font/sd_font.h"
+#include "app_manager.h"
+#include "telemetry.h"
+
+static const uint32_t SHORT_PRESS_MS = 100;
+static const uint32_t LONG_PRESS_MS = 1000;
+static const uint32_t PRESS_GAP_MS = 500;
+static const uint32_t BOOT_SETTLE_MS = 1000;
+
+struct InputEvent {
+    uint64_t at_us;
+    int pin;
+    int level;
+    char action;  // Token the edge belongs to
+};
+
+struct ActionStats {
+    char action;
+    uint32_t count;
+    uint32_t refreshed;
+    uint64_t total_us;
+    uint64_t max_us;
+    uint64_t allocs;  // Heap allocations by app code while handling these presses
+};
+
+static std::vector<InputEvent> events;
+static std::vector<ActionStats> action_stats;
+static FILE *trace_file = nullptr;
+static uint64_t loop_allocs = 0;  // Heap allocations inside reader_loop_handle()
+
+static void add_press(uint64_t &t, int pin, uint32_t hold_ms, char action) {
+    events.push_back({t, pin, 0, action});
+    t += (uint64_t)hold_ms * 1000;
+    events.push_back({t, pin, 1, action});
+    t += (uint64_t)PRESS_GAP_MS * 1000;
+}
+
+static bool parse_token(const std::string &tok, uint64_t &t) {
+    size_t star = tok.find('*');
+    if (star != std::string::npos) {
+        int repeat = atoi(tok.substr(0, star).c_str());
+        std::string inner = tok.substr(star + 1);
+        for (int i = 0; i < repeat; i++) {
+            if (!parse_token(inner, t)) return false;
+        }
+        return true;
+    }
+
+    if (tok == "b") add_press(t, BOOT_BUTTON_PIN, SHORT_PRESS_MS, 'b');
+    else if (tok == "B") add_press(t, BOOT_BUTTON_PIN, LONG_PRESS_MS, 'B');
+    else if (tok == "p") add_press(t, PWR_BUTTON_PIN, SHORT_PRESS_MS, 'p');
+    else if (tok == "P") add_press(t, PWR_BUTTON_PIN, LONG_PRESS_MS, 'P');
+    else if (tok == "s") events.push_back({t, -1, 1, 's'});
+    else if (tok.size() > 1 && tok[0] == 'w') t += (uint64_t)atoi(tok.c_str() + 1) * 1000;
+    else return false;
+    return true;
+}
+
+static bool parse_script(const char *script, uint64_t start_us, uint64_t &end_us) {
+    uint64_t t = start_us;
+    std::string tok;
+    for (const char *p = script;; p++) {
+        if (*p == '\0' || *p == ' ' || *p == ',') {
+            if (!tok.empty() && !parse_token(tok, t)) {
+                fprintf(stderr, "Bad script token: %s\n", tok.c_str());
+                return false;
+            }
+            tok.clear();
+            if (*p == '\0') break;
+        } else {
+            tok += *p;
+        }
+    }
+    end_us = t;
+    return true;
+}
+
+static ActionStats &stats_for(char action) {
+    for (auto &s : action_stats) {
+        if (s.action == action) return s;
+    }
+    action_stats.push_back({action, 0, 0, 0, 0, 0});
+    return action_stats.back();
+}
+
+static void print_summary_line(const char *line) {
+    printf("%s\n", line);
+}
+
+static void write_trace_line(const char *line) {
+    fprintf(trace_file, "%s\n", line);
+}
+
+static void print_summary() {
+    if (trace_file) {
+        epd_trace.dump(write_trace_line);
+        fclose(trace_file);
+        trace_file = nullptr;
+    }
+
+    printf("\n=== Simulation summary (%.3f s simulated) ===\n", sim_now_us() / 1000000.0);
+    sim_panel.print_summary(stdout);
+    printf("LVGL task: %u wakeups\n", (unsigned)sim_lvgl_port_wakeups());
+    for (const auto &s : action_stats) {
+        printf("Action '%c': %u presses, %u refreshed, latency avg %.1f ms, max %.1f ms, %llu allocs\n",
+               s.action, (unsigned)s.count, (unsigned)s.refreshed,
+               s.refreshed ? s.total_us / 1000.0 / s.refreshed : 0.0, s.max_us / 1000.0,
+               (unsigned long long)s.allocs);
+    }
+    if (telemetry.get_count(TM_PAGE_TURN) > 0) {
+        telemetry.print_report();
+    }
+    tiered_heap.dump(print_summary_line);
+    sd_font.dump(print_summary_line);
+    glyph_cache.dump(print_summary_line);
+    app_manager.dump_memory(print_summary_line);
+}
+
+static void usage(const char *argv0) {
+    fprintf(stderr, "Usage: %s [--sd DIR] [--frames DIR] [--frame-us N] [--trace FILE] [--script TOKENS]\n"
+                    "       [--zero-alloc ACTIONS] [--no-glyph-cache]\n",
+            argv0);
+}
+
+int main(int argc, char **argv) {
+    const char *sd_dir = ".";
+    const char *frame_dir = nullptr;
+    const char *script = "";
+    const char *zero_alloc = "";
+    uint32_t frame_us = 20000;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--sd") == 0 && i + 1 < argc) sd_dir = argv[++i];
+        else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) frame_dir = argv[++i];
+        else if (strcmp(argv[i], "--frame-us") == 0 && i + 1 < argc) frame_us = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--script") == 0 && i + 1 < argc) script = argv[++i];
+        else if (strcmp(argv[i], "--zero-alloc") == 0 && i + 1 < argc) zero_alloc = argv[++i];
+        else if (strcmp(argv[i], "--no-glyph-cache") == 0) glyph_cache_t::set_enabled(false);
+        else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            trace_file = fopen(argv[++i], "w");
+            if (!trace_file) {
+                perror(argv[i]);
+                return 1;
+            }
+        }
+        else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    sim_sd_set_root(sd_dir);
+    SimPanelPins pins = {EPD_CS_PIN, EPD_DC_PIN, EPD_RST_PIN, EPD_BUSY_PIN};
+    sim_panel.configure(EPD_WIDTH, EPD_HEIGHT, pins);
+    sim_panel.set_frame_us(frame_us);
+    if (frame_dir) sim_panel.set_frame_dir(frame_dir);
+    sim_set_exit_hook(print_summary);
+
+    // setup()
+    user_app_init();
+    sim_lvgl_port_init();
+
+    uint64_t script_end_us = 0;
+    uint64_t script_start_us = sim_now_us() + (uint64_t)BOOT_SETTLE_MS * 1000;
+    if (!parse_script(script, script_start_us, script_end_us)) return 1;
+    uint64_t end_us = script_end_us + 3000000ULL;
+
+    // setup() and loop() share the Arduino loop task
+    TaskHandle_t loop_task = xTaskGetCurrentTaskHandle();
+    uint64_t next_loop_us = sim_now_us();
+    uint64_t next_lvgl_us = sim_now_us();
+    size_t next_event = 0;
+    char pending_action = 0;
+    uint64_t pending_since_us = 0;
+    uint64_t pending_allocs = 0;
+    uint32_t refreshes_seen = sim_panel.get_refresh_count();
+
+    while (sim_now_us() < end_us) {
+        // Cooperative stand-in for the Arduino loop task and the LVGL task
+        uint64_t next_us = next_loop_us < next_lvgl_us ? next_loop_us : next_lvgl_us;
+        if (next_event < events.size() && events[next_event].at_us < next_us) next_us = events[next_event].at_us;
+        if (next_us > sim_now_us()) sim_advance_us(next_us - sim_now_us());
+
+        while (next_event < events.size() && events[next_event].at_us <= sim_now_us()) {
+            const InputEvent &ev = events[next_event++];
+            if (ev.pin < 0) {
+                action_stats.clear();
+                pending_action = 0;
+                continue;
+            }
+            sim_set_input_level(ev.pin, ev.level);
+            // Short presses act on release, long ones while still held:
+            // latency runs from the last edge before the refresh, and a
+            // release after an already refreshed press starts nothing
+            if (ev.level == 0) {
+                stats_for(ev.action).count++;
+                pending_action = ev.action;
+                pending_since_us = ev.at_us;
+                pending_allocs = loop_allocs + sim_lvgl_port_app_allocs();
+            } else if (pending_action == ev.action) {
+                pending_since_us = ev.at_us;
+            }
+        }
+
+        // The loop task blocks until a button interrupt or its own deadline
+        if (sim_task_take_notify(loop_task)) next_loop_us = sim_now_us();
+        if (next_loop_us <= sim_now_us()) {
+            uint64_t allocs_before = sim_alloc_count();
+            uint32_t wait_ms = reader_loop_handle();
+            loop_allocs += sim_alloc_count() - allocs_before;
+            next_loop_us = sim_now_us() + (uint64_t)wait_ms * 1000;
+        }
+        if (sim_lvgl_port_take_wake()) next_lvgl_us = sim_now_us();
+        if (next_lvgl_us <= sim_now_us()) {
+            uint32_t delay_ms = sim_lvgl_port_run();
+            next_lvgl_us = delay_ms == LV_NO_TIMER_READY ? UINT64_MAX
+                                                         : sim_now_us() + (uint64_t)delay_ms * 1000;
+        }
+
+        if (sim_panel.get_refresh_count() != refreshes_seen) {
+            refreshes_seen = sim_panel.get_refresh_count();
+            if (pending_action) {
+                // Latency runs from the release edge to the end of the panel BUSY period
+                ActionStats &s = stats_for(pending_action);
+                uint64_t latency = sim_panel.get_last_refresh_end_us() - pending_since_us;
+                s.refreshed++;
+                s.total_us += latency;
+                s.allocs += loop_allocs + sim_lvgl_port_app_allocs() - pending_allocs;
+                if (latency > s.max_us) s.max_us = latency;
+                pending_action = 0;
+            }
+        }
+    }
+
+    // Fail the run if any of the listed actions touched the heap
+    int status = 0;
+    for (const char *a = zero_alloc; *a; a++) {
+        for (const auto &s : action_stats) {
+            if (s.action == *a && s.allocs > 0) status = 1;
+        }
+    }
+    print_summary();
+    if (*zero_alloc) printf("Zero-allocation check (%s): %s\n", zero_alloc, status ? "FAILED" : "passed");
+    sim_set_exit_hook(nullptr);
+    sim_exit(status);
+    return status;
+}
@@ -0,0 +1,305 @@
+#include "sim_panel.h"
+#include "sim_hal.h"
+#include <string.h>
+
+SimPanel sim_panel;
+
+// Fixed costs of the controller phases, in microseconds
+static const uint64_t RESET_BUSY_US = 2000;
+static const uint64_t SWRESET_BUSY_US = 10000;
+static const uint64_t ANALOG_ON_US = 30000;
+static const uint64_t ANALOG_OFF_US = 10000;
+static const uint64_t LOAD_TEMP_US = 5000;
+static const uint64_t LOAD_LUT_US = 5000;
+// Duration of a refresh driven by the OTP waveform (no custom LUT loaded)
+static const uint64_t OTP_REFRESH_US = 2000000;
+
+uint32_t sim_crc32(const uint8_t *data, size_t len)
+{
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (int b = 0; b < 8; b++) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+SimPanel::SimPanel() : width(200), height(200), dc_level(1), cs_level(1), frame_us(20000),
+                       lut_len(0), lut_crc(0), busy_until_us(0),
+                       refresh_count(0), full_refresh_count(0), partial_refresh_count(0),
+                       total_busy_us(0), command_bytes(0), data_bytes(0), waveform_count(0) {
+    pins.cs = pins.dc = pins.rst = pins.busy = -1;
+    frame_dir[0] = '\0';
+    memset(ram_bw, 0xFF, sizeof(ram_bw));
+    memset(ram_red, 0xFF, sizeof(ram_red));
+    memset(frame, 0xFF, sizeof(frame));
+    memset(waveforms, 0, sizeof(waveforms));
+    memset(lut, 0, sizeof(lut));
+    reset_registers();
+}
+
+void SimPanel::configure(int w, int h, const SimPanelPins &p) {
+    width = w;
+    height = h;
+    pins = p;
+    reset_registers();
+}
+
+void SimPanel::set_frame_dir(const char *dir) {
+    strncpy(frame_dir, dir ? dir : "", sizeof(frame_dir) - 1);
+    frame_dir[sizeof(frame_dir) - 1] = '\0';
+}
+
+void SimPanel::reset_registers() {
+    command = 0;
+    param_index = 0;
+    entry_mode = 0x03;
+    gate_reverse = false;
+    x_start = 0;
+    x_end = (width / 8) - 1;
+    y_start = 0;
+    y_end = height - 1;
+    x_counter = 0;
+    y_counter = 0;
+    update_control = 0xFF;
+}
+
+bool SimPanel::owns_pin(int pin) const {
+    return pin == pins.cs || pin == pins.dc || pin == pins.rst || pin == pins.busy;
+}
+
+void SimPanel::on_gpio(int pin, int level) {
+    if (pin == pins.dc) {
+        dc_level = level;
+    } else if (pin == pins.cs) {
+        cs_level = level;
+    } else if (pin == pins.rst) {
+        if (level == 0) {
+            reset_registers();
+        } else {
+            busy_until_us = sim_now_us() + RESET_BUSY_US;
+        }
+    }
+}
+
+int SimPanel::read_busy_level() const {
+    return sim_now_us() < busy_until_us ? 1 : 0;
+}
+
+void SimPanel::on_spi(const uint8_t *data, size_t len) {
+    if (cs_level != 0) return;
+
+    for (size_t i = 0; i < len; i++) {
+        if (dc_level == 0) {
+            command_bytes++;
+            on_command(data[i]);
+        } else {
+            data_bytes++;
+            on_data(data[i]);
+        }
+    }
+}
+
+void SimPanel::on_command(uint8_t cmd) {
+    command = cmd;
+    param_index = 0;
+
+    switch (cmd) {
+    case 0x12: // SWRESET
+        reset_registers();
+        busy_until_us = sim_now_us() + SWRESET_BUSY_US;
+        break;
+    case 0x32: // Write LUT register
+        lut_len = 0;
+        break;
+    case 0x20: // Master activation
+        activate();
+        break;
+    default:
+        break;
+    }
+}
+
+void SimPanel::on_data(uint8_t value) {
+    if (param_index < (int)sizeof(params)) {
+        params[param_index] = value;
+    }
+    param_index++;
+
+    switch (command) {
+    case 0x01: // Driver output control: TB is bit 0 of the third byte
+        if (param_index == 3) gate_reverse = (value & 0x01) != 0;
+        break;
+    case 0x11: // Data entry mode
+        entry_mode = value & 0x07;
+        break;
+    case 0x44: // RAM X window, in bytes
+        if (param_index == 1) x_start = value;
+        if (param_index == 2) x_end = value;
+        break;
+    case 0x45: // RAM Y window
+        if (param_index == 2) y_start = params[0] | (params[1] << 8);
+        if (param_index == 4) y_end = params[2] | (params[3] << 8);
+        break;
+    case 0x4E: // RAM X counter
+        x_counter = value;
+        break;
+    case 0x4F: // RAM Y counter
+        if (param_index == 2) y_counter = params[0] | (params[1] << 8);
+        break;
+    case 0x22: // Display update control 2
+        update_control = value;
+        break;
+    case 0x24: // Write B/W RAM
+        write_ram(ram_bw, value);
+        break;
+    case 0x26: // Write RED RAM (previous image for partial refresh)
+        write_ram(ram_red, value);
+        break;
+    case 0x32:
+        if (lut_len < LUT_LEN) {
+            lut[lut_len++] = value;
+            if (lut_len == LUT_LEN) lut_crc = sim_crc32(lut, LUT_LEN);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void SimPanel::write_ram(uint8_t *ram, uint8_t value) {
+    int bytes_per_row = width / 8;
+    if (x_counter >= 0 && x_counter < bytes_per_row && y_counter >= 0 && y_counter < height) {
+        ram[y_counter * bytes_per_row + x_counter] = value;
+    }
+
+    int x_step = (entry_mode & 0x01) ? 1 : -1;
+    int y_step = (entry_mode & 0x02) ? 1 : -1;
+    int x_lo = x_start < x_end ? x_start : x_end;
+    int x_hi = x_start < x_end ? x_end : x_start;
+    int y_lo = y_start < y_end ? y_start : y_end;
+    int y_hi = y_start < y_end ? y_end : y_start;
+
+    if ((entry_mode & 0x04) == 0) {
+        // Address counter moves along X first
+        x_counter += x_step;
+        if (x_counter < x_lo || x_counter > x_hi) {
+            x_counter = x_step > 0 ? x_lo : x_hi;
+            y_counter += y_step;
+            if (y_counter < y_lo || y_counter > y_hi) y_counter = y_step > 0 ? y_lo : y_hi;
+        }
+    } else {
+        y_counter += y_step;
+        if (y_counter < y_lo || y_counter > y_hi) {
+            y_counter = y_step > 0 ? y_lo : y_hi;
+            x_counter += x_step;
+            if (x_counter < x_lo || x_counter > x_hi) x_counter = x_step > 0 ? x_lo : x_hi;
+        }
+    }
+}
+
+uint32_t SimPanel::lut_frames() const {
+    // 12 groups of 7 timing bytes follow the 60 voltage bytes:
+    // TP[nA], TP[nB], SR[nAB], TP[nC], TP[nD], SR[nCD], RP[n]
+    uint32_t frames = 0;
+    for (int g = 0; g < 12; g++) {
+        const uint8_t *t = &lut[60 + g * 7];
+        uint32_t ab = (uint32_t)(t[0] + t[1]) * (t[2] + 1);
+        uint32_t cd = (uint32_t)(t[3] + t[4]) * (t[5] + 1);
+        frames += (ab + cd) * (t[6] + 1);
+    }
+    return frames;
+}
+
+void SimPanel::activate() {
+    uint64_t now = sim_now_us();
+    uint64_t start = busy_until_us > now ? busy_until_us : now;
+    uint64_t duration = 0;
+
+    if (update_control & 0x40) duration += ANALOG_ON_US;
+    if (update_control & 0x20) duration += LOAD_TEMP_US;
+    if (update_control & 0x10) {
+        // Waveform reloaded from OTP
+        duration += LOAD_LUT_US;
+        lut_len = 0;
+        lut_crc = 0;
+    }
+    if (update_control & 0x04) {
+        uint64_t refresh_us = (lut_len == LUT_LEN) ? (uint64_t)lut_frames() * frame_us : OTP_REFRESH_US;
+        duration += refresh_us;
+
+        refresh_count++;
+        if (update_control & 0x08) {
+            partial_refresh_count++;
+        } else {
+            full_refresh_count++;
+        }
+        account_waveform(refresh_us);
+        commit_frame();
+        // Mode 2 compares against the previous image, which now becomes the shown one
+        if (update_control & 0x08) memcpy(ram_red, ram_bw, sizeof(ram_red));
+    }
+    if (update_control & 0x02) duration += ANALOG_OFF_US;
+
+    busy_until_us = start + duration;
+    total_busy_us += duration;
+}
+
+void SimPanel::account_waveform(uint64_t busy_us) {
+    uint32_t crc = (lut_len == LUT_LEN) ? lut_crc : 0;
+    for (int i = 0; i < waveform_count; i++) {
+        if (waveforms[i].lut_crc == crc) {
+            waveforms[i].refreshes++;
+            waveforms[i].busy_us += busy_us;
+            return;
+        }
+    }
+    if (waveform_count < MAX_WAVEFORMS) {
+        waveforms[waveform_count].lut_crc = crc;
+        waveforms[waveform_count].refreshes = 1;
+        waveforms[waveform_count].busy_us = busy_us;
+        waveform_count++;
+    }
+}
+
+void SimPanel::commit_frame() {
+    int bytes_per_row = width / 8;
+    for (int row = 0; row < height; row++) {
+        // TB=1 scans the gates from G199 down to G0
+        int ram_row = gate_reverse ? (height - 1 - row) : row;
+        memcpy(&frame[row * bytes_per_row], &ram_bw[ram_row * bytes_per_row], bytes_per_row);
+    }
+    dump_frame();
+}
+
+void SimPanel::dump_frame() {
+    if (frame_dir[0] == '\0') return;
+
+    char path[320];
+    snprintf(path, sizeof(path), "%s/frame_%04u.pbm", frame_dir, (unsigned)refresh_count);
+    FILE *f = fopen(path, "wb");
+    if (!f) return;
+
+    int bytes_per_row = width / 8;
+    fprintf(f, "P4\n%d %d\n", width, height);
+    for (int i = 0; i < bytes_per_row * height; i++) {
+        // PBM uses 1 for black, the controller RAM uses 1 for white
+        fputc((uint8_t)~frame[i], f);
+    }
+    fclose(f);
+}
+
+void SimPanel::print_summary(FILE *out) const {
+    fprintf(out, "Panel: %u refreshes (%u full, %u partial), busy %.1f ms\n",
+            (unsigned)refresh_count, (unsigned)full_refresh_count, (unsigned)partial_refresh_count,
+            total_busy_us / 1000.0);
+    fprintf(out, "Panel: %llu command bytes, %llu data bytes\n",
+            (unsigned long long)command_bytes, (unsigned long long)data_bytes);
+    for (int i = 0; i < waveform_count; i++) {
+        fprintf(out, "  LUT %08x: %u refreshes, %.1f ms each\n",
+                (unsigned)waveforms[i].lut_crc, (unsigned)waveforms[i].refreshes,
+                waveforms[i].busy_us / 1000.0 / waveforms[i].refreshes);
+    }
+}
@@ -0,0 +1,116 @@
+#ifndef SIM_PANEL_H
+#define SIM_PANEL_H
+
+// Behavioural model of the SSD1681 controller on the 1.54" panel.
+// It decodes the command stream sent by epaper_driver_display, keeps
+// the controller RAM, and turns each master activation into a BUSY
+// period whose length is derived from the loaded waveform LUT.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+
+struct SimPanelPins {
+    int cs;
+    int dc;
+    int rst;
+    int busy;
+};
+
+struct SimWaveformStats {
+    uint32_t lut_crc;
+    uint32_t refreshes;
+    uint64_t busy_us;
+};
+
+class SimPanel {
+public:
+    static const int MAX_WAVEFORMS = 8;
+
+    SimPanel();
+
+    void configure(int width, int height, const SimPanelPins &pins);
+    void set_frame_dir(const char *dir);
+
+    // Frame period used to turn LUT frame counts into time.
+    void set_frame_us(uint32_t us) { frame_us = us; }
+
+    void on_gpio(int pin, int level);
+    bool owns_pin(int pin) const;
+    bool is_busy_pin(int pin) const { return pin == pins.busy; }
+    int read_busy_level() const;
+    void on_spi(const uint8_t *data, size_t len);
+
+    // Statistics
+    uint32_t get_refresh_count() const { return refresh_count; }
+    uint32_t get_full_refresh_count() const { return full_refresh_count; }
+    uint32_t get_partial_refresh_count() const { return partial_refresh_count; }
+    uint64_t get_busy_us() const { return total_busy_us; }
+    uint64_t get_command_bytes() const { return command_bytes; }
+    uint64_t get_data_bytes() const { return data_bytes; }
+    uint64_t get_last_refresh_end_us() const { return busy_until_us; }
+    int get_waveform_count() const { return waveform_count; }
+    const SimWaveformStats &get_waveform(int i) const { return waveforms[i]; }
+    uint32_t get_lut_crc() const { return lut_crc; }
+    uint8_t get_update_control() const { return update_control; }
+
+    // Last committed frame, 1 bit per pixel, MSB first, 1 = white.
+    const uint8_t *get_frame() const { return frame; }
+
+    void print_summary(FILE *out) const;
+
+private:
+    static const int RAM_BYTES = 5000;
+    static const int LUT_LEN = 153;
+
+    int width;
+    int height;
+    SimPanelPins pins;
+    int dc_level;
+    int cs_level;
+    char frame_dir[256];
+    uint32_t frame_us;
+
+    // Controller registers
+    uint8_t command;
+    int param_index;
+    uint8_t params[16];
+    uint8_t entry_mode;
+    bool gate_reverse;
+    int x_start, x_end, y_start, y_end;
+    int x_counter, y_counter;
+    uint8_t update_control;
+    uint8_t lut[LUT_LEN];
+    int lut_len;
+    uint32_t lut_crc;
+    uint64_t busy_until_us;
+
+    uint8_t ram_bw[RAM_BYTES];
+    uint8_t ram_red[RAM_BYTES];
+    uint8_t frame[RAM_BYTES];
+
+    uint32_t refresh_count;
+    uint32_t full_refresh_count;
+    uint32_t partial_refresh_count;
+    uint64_t total_busy_us;
+    uint64_t command_bytes;
+    uint64_t data_bytes;
+    SimWaveformStats waveforms[MAX_WAVEFORMS];
+    int waveform_count;
+
+    void reset_registers();
+    void on_command(uint8_t cmd);
+    void on_data(uint8_t value);
+    void write_ram(uint8_t *ram, uint8_t value);
+    void activate();
+    uint32_t lut_frames() const;
+    void account_waveform(uint64_t busy_us);
+    void commit_frame();
+    void dump_frame();
+};
+
+extern SimPanel sim_panel;
+
+uint32_t sim_crc32(const uint8_t *data, size_t len);
+
+#endif
@@ -0,0 +1,205 @@
+#include <SD.h>
+#include <stdio.h>
+#include <string.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <string>
+
+SDFS SD;
+
+static std::string sd_root = ".";
+
+struct SimFileImpl {
+    std::string path;       // Path as seen by the firmware
+    std::string host_path;  // Path on the host
+    std::string name;
+    FILE *fp;
+    DIR *dir;
+
+    SimFileImpl() : fp(nullptr), dir(nullptr) {}
+    ~SimFileImpl() {
+        if (fp) fclose(fp);
+        if (dir) closedir(dir);
+    }
+};
+
+void sim_sd_set_root(const char *host_dir) {
+    sd_root = host_dir ? host_dir : ".";
+    while (sd_root.size() > 1 && sd_root.back() == '/') sd_root.pop_back();
+}
+
+static std::string host_path(const char *path) {
+    std::string p = path ? path : "/";
+    if (p.empty() || p[0] != '/') p = "/" + p;
+    return sd_root + p;
+}
+
+static std::shared_ptr<SimFileImpl> open_impl(const char *path, const char *mode) {
+    std::string hp = host_path(path);
+    struct stat st;
+    bool exists = stat(hp.c_str(), &st) == 0;
+
+    auto impl = std::make_shared<SimFileImpl>();
+    impl->path = path;
+    impl->host_path = hp;
+    const char *slash = strrchr(path, '/');
+    impl->name = slash ? slash + 1 : path;
+
+    if (exists && S_ISDIR(st.st_mode)) {
+        impl->dir = opendir(hp.c_str());
+        if (!impl->dir) return nullptr;
+        return impl;
+    }
+
+    const char *host_mode = "rb";
+    if (strcmp(mode, FILE_WRITE) == 0) host_mode = "w+b";
+    else if (strcmp(mode, "r+") == 0) host_mode = "r+b";
+    else if (strcmp(mode, FILE_APPEND) == 0) host_mode = "a+b";
+    if (!exists && host_mode[0] == 'r') return nullptr;
+
+    impl->fp = fopen(hp.c_str(), host_mode);
+    if (!impl->fp) return nullptr;
+    return impl;
+}
+
+// --- File ---
+
+File::operator bool() const {
+    return impl && (impl->fp || impl->dir);
+}
+
+const char *File::name() const {
+    return impl ? impl->name.c_str() : "";
+}
+
+const char *File::path() const {
+    return impl ? impl->path.c_str() : "";
+}
+
+bool File::isDirectory() const {
+    return impl && impl->dir;
+}
+
+size_t File::size() const {
+    if (!impl || !impl->fp) return 0;
+    long pos = ftell(impl->fp);
+    fseek(impl->fp, 0, SEEK_END);
+    long end = ftell(impl->fp);
+    fseek(impl->fp, pos, SEEK_SET);
+    return end < 0 ? 0 : (size_t)end;
+}
+
+size_t File::position() const {
+    if (!impl || !impl->fp) return 0;
+    long pos = ftell(impl->fp);
+    return pos < 0 ? 0 : (size_t)pos;
+}
+
+bool File::seek(uint32_t pos, SeekMode mode) {
+    if (!impl || !impl->fp) return false;
+    int whence = mode == SeekCur ? SEEK_CUR : (mode == SeekEnd ? SEEK_END : SEEK_SET);
+    return fseek(impl->fp, (long)pos, whence) == 0;
+}
+
+int File::available() {
+    if (!impl || !impl->fp) return 0;
+    return (int)(size() - position());
+}
+
+int File::read() {
+    uint8_t b;
+    return read(&b, 1) == 1 ? b : -1;
+}
+
+size_t File::read(uint8_t *buf, size_t len) {
+    if (!impl || !impl->fp) return 0;
+    return fread(buf, 1, len, impl->fp);
+}
+
+size_t File::write(const uint8_t *buf, size_t len) {
+    if (!impl || !impl->fp) return 0;
+    return fwrite(buf, 1, len, impl->fp);
+}
+
+void File::flush() {
+    if (impl && impl->fp) fflush(impl->fp);
+}
+
+File File::openNextFile(const char *mode) {
+    if (!impl || !impl->dir) return File();
+
+    struct dirent *ent;
+    while ((ent = readdir(impl->dir)) != nullptr) {
+        if (strcmp(ent->d_name, ".") == 0 || strcmp(ent->d_name, "..") == 0) continue;
+        std::string child = impl->path;
+        if (child.empty() || child.back() != '/') child += "/";
+        child += ent->d_name;
+        return File(open_impl(child.c_str(), mode));
+    }
+    return File();
+}
+
+time_t File::getLastWrite() {
+    struct stat st;
+    if (!impl || stat(impl->host_path.c_str(), &st) != 0) return 0;
+    return st.st_mtime;
+}
+
+String File::getNextFileName(bool *isDir) {
+    if (!impl || !impl->dir) return String();
+
+    struct dirent *ent;
+    while ((ent = readdir(impl->dir)) != nullptr) {
+        if (strcmp(ent->d_name, ".") == 0 || strcmp(ent->d_name, "..") == 0) continue;
+        std::string child = impl->path;
+        if (child.empty() || child.back() != '/') child += "/";
+        child += ent->d_name;
+        if (isDir) *isDir = ent->d_type == DT_DIR;
+        return String(child.c_str());
+    }
+    return String();
+}
+
+void File::rewindDirectory() {
+    if (impl && impl->dir) rewinddir(impl->dir);
+}
+
+void File::close() {
+    impl.reset();
+}
+
+// --- SDFS ---
+
+bool SDFS::begin(uint8_t ssPin, SPIClass &spi, uint32_t frequency, const char *mountpoint,
+                 uint8_t max_files, bool format_if_empty) {
+    (void)ssPin;
+    (void)spi;
+    (void)frequency;
+    (void)mountpoint;
+    (void)max_files;
+    (void)format_if_empty;
+    struct stat st;
+    return stat(sd_root.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+}
+
+bool SDFS::exists(const char *path) {
+    struct stat st;
+    return stat(host_path(path).c_str(), &st) == 0;
+}
+
+File SDFS::open(const char *path, const char *mode, bool create) {
+    (void)create;
+    return File(open_impl(path, mode));
+}
+
+bool SDFS::mkdir(const char *path) {
+    return ::mkdir(host_path(path).c_str(), 0755) == 0;
+}
+
+bool SDFS::remove(const char *path) {
+    return ::remove(host_path(path).c_str()) == 0;
+}
+
+bool SDFS::rename(const char *from, const char *to) {
+    return ::rename(host_path(from).c_str(), host_path(to).c_str()) == 0;
+}
@@ -0,0 +1,127 @@
+// Times codepoint lookups in an SD font (.ebf) over the characters of a
+// book, with the page table and with a binary search over the ranges.
+//
+//   font_bench [--sd DIR] [--passes N] /fonts/font.ebf book.txt
+//
+// The font path is on the simulated card (--sd, default "."); the book is
+// a host file, read as UTF-8. "lookup" is the codepoint to glyph id step
+// alone; "descriptor" is the whole get_glyph_dsc call, including reading
+// the glyph record through the block cache.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include <SD.h>
+#include "src/font/sd_font.h"
+
+static std::vector<uint32_t> read_codepoints(const char *path) {
+    std::vector<uint32_t> out;
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return out;
+    }
+    std::vector<uint8_t> data;
+    uint8_t buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) data.insert(data.end(), buf, buf + n);
+    fclose(f);
+
+    for (size_t i = 0; i < data.size();) {
+        uint8_t c = data[i];
+        int len = c < 0x80 ? 1 : (c >> 5) == 6 ? 2 : (c >> 4) == 14 ? 3 : (c >> 3) == 30 ? 4 : 0;
+        if (len == 0 || i + len > data.size()) {
+            i++;
+            continue;
+        }
+        uint32_t cp = len == 1 ? c : c & (0x7F >> len);
+        for (int k = 1; k < len; k++) cp = (cp << 6) | (data[i + k] & 0x3F);
+        i += len;
+        if (cp >= 0x20) out.push_back(cp);
+    }
+    return out;
+}
+
+static double now_ns() {
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// ns per character
+static double time_lookups(const std::vector<uint32_t> &text, int passes) {
+    volatile int32_t sink = 0;
+    double start = now_ns();
+    for (int p = 0; p < passes; p++) {
+        for (uint32_t cp : text) sink = sink + sd_font.glyph_id(cp);
+    }
+    return (now_ns() - start) / ((double)text.size() * passes);
+}
+
+static double time_descriptors(const std::vector<uint32_t> &text, int passes) {
+    const lv_font_t *font = sd_font.font();
+    lv_font_glyph_dsc_t dsc;
+    double start = now_ns();
+    for (int p = 0; p < passes; p++) {
+        for (uint32_t cp : text) font->get_glyph_dsc(font, &dsc, cp, 0);
+    }
+    return (now_ns() - start) / ((double)text.size() * passes);
+}
+
+int main(int argc, char **argv) {
+    const char *sd_dir = ".";
+    const char *font_path = nullptr;
+    const char *text_path = nullptr;
+    int passes = 20;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--sd") == 0 && i + 1 < argc) sd_dir = argv[++i];
+        else if (strcmp(argv[i], "--passes") == 0 && i + 1 < argc) passes = atoi(argv[++i]);
+        else if (!font_path) font_path = argv[i];
+        else text_path = argv[i];
+    }
+    if (!font_path || !text_path || passes < 1) {
+        fprintf(stderr, "Usage: %s [--sd DIR] [--passes N] /fonts/font.ebf book.txt\n", argv[0]);
+        return 1;
+    }
+
+    sim_sd_set_root(sd_dir);
+    if (!sd_font.open(font_path, SD_FONT_CACHE_BLOCKS, NULL)) return 1;
+    std::vector<uint32_t> text = read_codepoints(text_path);
+    if (text.empty()) {
+        fprintf(stderr, "%s: no text\n", text_path);
+        return 1;
+    }
+
+    sd_font_stats_t s;
+    sd_font.get_stats(&s);
+    printf("%s: %lu glyphs, %lu ranges, %u pages (%lu bytes)\n", font_path, (unsigned long)s.glyph_count,
+           (unsigned long)s.range_count, (unsigned)s.pages, (unsigned long)s.table_bytes);
+
+    // Both ways must find the same glyph for every character
+    uint32_t found = 0;
+    for (uint32_t cp : text) {
+        sd_font.set_page_table(false);
+        int32_t searched = sd_font.glyph_id(cp);
+        sd_font.set_page_table(true);
+        if (sd_font.glyph_id(cp) != searched) {
+            fprintf(stderr, "U+%04lX: glyph %ld in the ranges, %ld in the page table\n", (unsigned long)cp,
+                    (long)searched, (long)sd_font.glyph_id(cp));
+            return 1;
+        }
+        found += searched >= 0;
+    }
+
+    sd_font.set_page_table(false);
+    double lookup_ranges = time_lookups(text, passes);
+    double dsc_ranges = time_descriptors(text, passes);
+    sd_font.set_page_table(true);
+    double lookup_pages = time_lookups(text, passes);
+    double dsc_pages = time_descriptors(text, passes);
+
+    printf("%zu characters x %d passes, %lu in the font\n", text.size(), passes, (unsigned long)found);
+    printf("%-12s %12s %12s\n", "ns/char", "ranges", "page table");
+    printf("%-12s %12.1f %12.1f\n", "lookup", lookup_ranges, lookup_pages);
+    printf("%-12s %12.1f %12.1f\n", "descriptor", dsc_ranges, dsc_pages);
+    return 0;
+}
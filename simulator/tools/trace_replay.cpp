@@ -0,0 +1,227 @@
+// Replays a panel trace (serial 't' dump or ebook_sim --trace) into the
+// SSD1681 model and summarises the traffic per UI action and per waveform.
+//
+//   trace_replay [--frame-us N] trace.txt
+//
+// Recorded BUSY times come from the trace; modelled BUSY times come from
+// the LUT frame counts, so the two columns can be compared directly.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "sim_hal.h"
+#include "sim_panel.h"
+#include "src/display/epaper_driver_bsp.h"
+#include "src/display/epd_trace.h"
+
+static const int LUT_BYTES = 153;
+static const SimPanelPins REPLAY_PINS = {1, 2, 3, 4};
+
+struct ActionSummary {
+    std::string name;
+    uint32_t occurrences;
+    uint32_t commands;
+    uint64_t data_bytes;
+    uint32_t busy_waits;
+    uint64_t busy_us;
+    uint32_t refreshes;
+    uint64_t model_busy_us;
+};
+
+struct WaveformSummary {
+    uint32_t lut_crc;
+    uint8_t update_control;
+    uint32_t refreshes;
+    uint64_t data_bytes;
+    uint64_t busy_us;
+    uint64_t model_busy_us;
+};
+
+struct KnownLut {
+    const char *name;
+    const uint8_t *lut;
+    uint32_t trace_crc;
+};
+
+static KnownLut known_luts[] = {
+    {"WF_Full_1IN54", WF_Full_1IN54, 0},
+    {"WF_PARTIAL_1IN54_0", WF_PARTIAL_1IN54_0, 0},
+};
+
+static std::vector<ActionSummary> actions;
+static std::vector<WaveformSummary> waveforms;
+
+static ActionSummary &action_for(const std::string &name) {
+    for (auto &a : actions) {
+        if (a.name == name) return a;
+    }
+    actions.push_back({name, 0, 0, 0, 0, 0, 0, 0});
+    return actions.back();
+}
+
+static WaveformSummary &waveform_for(uint32_t crc, uint8_t control) {
+    for (auto &w : waveforms) {
+        if (w.lut_crc == crc && w.update_control == control) return w;
+    }
+    waveforms.push_back({crc, control, 0, 0, 0, 0});
+    return waveforms.back();
+}
+
+static const char *lut_name(uint32_t panel_crc) {
+    for (const auto &k : known_luts) {
+        if (sim_crc32(k.lut, LUT_BYTES) == panel_crc) return k.name;
+    }
+    return panel_crc ? "unknown" : "OTP";
+}
+
+static void send_command(uint8_t cmd) {
+    sim_panel.on_gpio(REPLAY_PINS.dc, 0);
+    sim_panel.on_spi(&cmd, 1);
+}
+
+static void send_data(uint8_t last_cmd, uint32_t length, uint32_t payload) {
+    sim_panel.on_gpio(REPLAY_PINS.dc, 1);
+
+    if (length <= (uint32_t)epd_trace_t::INLINE_BYTES) {
+        uint8_t bytes[4];
+        for (uint32_t i = 0; i < length; i++) bytes[i] = (payload >> (8 * i)) & 0xFF;
+        sim_panel.on_spi(bytes, length);
+        return;
+    }
+
+    // Long writes only carry a CRC: restore the LUT if it is one we know
+    if (last_cmd == 0x32 && length == LUT_BYTES) {
+        for (const auto &k : known_luts) {
+            if (k.trace_crc == payload) {
+                sim_panel.on_spi(k.lut, LUT_BYTES);
+                return;
+            }
+        }
+    }
+
+    static uint8_t filler[4096];
+    memset(filler, 0xFF, sizeof(filler));
+    while (length > 0) {
+        uint32_t n = length < sizeof(filler) ? length : sizeof(filler);
+        sim_panel.on_spi(filler, n);
+        length -= n;
+    }
+}
+
+static void print_report() {
+    printf("%-14s %6s %6s %9s %6s %11s %6s %11s\n",
+           "action", "count", "cmds", "data B", "busy", "busy ms", "refr", "model ms");
+    for (const auto &a : actions) {
+        if (a.commands == 0 && a.busy_waits == 0) continue;
+        printf("%-14s %6u %6u %9llu %6u %11.1f %6u %11.1f\n",
+               a.name.c_str(), (unsigned)a.occurrences, (unsigned)a.commands,
+               (unsigned long long)a.data_bytes, (unsigned)a.busy_waits, a.busy_us / 1000.0,
+               (unsigned)a.refreshes, a.model_busy_us / 1000.0);
+    }
+
+    printf("\n%-20s %5s %6s %12s %12s %12s\n",
+           "waveform", "ctrl", "refr", "B/refresh", "busy ms", "model ms");
+    for (const auto &w : waveforms) {
+        printf("%-20s  0x%02x %6u %12.0f %12.1f %12.1f\n",
+               lut_name(w.lut_crc), w.update_control, (unsigned)w.refreshes,
+               (double)w.data_bytes / w.refreshes, w.busy_us / 1000.0 / w.refreshes,
+               w.model_busy_us / 1000.0 / w.refreshes);
+    }
+}
+
+int main(int argc, char **argv) {
+    const char *path = nullptr;
+    uint32_t frame_us = 20000;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--frame-us") == 0 && i + 1 < argc) frame_us = atoi(argv[++i]);
+        else path = argv[i];
+    }
+    if (!path) {
+        fprintf(stderr, "Usage: %s [--frame-us N] trace.txt\n", argv[0]);
+        return 1;
+    }
+
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        perror(path);
+        return 1;
+    }
+
+    for (auto &k : known_luts) k.trace_crc = epd_trace_crc32(0, k.lut, LUT_BYTES);
+    sim_panel.configure(200, 200, REPLAY_PINS);
+    sim_panel.set_frame_us(frame_us);
+    sim_panel.on_gpio(REPLAY_PINS.cs, 0);
+
+    ActionSummary *action = &action_for("(start)");
+    action->occurrences = 1;
+    WaveformSummary *pending_refresh = nullptr;
+    uint64_t bytes_since_refresh = 0;
+    uint8_t last_cmd = 0;
+    bool have_base = false;
+    uint32_t base_ts = 0;
+
+    char line[256];
+    while (fgets(line, sizeof(line), f)) {
+        char type;
+        unsigned long ts;
+        int consumed = 0;
+        // Lines that are not trace records (other serial output) are skipped
+        if (sscanf(line, "%c %lu %n", &type, &ts, &consumed) < 2) continue;
+        const char *rest = line + consumed;
+
+        if (!have_base) {
+            base_ts = (uint32_t)ts;
+            have_base = true;
+        }
+        uint64_t rel_us = (uint32_t)((uint32_t)ts - base_ts);
+        if (rel_us > sim_now_us()) sim_advance_us(rel_us - sim_now_us());
+
+        if (type == 'M') {
+            char name[64] = "";
+            sscanf(rest, "%63s", name);
+            action = &action_for(name);
+            action->occurrences++;
+        } else if (type == 'C') {
+            unsigned cmd;
+            if (sscanf(rest, "%x", &cmd) != 1) continue;
+            last_cmd = (uint8_t)cmd;
+            action->commands++;
+
+            uint32_t refreshes = sim_panel.get_refresh_count();
+            uint64_t busy_before = sim_panel.get_busy_us();
+            send_command(last_cmd);
+            if (sim_panel.get_refresh_count() != refreshes) {
+                uint64_t model_us = sim_panel.get_busy_us() - busy_before;
+                WaveformSummary &w = waveform_for(sim_panel.get_lut_crc(), sim_panel.get_update_control());
+                w.refreshes++;
+                w.data_bytes += bytes_since_refresh;
+                w.model_busy_us += model_us;
+                action->refreshes++;
+                action->model_busy_us += model_us;
+                pending_refresh = &w;
+                bytes_since_refresh = 0;
+            }
+        } else if (type == 'D') {
+            unsigned long length, payload;
+            if (sscanf(rest, "%lu %lx", &length, &payload) != 2) continue;
+            action->data_bytes += length;
+            bytes_since_refresh += length;
+            send_data(last_cmd, (uint32_t)length, (uint32_t)payload);
+        } else if (type == 'B') {
+            unsigned long duration;
+            if (sscanf(rest, "%lu", &duration) != 1) continue;
+            action->busy_waits++;
+            action->busy_us += duration;
+            if (pending_refresh) {
+                pending_refresh->busy_us += duration;
+                pending_refresh = nullptr;
+            }
+        }
+    }
+    fclose(f);
+
+    print_report();
+    return 0;
+}
@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+"""Convert a TrueType/OpenType font to the reader's SD font format (.ebf).
+
+The layout is described in EbookReader/src/font/sd_font.h. Glyphs are
+rendered with Pillow at one pixel size and stored at 1, 2, 4 or 8 bits per
+pixel. The panel shows 1 bit, so --bpp 1 (the default) gives the smallest
+file and the fewest card reads for the same result.
+
+Without --range or --chars the font gets ASCII, CJK punctuation, full-width
+forms and the CJK Unified Ideographs block. Codepoints the font does not
+cover are left out; the reader draws them with the fallback font.
+
+usage: ebf_convert.py [--size PX] [--bpp N] [--range A-B]... [--chars FILE] font.ttf out.ebf
+"""
+
+import argparse
+import struct
+import sys
+
+from PIL import Image, ImageDraw, ImageFont
+
+MAGIC = b"EBF1"
+VERSION = 1
+HEADER_SIZE = 64
+RANGE_FORMAT = "<IHHI"
+GLYPH_FORMAT = "<IHBBbbH"
+
+DEFAULT_RANGES = [
+    (0x0020, 0x007E),   # ASCII
+    (0x00A0, 0x00FF),   # Latin-1
+    (0x2000, 0x206F),   # General punctuation: quotes, dashes, ellipsis
+    (0x3000, 0x303F),   # CJK punctuation
+    (0x4E00, 0x9FFF),   # CJK Unified Ideographs
+    (0xFF00, 0xFFEF),   # Full-width forms
+]
+
+
+def parse_range(text):
+    first, _, last = text.partition("-")
+    first = int(first, 0)
+    return first, int(last, 0) if last else first
+
+
+def render(font, ch, bpp):
+    """Returns (adv_w, box_w, box_h, ofs_x, ofs_y, packed bitmap)."""
+    adv_w = int(round(font.getlength(ch)))
+    x0, y0, x1, y1 = font.getbbox(ch, anchor="ls")
+    w, h = x1 - x0, y1 - y0
+    if w <= 0 or h <= 0:
+        return adv_w, 0, 0, 0, 0, b""
+
+    img = Image.new("L", (w, h), 0)
+    ImageDraw.Draw(img).text((-x0, -y0), ch, font=font, fill=255, anchor="ls")
+
+    bits = 0
+    nbits = 0
+    out = bytearray()
+    for v in img.tobytes():
+        bits = (bits << bpp) | (v >> (8 - bpp))
+        nbits += bpp
+        if nbits == 8:
+            out.append(bits)
+            bits = 0
+            nbits = 0
+    if nbits:
+        out.append(bits << (8 - nbits))
+    # LVGL's ofs_y is the bottom of the box above the baseline
+    return adv_w, w, h, x0, -y1, bytes(out)
+
+
+def main():
+    ap = argparse.ArgumentParser(usage=__doc__.strip().splitlines()[-1][len("usage: "):])
+    ap.add_argument("font")
+    ap.add_argument("out")
+    ap.add_argument("--size", type=int, default=16, help="pixel size (default 16)")
+    ap.add_argument("--bpp", type=int, default=1, choices=(1, 2, 4, 8))
+    ap.add_argument("--range", action="append", default=[], metavar="A-B",
+                    help="codepoints to include, e.g. 0x4E00-0x9FFF; repeatable")
+    ap.add_argument("--chars", help="include only the characters used in this UTF-8 text file")
+    ap.add_argument("--name", help="name stored in the file (default: family and style)")
+    args = ap.parse_args()
+
+    font = ImageFont.truetype(args.font, args.size)
+    ascent, descent = font.getmetrics()
+
+    codepoints = set()
+    for first, last in [parse_range(r) for r in args.range] or ([] if args.chars else DEFAULT_RANGES):
+        codepoints.update(range(first, last + 1))
+    if args.chars:
+        with open(args.chars, encoding="utf-8", errors="ignore") as f:
+            codepoints.update(ord(c) for c in f.read() if ord(c) >= 0x20)
+    codepoints.add(0x20)
+
+    # A codepoint the font lacks renders as its .notdef glyph
+    notdef = render(font, "\U0010FFFD", args.bpp)
+
+    glyphs = []
+    for cp in sorted(codepoints):
+        g = render(font, chr(cp), args.bpp)
+        if cp != 0x20 and g == notdef:
+            continue
+        adv_w, w, h, ofs_x, ofs_y, _ = g
+        if w > 255 or h > 255 or not -128 <= ofs_x <= 127 or not -128 <= ofs_y <= 127:
+            sys.exit("U+%04X does not fit the format at %dpx" % (cp, args.size))
+        glyphs.append((cp, g))
+
+    ranges = []
+    for i, (cp, _) in enumerate(glyphs):
+        if ranges and cp == ranges[-1][0] + ranges[-1][1] and ranges[-1][1] < 0xFFFF:
+            ranges[-1][1] += 1
+        else:
+            ranges.append([cp, 1, i])
+
+    range_offset = HEADER_SIZE
+    glyph_offset = range_offset + len(ranges) * struct.calcsize(RANGE_FORMAT)
+    bitmap_offset = glyph_offset + len(glyphs) * struct.calcsize(GLYPH_FORMAT)
+
+    records = bytearray()
+    bitmaps = bytearray()
+    for _, (adv_w, w, h, ofs_x, ofs_y, bitmap) in glyphs:
+        records += struct.pack(GLYPH_FORMAT, len(bitmaps), adv_w, w, h, ofs_x, ofs_y, 0)
+        bitmaps += bitmap
+    max_bitmap = max(len(g[5]) for _, g in glyphs)
+
+    name = args.name or " ".join(font.getname())
+    header = struct.pack("<4sHHHHhBBbBHIIIII24s", MAGIC, VERSION, HEADER_SIZE, args.size,
+                         ascent + descent, descent, args.bpp, 0, -max(1, descent // 2), 1,
+                         max_bitmap, len(glyphs), len(ranges), range_offset, glyph_offset,
+                         bitmap_offset, name.encode("utf-8")[:23])
+    assert len(header) == HEADER_SIZE
+
+    with open(args.out, "wb") as f:
+        f.write(header)
+        for first, count, first_glyph in ranges:
+            f.write(struct.pack(RANGE_FORMAT, first, count, 0, first_glyph))
+        f.write(records)
+        f.write(bitmaps)
+
+    print("%s: %s %dpx, %d bpp, %d glyphs in %d ranges, %d bytes"
+          % (args.out, name, args.size, args.bpp, len(glyphs), len(ranges),
+             bitmap_offset + len(bitmaps)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+"""Generate EbookReader/pinyin_table.h from Unicode::Collate's pinyin order.
+
+The input is Unicode/Collate/CJK/Pinyin.pm from Perl's Unicode::Collate
+(e.g. /usr/share/perl/5.36.0/Unicode/Collate/CJK/Pinyin.pm). Its data
+section lists CJK ideographs in pinyin collation order, with FDD0-00xx
+markers where each initial letter starts.
+
+Every ideograph in U+4E00..U+9FFF gets a rank in that order, starting at 1;
+0 means the character is not listed. PINYIN_LETTER_START gives the first
+rank of each initial letter, so the letter can be recovered from a rank.
+
+usage: gen_pinyin_table.py Pinyin.pm > EbookReader/pinyin_table.h
+"""
+
+import sys
+
+FIRST = 0x4E00
+LAST = 0x9FFF
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit(__doc__.strip().splitlines()[-1])
+
+    in_data = False
+    ranks = {}
+    letter_start = [None] * 26
+    rank = 0
+    with open(sys.argv[1], encoding="utf-8") as f:
+        for line in f:
+            if not in_data:
+                in_data = line.startswith("__DATA__")
+                continue
+            if line.startswith("__END__"):
+                break
+            for token in line.split():
+                if token.startswith("FDD0-"):
+                    letter = int(token[5:], 16) - ord("A")
+                    letter_start[letter] = rank + 1
+                    continue
+                cp = int(token, 16)
+                if FIRST <= cp <= LAST and cp not in ranks:
+                    rank += 1
+                    ranks[cp] = rank
+
+    # Letters no syllable starts with (i, u, v) share the next letter's start
+    next_start = rank + 1
+    for i in reversed(range(26)):
+        if letter_start[i] is None:
+            letter_start[i] = next_start
+        next_start = letter_start[i]
+
+    out = sys.stdout
+    out.write("// Generated by tools/gen_pinyin_table.py from Unicode::Collate's\n")
+    out.write("// Pinyin.pm. Do not edit.\n")
+    out.write("#ifndef PINYIN_TABLE_H\n#define PINYIN_TABLE_H\n\n")
+    out.write("#include <stdint.h>\n\n")
+    out.write("static const uint32_t PINYIN_FIRST = 0x%04X;\n" % FIRST)
+    out.write("static const uint32_t PINYIN_LAST = 0x%04X;\n" % LAST)
+    out.write("static const uint16_t PINYIN_RANK_COUNT = %d;\n\n" % rank)
+    out.write("// First rank of each initial letter a..z\n")
+    out.write("static const uint16_t PINYIN_LETTER_START[26] = {\n")
+    for i in range(0, 26, 13):
+        out.write("    " + ", ".join(str(v) for v in letter_start[i:i + 13]) + ",\n")
+    out.write("};\n\n")
+    out.write("// Pinyin rank of U+%04X..U+%04X, 0 = not listed\n" % (FIRST, LAST))
+    out.write("static const uint16_t PINYIN_RANK[%d] = {\n" % (LAST - FIRST + 1))
+    for base in range(FIRST, LAST + 1, 16):
+        row = [ranks.get(cp, 0) for cp in range(base, min(base + 16, LAST + 1))]
+        out.write("    " + ",".join(str(v) for v in row) + ",\n")
+    out.write("};\n\n#endif\n")
+
+
+if __name__ == "__main__":
+    main()